@@ -105,6 +105,11 @@ namespace OpenDDSharp.Build
         /// </summary>
         public bool CleanupTemporalFiles { get; internal set; }
 
+        /// <summary>
+        /// Gets a value indicating whether build the native wrapper with the allocation accounting.
+        /// </summary>
+        public bool AllocAccounting { get; internal set; }
+
         /// <summary>
         /// Gets the build configuration to use.
         /// </summary>
@@ -244,6 +249,15 @@ namespace OpenDDSharp.Build
                 IgnoreThirdPartyBuild = false;
             }
 
+            if (context.Arguments.HasArgument(nameof(AllocAccounting)))
+            {
+                AllocAccounting = bool.Parse(context.Arguments.GetArgument(nameof(AllocAccounting)));
+            }
+            else
+            {
+                AllocAccounting = false;
+            }
+
             if (context.Arguments.HasArgument(nameof(BranchName)))
             {
                 BranchName = context.Arguments.GetArgument(nameof(BranchName));
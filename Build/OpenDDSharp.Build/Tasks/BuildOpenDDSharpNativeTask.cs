@@ -70,6 +70,11 @@ namespace OpenDDSharp.Build.Tasks
                 arguments = $"--no-warn-unused-cli -DCMAKE_BUILD_TYPE=Release -DCMAKE_PREFIX_PATH={Path.GetFullPath(context.DdsRoot)} -DCMAKE_EXPORT_COMPILE_COMMANDS:BOOL=TRUE -H{nativeFolder} -B{buildFolder}";
             }
 
+            if (context.AllocAccounting)
+            {
+                arguments += " -DOPENDDSHARP_ALLOC_ACCOUNTING:BOOL=ON";
+            }
+
             context.CMake(new CMakeSettings
             {
                 SourcePath = nativeFolder,
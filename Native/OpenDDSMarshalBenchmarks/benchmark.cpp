@@ -0,0 +1,355 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "benchmark.h"
+#include "alloc_accounting.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <new>
+#include <sstream>
+
+namespace {
+#ifdef OPENDDSHARP_ALLOC_ACCOUNTING
+  // Allocation pass: the counts are deterministic, so a fixed number of iterations is enough. The counting
+  // operator new and the accounting hooks slow the helpers down, the time is not reported.
+  const bool COUNT_ALLOCATIONS = true;
+#else
+  const bool COUNT_ALLOCATIONS = false;
+#endif
+  const ACE_UINT64 ALLOCATION_ITERATIONS = 100;
+
+  // Every operator new of the process, the replacement below is used by OpenDDS and ACE as well on Linux and macOS.
+  // On Windows only the allocations made from this executable are counted, every DLL keeps its own operator new.
+  std::atomic<ACE_UINT64> heap_allocation_count{0};
+
+  // Buffers and strings reported by the marshaling helpers through alloc_accounting.h, including the malloc'ed
+  // buffers handed to the managed side that operator new does not see.
+  std::atomic<ACE_UINT64> wrapper_allocation_count{0};
+  std::atomic<ACE_UINT64> wrapper_byte_count{0};
+
+#ifdef OPENDDSHARP_ALLOC_ACCOUNTING
+  void wrapper_allocated(alloc_site *, const void *, size_t size) {
+    wrapper_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    wrapper_byte_count.fetch_add(size, std::memory_order_relaxed);
+  }
+
+  void wrapper_released(const void *) {
+  }
+
+  const alloc_hooks wrapper_hooks = { wrapper_allocated, wrapper_released };
+#endif
+
+  ACE_UINT64 now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+#ifdef OPENDDSHARP_ALLOC_ACCOUNTING
+  void *counted_malloc(std::size_t size) {
+    heap_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+#endif
+
+  struct benchmark_result {
+    std::string name;
+    ACE_UINT64 iterations = 0;
+    double ns_per_op = 0.0;
+    double bytes_per_op = 0.0;
+    double allocations_per_op = 0.0;
+    double wrapper_allocations_per_op = 0.0;
+    double wrapper_bytes_per_op = 0.0;
+  };
+
+  const double DEFAULT_MIN_TIME = 0.5;
+  const double DEFAULT_TOLERANCE = 10.0;
+  const ACE_UINT64 MAX_ITERATIONS = 1000000000;
+
+  benchmark_result measure(const benchmark_case &c, double min_time) {
+    const double min_time_ns = COUNT_ALLOCATIONS ? 0.0 : min_time * 1e9;
+    ACE_UINT64 iterations = COUNT_ALLOCATIONS ? ALLOCATION_ITERATIONS : 1;
+
+    for (;;) {
+      benchmark_state state(iterations, c.argument);
+      c.function(state);
+
+      const double elapsed = static_cast<double>(state.elapsed_ns());
+      if (elapsed >= min_time_ns || iterations >= MAX_ITERATIONS) {
+        const double n = static_cast<double>(state.iterations());
+        benchmark_result result;
+        result.name = c.name;
+        result.iterations = state.iterations();
+        result.ns_per_op = elapsed / n;
+        result.bytes_per_op = static_cast<double>(state.bytes_per_op());
+        result.allocations_per_op = static_cast<double>(state.allocations()) / n;
+        result.wrapper_allocations_per_op = static_cast<double>(state.wrapper_allocations()) / n;
+        result.wrapper_bytes_per_op = static_cast<double>(state.wrapper_bytes()) / n;
+        return result;
+      }
+
+      // Same growth as Google Benchmark: aim 40% above the minimum time, at most ten times more iterations.
+      double multiplier = elapsed > 0.0 ? (min_time_ns * 1.4) / elapsed : 10.0;
+      multiplier = (std::min)(multiplier, 10.0);
+      const ACE_UINT64 next = static_cast<ACE_UINT64>(static_cast<double>(iterations) * multiplier);
+      iterations = (std::min)((std::max)(next, iterations + 1), MAX_ITERATIONS);
+    }
+  }
+
+  std::map<std::string, benchmark_result> read_csv(const std::string &path) {
+    std::map<std::string, benchmark_result> results;
+    std::ifstream file(path);
+    if (!file) {
+      std::fprintf(stderr, "Cannot open the baseline %s\n", path.c_str());
+      return results;
+    }
+
+    std::string line;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+      std::istringstream fields(line);
+      std::string field;
+      std::vector<std::string> values;
+      while (std::getline(fields, field, ',')) {
+        values.push_back(field);
+      }
+
+      if (values.size() < 7) {
+        continue;
+      }
+
+      benchmark_result r;
+      r.name = values[0];
+      r.iterations = std::strtoull(values[1].c_str(), nullptr, 10);
+      r.ns_per_op = std::atof(values[2].c_str());
+      r.bytes_per_op = std::atof(values[3].c_str());
+      r.allocations_per_op = std::atof(values[4].c_str());
+      r.wrapper_allocations_per_op = std::atof(values[5].c_str());
+      r.wrapper_bytes_per_op = std::atof(values[6].c_str());
+      results[r.name] = r;
+    }
+
+    return results;
+  }
+
+  void write_csv(const std::string &path, const std::vector<benchmark_result> &results) {
+    std::ofstream file(path);
+    if (!file) {
+      std::fprintf(stderr, "Cannot write %s\n", path.c_str());
+      return;
+    }
+
+    file << "name,iterations,ns_per_op,bytes_per_op,allocs_per_op,wrapper_allocs_per_op,wrapper_bytes_per_op\n";
+    for (const auto &r : results) {
+      file << r.name << ',' << r.iterations << ',' << r.ns_per_op << ',' << r.bytes_per_op << ','
+           << r.allocations_per_op << ',' << r.wrapper_allocations_per_op << ',' << r.wrapper_bytes_per_op << '\n';
+    }
+  }
+
+  bool option(const std::string &arg, const char *name, std::string &value) {
+    const std::string prefix = std::string(name) + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0) {
+      return false;
+    }
+    value = arg.substr(prefix.size());
+    return true;
+  }
+}
+
+#ifdef OPENDDSHARP_ALLOC_ACCOUNTING
+void *operator new(std::size_t size) {
+  return counted_malloc(size);
+}
+
+void *operator new[](std::size_t size) {
+  return counted_malloc(size);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+#endif
+
+benchmark_state::benchmark_state(ACE_UINT64 iterations, long argument)
+  : iterations_(iterations), argument_(argument), remaining_(iterations) {
+}
+
+void benchmark_state::start() {
+  started_ = true;
+  start_allocations_ = heap_allocation_count.load(std::memory_order_relaxed);
+  start_wrapper_allocations_ = wrapper_allocation_count.load(std::memory_order_relaxed);
+  start_wrapper_bytes_ = wrapper_byte_count.load(std::memory_order_relaxed);
+  start_ns_ = now_ns();
+}
+
+void benchmark_state::stop() {
+  elapsed_ns_ = now_ns() - start_ns_;
+  allocations_ = heap_allocation_count.load(std::memory_order_relaxed) - start_allocations_;
+  wrapper_allocations_ = wrapper_allocation_count.load(std::memory_order_relaxed) - start_wrapper_allocations_;
+  wrapper_bytes_ = wrapper_byte_count.load(std::memory_order_relaxed) - start_wrapper_bytes_;
+}
+
+std::vector<benchmark_case> &benchmark_registry::cases() {
+  static std::vector<benchmark_case> registered;
+  return registered;
+}
+
+void benchmark_registry::add(const std::string &name, const std::function<void(benchmark_state &)> &function) {
+  cases().push_back({ name, 0, function });
+}
+
+void benchmark_registry::add(const std::string &name, const std::vector<long> &arguments,
+                             const std::function<void(benchmark_state &)> &function) {
+  for (long argument : arguments) {
+    cases().push_back({ name + "/" + std::to_string(argument), argument, function });
+  }
+}
+
+int run_benchmarks(int argc, char *argv[]) {
+  std::string filter;
+  std::string csv;
+  std::string baseline;
+  double min_time = DEFAULT_MIN_TIME;
+  double tolerance = DEFAULT_TOLERANCE;
+  int repetitions = 1;
+  bool list = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    std::string value;
+    if (option(arg, "--filter", value)) {
+      filter = value;
+    } else if (option(arg, "--min-time", value)) {
+      min_time = std::atof(value.c_str());
+    } else if (option(arg, "--repetitions", value)) {
+      repetitions = (std::max)(1, std::atoi(value.c_str()));
+    } else if (option(arg, "--csv", value)) {
+      csv = value;
+    } else if (option(arg, "--baseline", value)) {
+      baseline = value;
+    } else if (option(arg, "--tolerance", value)) {
+      tolerance = std::atof(value.c_str());
+    } else if (arg == "--list") {
+      list = true;
+    } else {
+      std::fprintf(stderr, "Usage: %s [--filter=<text>] [--min-time=<seconds>] [--repetitions=<n>] [--csv=<file>] "
+                           "[--baseline=<file>] [--tolerance=<percent>] [--list]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  ALLOC_ATTACH(&wrapper_hooks);
+
+  std::vector<benchmark_result> results;
+  if (!list && COUNT_ALLOCATIONS) {
+    std::printf("%-60s %12s %12s %10s %14s %14s\n", "Benchmark", "Iterations", "bytes/op", "allocs/op",
+                "wrap allocs/op", "wrap bytes/op");
+  } else if (!list) {
+    std::printf("%-60s %12s %12s %12s\n", "Benchmark", "Iterations", "ns/op", "bytes/op");
+  }
+
+  for (const auto &c : benchmark_registry::cases()) {
+    if (!filter.empty() && c.name.find(filter) == std::string::npos) {
+      continue;
+    }
+
+    if (list) {
+      std::printf("%s\n", c.name.c_str());
+      continue;
+    }
+
+    benchmark_result best = measure(c, min_time);
+    for (int r = 1; r < repetitions && !COUNT_ALLOCATIONS; ++r) {
+      benchmark_result result = measure(c, min_time);
+      if (result.ns_per_op < best.ns_per_op) {
+        best = result;
+      }
+    }
+
+    if (COUNT_ALLOCATIONS) {
+      best.ns_per_op = 0.0;
+      std::printf("%-60s %12llu %12.0f %10.2f %14.2f %14.0f\n", best.name.c_str(),
+                  static_cast<unsigned long long>(best.iterations), best.bytes_per_op,
+                  best.allocations_per_op, best.wrapper_allocations_per_op, best.wrapper_bytes_per_op);
+    } else {
+      std::printf("%-60s %12llu %12.1f %12.0f\n", best.name.c_str(),
+                  static_cast<unsigned long long>(best.iterations), best.ns_per_op, best.bytes_per_op);
+    }
+    std::fflush(stdout);
+    results.push_back(best);
+  }
+
+  ALLOC_ATTACH(nullptr);
+
+  if (!csv.empty()) {
+    write_csv(csv, results);
+  }
+
+  if (baseline.empty()) {
+    return 0;
+  }
+
+  // Each executable only compares what it measures. Allocation counts are deterministic, any increase is
+  // reported. The time is compared with the tolerance.
+  int regressions = 0;
+  const std::map<std::string, benchmark_result> previous = read_csv(baseline);
+  for (const auto &r : results) {
+    auto it = previous.find(r.name);
+    if (it == previous.end()) {
+      continue;
+    }
+
+    const benchmark_result &b = it->second;
+    if (!COUNT_ALLOCATIONS && r.ns_per_op > b.ns_per_op * (1.0 + (tolerance / 100.0))) {
+      std::printf("REGRESSION %s: %.1f ns/op, baseline %.1f ns/op\n", r.name.c_str(), r.ns_per_op, b.ns_per_op);
+      ++regressions;
+    }
+
+    if (COUNT_ALLOCATIONS && (r.allocations_per_op > b.allocations_per_op + 0.01 ||
+                              r.wrapper_allocations_per_op > b.wrapper_allocations_per_op + 0.01)) {
+      std::printf("REGRESSION %s: %.2f allocs/op (%.2f wrapper), baseline %.2f allocs/op (%.2f wrapper)\n",
+                  r.name.c_str(), r.allocations_per_op, r.wrapper_allocations_per_op, b.allocations_per_op,
+                  b.wrapper_allocations_per_op);
+      ++regressions;
+    }
+  }
+
+  std::printf("%d regression(s) against %s\n", regressions, baseline.c_str());
+  return regressions > 0 ? 1 : 0;
+}
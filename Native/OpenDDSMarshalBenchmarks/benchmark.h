@@ -0,0 +1,124 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include "ace/Basic_Types.h"
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// State of one benchmark run, shaped after Google Benchmark: the measured code is the body of the
+/// `while (state.keep_running())` loop, the setup before the loop and the cleanup after it are not timed.
+/// Heap allocations are counted for the same window when built with OPENDDSHARP_ALLOC_ACCOUNTING.
+class benchmark_state {
+
+  const ACE_UINT64 iterations_;
+  const long argument_;
+  ACE_UINT64 remaining_;
+  bool started_ = false;
+  size_t bytes_per_op_ = 0;
+
+  ACE_UINT64 start_ns_ = 0;
+  ACE_UINT64 start_allocations_ = 0;
+  ACE_UINT64 start_wrapper_allocations_ = 0;
+  ACE_UINT64 start_wrapper_bytes_ = 0;
+
+  ACE_UINT64 elapsed_ns_ = 0;
+  ACE_UINT64 allocations_ = 0;
+  ACE_UINT64 wrapper_allocations_ = 0;
+  ACE_UINT64 wrapper_bytes_ = 0;
+
+  void start();
+  void stop();
+
+public:
+  benchmark_state(ACE_UINT64 iterations, long argument);
+
+  bool keep_running() {
+    if (!started_) {
+      start();
+    }
+
+    if (remaining_ == 0) {
+      stop();
+      return false;
+    }
+
+    --remaining_;
+    return true;
+  }
+
+  /// Argument of the sweep point (element count, payload size...).
+  long argument() const { return argument_; }
+
+  /// Size of the marshaled buffer produced or consumed by one operation.
+  void set_bytes_per_op(size_t bytes) { bytes_per_op_ = bytes; }
+
+  ACE_UINT64 iterations() const { return iterations_; }
+  size_t bytes_per_op() const { return bytes_per_op_; }
+  ACE_UINT64 elapsed_ns() const { return elapsed_ns_; }
+  ACE_UINT64 allocations() const { return allocations_; }
+  ACE_UINT64 wrapper_allocations() const { return wrapper_allocations_; }
+  ACE_UINT64 wrapper_bytes() const { return wrapper_bytes_; }
+};
+
+/// Keeps the compiler from discarding a result that is never read.
+template<typename T>
+inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static const void *volatile sink;
+  sink = &value;
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+struct benchmark_case {
+  std::string name;
+  long argument;
+  std::function<void(benchmark_state &)> function;
+};
+
+class benchmark_registry {
+
+public:
+    static std::vector<benchmark_case> &cases();
+
+    static void add(const std::string &name, const std::function<void(benchmark_state &)> &function);
+
+    /// One case per argument, named `<name>/<argument>`.
+    static void add(const std::string &name, const std::vector<long> &arguments,
+                    const std::function<void(benchmark_state &)> &function);
+};
+
+/// Runs the registered cases and prints ns/op and bytes/op, or bytes/op and allocations/op when built with
+/// OPENDDSHARP_ALLOC_ACCOUNTING (OpenDDSMarshalAllocations). Options:
+///   --filter=<text>       only the cases whose name contains the text.
+///   --min-time=<seconds>  minimum measured time of every case, 0.5 by default. Ignored when counting allocations.
+///   --repetitions=<n>     measure every case n times and keep the fastest run. Ignored when counting allocations.
+///   --csv=<file>          also write the results as CSV.
+///   --baseline=<file>     compare with a previous CSV of the same executable, returns 1 when a case is slower
+///                         than the tolerance or allocates more than before.
+///   --tolerance=<percent> allowed ns/op increase against the baseline, 10 by default.
+///   --list                print the case names and exit.
+int run_benchmarks(int argc, char *argv[]);
@@ -0,0 +1,392 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "MarshalShapesTypeSupport.h"
+#include "benchmark.h"
+
+#include "ace/Init_ACE.h"
+
+#include <string>
+#include <vector>
+
+// Microbenchmarks of the marshaling helpers shared by every wrapper (marshal.h) and of the helpers the cwrapper
+// generator emits for each topic type. The measured operation includes the release of the returned buffer, as the
+// managed side always pairs both calls.
+namespace {
+  const std::vector<long> SEQUENCE_LENGTHS = { 1, 16, 256, 4096, 65536 };
+  const std::vector<long> SAMPLE_COUNTS = { 1, 16, 256, 4096 };
+  const std::vector<long> POINT_COUNTS = { 0, 16, 256, 4096 };
+  const std::vector<long> PAYLOAD_SIZES = { 64, 1024, 16384, 65536 };
+  const size_t STRING_LENGTH = 32;
+  const long SEQUENCE_POINT_COUNT = 16;
+  const long SEQUENCE_PAYLOAD_SIZE = 1024;
+
+  template<typename T>
+  void fill(TAO::unbounded_value_sequence<T> &seq, CORBA::ULong length) {
+    seq.length(length);
+    for (CORBA::ULong i = 0; i < length; ++i) {
+      ACE_OS::memset(&seq[i], static_cast<int>(i & 0xFF), sizeof(T));
+    }
+  }
+
+  template<typename T>
+  void sequence_to_ptr(benchmark_state &state) {
+    const CORBA::ULong length = static_cast<CORBA::ULong>(state.argument());
+    TAO::unbounded_value_sequence<T> seq(length);
+    fill(seq, length);
+
+    while (state.keep_running()) {
+      void *ptr = nullptr;
+      marshal::unbounded_sequence_to_ptr(seq, ptr);
+      do_not_optimize(ptr);
+      ACE_OS::free(ptr);
+    }
+
+    state.set_bytes_per_op(sizeof(ACE_UINT32) + (length * sizeof(T)));
+  }
+
+  template<typename T>
+  void ptr_to_sequence(benchmark_state &state) {
+    const CORBA::ULong length = static_cast<CORBA::ULong>(state.argument());
+    TAO::unbounded_value_sequence<T> seq(length);
+    fill(seq, length);
+
+    void *ptr = nullptr;
+    marshal::unbounded_sequence_to_ptr(seq, ptr);
+
+    while (state.keep_running()) {
+      TAO::unbounded_value_sequence<T> result;
+      marshal::ptr_to_unbounded_sequence(ptr, result);
+      do_not_optimize(result);
+    }
+
+    ACE_OS::free(ptr);
+    state.set_bytes_per_op(sizeof(ACE_UINT32) + (length * sizeof(T)));
+  }
+
+  void fill(TAO::unbounded_basic_string_sequence<char> &seq, CORBA::ULong length) {
+    const std::string text(STRING_LENGTH, 's');
+    seq.length(length);
+    for (CORBA::ULong i = 0; i < length; ++i) {
+      seq[i] = text.c_str();
+    }
+  }
+
+  void fill(TAO::unbounded_basic_string_sequence<wchar_t> &seq, CORBA::ULong length) {
+    const std::wstring text(STRING_LENGTH, L's');
+    seq.length(length);
+    for (CORBA::ULong i = 0; i < length; ++i) {
+      seq[i] = text.c_str();
+    }
+  }
+
+  void register_marshal_benchmarks() {
+    benchmark_registry::add("marshal/unbounded_sequence_to_ptr/Long", SEQUENCE_LENGTHS, sequence_to_ptr<CORBA::Long>);
+    benchmark_registry::add("marshal/unbounded_sequence_to_ptr/Point", SEQUENCE_LENGTHS,
+                            sequence_to_ptr<MarshalShapes::Point>);
+    benchmark_registry::add("marshal/ptr_to_unbounded_sequence/Long", SEQUENCE_LENGTHS, ptr_to_sequence<CORBA::Long>);
+    benchmark_registry::add("marshal/ptr_to_unbounded_sequence/Point", SEQUENCE_LENGTHS,
+                            ptr_to_sequence<MarshalShapes::Point>);
+
+    // The string buffers own a copy of every string, the release frees them one by one.
+    benchmark_registry::add("marshal/unbounded_basic_string_sequence_to_ptr", SEQUENCE_LENGTHS,
+                            [](benchmark_state &state) {
+      TAO::unbounded_basic_string_sequence<char> seq;
+      fill(seq, static_cast<CORBA::ULong>(state.argument()));
+
+      while (state.keep_running()) {
+        void *ptr = nullptr;
+        marshal::unbounded_basic_string_sequence_to_ptr(seq, ptr);
+        do_not_optimize(ptr);
+        marshal::release_basic_string_sequence_ptr(ptr);
+      }
+
+      state.set_bytes_per_op(sizeof(ACE_UINT32) + (seq.length() * (sizeof(char *) + STRING_LENGTH + 1)));
+    });
+
+    benchmark_registry::add("marshal/ptr_to_unbounded_basic_string_sequence", SEQUENCE_LENGTHS,
+                            [](benchmark_state &state) {
+      TAO::unbounded_basic_string_sequence<char> seq;
+      fill(seq, static_cast<CORBA::ULong>(state.argument()));
+      void *ptr = nullptr;
+      marshal::unbounded_basic_string_sequence_to_ptr(seq, ptr);
+
+      while (state.keep_running()) {
+        TAO::unbounded_basic_string_sequence<char> result;
+        marshal::ptr_to_unbounded_basic_string_sequence(ptr, result);
+        do_not_optimize(result);
+      }
+
+      marshal::release_basic_string_sequence_ptr(ptr);
+      state.set_bytes_per_op(sizeof(ACE_UINT32) + (seq.length() * (sizeof(char *) + STRING_LENGTH + 1)));
+    });
+
+    benchmark_registry::add("marshal/unbounded_wide_string_sequence_to_ptr", SEQUENCE_LENGTHS,
+                            [](benchmark_state &state) {
+      TAO::unbounded_basic_string_sequence<wchar_t> seq;
+      fill(seq, static_cast<CORBA::ULong>(state.argument()));
+
+      while (state.keep_running()) {
+        void *ptr = nullptr;
+        marshal::unbounded_wide_string_sequence_to_ptr(seq, ptr);
+        do_not_optimize(ptr);
+        marshal::release_wide_string_sequence_ptr(ptr);
+      }
+
+      state.set_bytes_per_op(sizeof(ACE_UINT32) +
+                             (seq.length() * (sizeof(wchar_t *) + ((STRING_LENGTH + 1) * sizeof(wchar_t)))));
+    });
+
+    benchmark_registry::add("marshal/ptr_to_unbounded_wide_string_sequence", SEQUENCE_LENGTHS,
+                            [](benchmark_state &state) {
+      TAO::unbounded_basic_string_sequence<wchar_t> seq;
+      fill(seq, static_cast<CORBA::ULong>(state.argument()));
+      void *ptr = nullptr;
+      marshal::unbounded_wide_string_sequence_to_ptr(seq, ptr);
+
+      while (state.keep_running()) {
+        TAO::unbounded_basic_string_sequence<wchar_t> result;
+        marshal::ptr_to_unbounded_wide_string_sequence(ptr, result);
+        do_not_optimize(result);
+      }
+
+      marshal::release_wide_string_sequence_ptr(ptr);
+      state.set_bytes_per_op(sizeof(ACE_UINT32) +
+                             (seq.length() * (sizeof(wchar_t *) + ((STRING_LENGTH + 1) * sizeof(wchar_t)))));
+    });
+  }
+
+  ::DDS::SampleInfo make_sample_info(CORBA::ULong i) {
+    ::DDS::SampleInfo info = {};
+    info.sample_state = ::DDS::NOT_READ_SAMPLE_STATE;
+    info.view_state = ::DDS::NEW_VIEW_STATE;
+    info.instance_state = ::DDS::ALIVE_INSTANCE_STATE;
+    info.source_timestamp.sec = static_cast<CORBA::Long>(i);
+    info.instance_handle = static_cast<::DDS::InstanceHandle_t>(i + 1);
+    info.publication_handle = 1;
+    info.valid_data = true;
+    return info;
+  }
+
+  void register_sample_info_benchmarks() {
+    benchmark_registry::add("marshal/dds_sample_info_serialize_to_bytes", [](benchmark_state &state) {
+      ::DDS::SampleInfo info = make_sample_info(0);
+      size_t size = 0;
+
+      while (state.keep_running()) {
+        char *data = nullptr;
+        marshal::dds_sample_info_serialize_to_bytes(info, data, size);
+        do_not_optimize(data);
+        ACE_OS::free(data);
+      }
+
+      state.set_bytes_per_op(size);
+    });
+
+    // The helper reads the first element to size the buffer, an empty sequence is never passed to it.
+    benchmark_registry::add("marshal/dds_sample_info_seq_serialize_to_bytes", SAMPLE_COUNTS,
+                            [](benchmark_state &state) {
+      const CORBA::ULong length = static_cast<CORBA::ULong>(state.argument());
+      ::DDS::SampleInfoSeq infos(length);
+      infos.length(length);
+      for (CORBA::ULong i = 0; i < length; ++i) {
+        infos[i] = make_sample_info(i);
+      }
+      size_t size = 0;
+
+      while (state.keep_running()) {
+        char *data = nullptr;
+        marshal::dds_sample_info_seq_serialize_to_bytes(infos, data, size);
+        do_not_optimize(data);
+        ACE_OS::free(data);
+      }
+
+      state.set_bytes_per_op(size);
+    });
+  }
+
+  MarshalShapes::Primitives make_primitives(CORBA::Long id, long) {
+    MarshalShapes::Primitives sample;
+    sample.Id = id;
+    sample.ShortField = static_cast<CORBA::Short>(id);
+    sample.LongLongField = static_cast<CORBA::LongLong>(id) << 32;
+    sample.UnsignedLongField = static_cast<CORBA::ULong>(id);
+    sample.FloatField = 1.5f;
+    sample.DoubleField = 2.5;
+    sample.BooleanField = true;
+    sample.OctetField = static_cast<CORBA::Octet>(id);
+    sample.CharField = 'c';
+    return sample;
+  }
+
+  MarshalShapes::Strings make_strings(CORBA::Long id, long) {
+    MarshalShapes::Strings sample;
+    sample.Key = ("key-" + std::to_string(id)).c_str();
+    sample.Name = std::string(STRING_LENGTH, 'n').c_str();
+    sample.Description = std::string(STRING_LENGTH * 4, 'd').c_str();
+    sample.WideName = std::wstring(STRING_LENGTH, L'w').c_str();
+    return sample;
+  }
+
+  MarshalShapes::Nested make_nested(CORBA::Long id, long points) {
+    MarshalShapes::Nested sample;
+    sample.Id = id;
+    sample.Origin.X = 1.0;
+    sample.Origin.Y = 2.0;
+    sample.Origin.Z = 3.0;
+
+    const CORBA::ULong length = static_cast<CORBA::ULong>(points);
+    sample.Points.length(length);
+    sample.Values.length(length);
+    for (CORBA::ULong i = 0; i < length; ++i) {
+      sample.Points[i].X = static_cast<double>(i);
+      sample.Points[i].Y = static_cast<double>(i) * 2.0;
+      sample.Points[i].Z = static_cast<double>(i) * 3.0;
+      sample.Values[i] = static_cast<CORBA::Long>(i);
+    }
+    return sample;
+  }
+
+  MarshalShapes::Octets make_octets(CORBA::Long id, long payload_size) {
+    MarshalShapes::Octets sample;
+    sample.Key = ("key-" + std::to_string(id)).c_str();
+
+    const CORBA::ULong length = static_cast<CORBA::ULong>(payload_size);
+    sample.Payload.length(length);
+    for (CORBA::ULong i = 0; i < length; ++i) {
+      sample.Payload[i] = static_cast<CORBA::Octet>(i);
+    }
+    return sample;
+  }
+
+  // _serialize_to_bytes and _deserialize_from_bytes of one sample, swept on the shape size when the shape has one,
+  // and Seq_serialize_to_bytes swept on the sample count.
+  template<typename T, typename TSeq>
+  class shape_benchmarks {
+
+  public:
+      typedef T (*factory)(CORBA::Long id, long size);
+      typedef void (*serialize_function)(const T &, char *&, size_t &);
+      typedef void (*serialize_seq_function)(const TSeq &, char *&, size_t &);
+      typedef T (*deserialize_function)(const char *, size_t);
+
+      static void add(const std::string &shape, factory make, const std::vector<long> &sizes, long sequence_size,
+                      serialize_function serialize, serialize_seq_function serialize_seq,
+                      deserialize_function deserialize) {
+        auto serialize_case = [make, serialize](benchmark_state &state) {
+          const T sample = make(1, state.argument());
+          size_t size = 0;
+
+          while (state.keep_running()) {
+            char *data = nullptr;
+            serialize(sample, data, size);
+            do_not_optimize(data);
+            ACE_OS::free(data);
+          }
+
+          state.set_bytes_per_op(size);
+        };
+
+        auto deserialize_case = [make, serialize, deserialize](benchmark_state &state) {
+          const T sample = make(1, state.argument());
+          char *data = nullptr;
+          size_t size = 0;
+          serialize(sample, data, size);
+
+          while (state.keep_running()) {
+            T value = deserialize(data, size);
+            do_not_optimize(value);
+          }
+
+          ACE_OS::free(data);
+          state.set_bytes_per_op(size);
+        };
+
+        auto serialize_seq_case = [make, serialize_seq, sequence_size](benchmark_state &state) {
+          const CORBA::ULong length = static_cast<CORBA::ULong>(state.argument());
+          TSeq seq(length);
+          seq.length(length);
+          for (CORBA::ULong i = 0; i < length; ++i) {
+            seq[i] = make(static_cast<CORBA::Long>(i), sequence_size);
+          }
+          size_t size = 0;
+
+          while (state.keep_running()) {
+            char *data = nullptr;
+            serialize_seq(seq, data, size);
+            do_not_optimize(data);
+            ACE_OS::free(data);
+          }
+
+          state.set_bytes_per_op(size);
+        };
+
+        const std::string prefix = "generated/" + shape;
+        if (sizes.empty()) {
+          benchmark_registry::add(prefix + "/serialize_to_bytes", serialize_case);
+          benchmark_registry::add(prefix + "/deserialize_from_bytes", deserialize_case);
+        } else {
+          benchmark_registry::add(prefix + "/serialize_to_bytes", sizes, serialize_case);
+          benchmark_registry::add(prefix + "/deserialize_from_bytes", sizes, deserialize_case);
+        }
+        benchmark_registry::add(prefix + "Seq/serialize_to_bytes", SAMPLE_COUNTS, serialize_seq_case);
+      }
+  };
+
+  void register_generated_benchmarks() {
+    shape_benchmarks<MarshalShapes::Primitives, MarshalShapes::PrimitivesSeq>::add(
+      "Primitives", make_primitives, {}, 0,
+      MarshalShapes_Primitives_serialize_to_bytes,
+      MarshalShapes_PrimitivesSeq_serialize_to_bytes,
+      MarshalShapes_Primitives_deserialize_from_bytes);
+
+    shape_benchmarks<MarshalShapes::Strings, MarshalShapes::StringsSeq>::add(
+      "Strings", make_strings, {}, 0,
+      MarshalShapes_Strings_serialize_to_bytes,
+      MarshalShapes_StringsSeq_serialize_to_bytes,
+      MarshalShapes_Strings_deserialize_from_bytes);
+
+    // Swept on the length of the Points and Values members.
+    shape_benchmarks<MarshalShapes::Nested, MarshalShapes::NestedSeq>::add(
+      "Nested", make_nested, POINT_COUNTS, SEQUENCE_POINT_COUNT,
+      MarshalShapes_Nested_serialize_to_bytes,
+      MarshalShapes_NestedSeq_serialize_to_bytes,
+      MarshalShapes_Nested_deserialize_from_bytes);
+
+    // Swept on the payload size.
+    shape_benchmarks<MarshalShapes::Octets, MarshalShapes::OctetsSeq>::add(
+      "Octets", make_octets, PAYLOAD_SIZES, SEQUENCE_PAYLOAD_SIZE,
+      MarshalShapes_Octets_serialize_to_bytes,
+      MarshalShapes_OctetsSeq_serialize_to_bytes,
+      MarshalShapes_Octets_deserialize_from_bytes);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  ACE::init();
+
+  register_marshal_benchmarks();
+  register_sample_info_benchmarks();
+  register_generated_benchmarks();
+
+  const int result = run_benchmarks(argc, argv);
+
+  ACE::fini();
+  return result;
+}
@@ -0,0 +1,328 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "discovery_test.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#include <dds/DCPS/transport/rtps_udp/RtpsUdpInst.h>
+
+namespace {
+  const DDS::Duration_t WAIT_PERIOD = { 0, 100000000 };
+  const CORBA::ULong PAYLOAD_SIZE = 64;
+
+  // Missing values are infinite, so the percentile is NaN when not enough endpoints got there.
+  double percentile(std::vector<double> values, const double p) {
+    if (values.empty()) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    std::sort(values.begin(), values.end());
+    const auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(values.size())));
+    const double value = values[rank == 0 ? 0 : rank - 1];
+    return std::isinf(value) ? std::numeric_limits<double>::quiet_NaN() : value;
+  }
+
+  double or_infinity(const double ms) {
+    return ms < 0 ? std::numeric_limits<double>::infinity() : ms;
+  }
+
+  // Late joiners get the sample already written, the first sample of a reader only waits for the match.
+  DDS::DataWriter_ptr create_durable_writer(DDS::Publisher_ptr publisher, DDS::Topic_ptr topic) {
+    DDS::DataWriterQos dw_qos;
+    publisher->get_default_datawriter_qos(dw_qos);
+    dw_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+    dw_qos.durability.kind = DDS::TRANSIENT_LOCAL_DURABILITY_QOS;
+    dw_qos.history.kind = DDS::KEEP_LAST_HISTORY_QOS;
+    dw_qos.history.depth = 1;
+
+    DDS::DataWriter_ptr writer = publisher->create_datawriter(topic, dw_qos, DDS::DataWriterListener::_nil(), OpenDDS::DCPS::NO_STATUS_MASK);
+    if (is_nil(writer)) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) create_datawriter failed.\n")));
+      throw std::runtime_error("create_datawriter failed.");
+    }
+
+    return writer;
+  }
+
+  DDS::DataReader_ptr create_durable_reader(DDS::Subscriber_ptr subscriber, DDS::Topic_ptr topic) {
+    DDS::DataReaderQos dr_qos;
+    subscriber->get_default_datareader_qos(dr_qos);
+    dr_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+    dr_qos.durability.kind = DDS::TRANSIENT_LOCAL_DURABILITY_QOS;
+    dr_qos.history.kind = DDS::KEEP_ALL_HISTORY_QOS;
+
+    DDS::DataReader_ptr reader = subscriber->create_datareader(topic, dr_qos, DDS::DataReaderListener::_nil(), OpenDDS::DCPS::NO_STATUS_MASK);
+    if (is_nil(reader)) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) create_datareader failed.\n")));
+      throw std::runtime_error("create_datareader failed.");
+    }
+
+    return reader;
+  }
+}
+
+void DiscoveryTest::initialize(const DDS::DomainId_t domain_id, const DiscoveryRole role, const CORBA::Long participants,
+  const CORBA::Long endpoints_per_participant, const int timeout_ms, const std::string& topic_prefix) {
+  if (participants <= 0 || endpoints_per_participant <= 0 || timeout_ms <= 0) {
+    throw std::runtime_error("The participants, endpoints and timeout must be greater than zero.");
+  }
+
+  this->domain_id_ = domain_id;
+  this->role_ = role;
+  this->participant_count_ = participants;
+  this->endpoints_per_participant_ = endpoints_per_participant;
+  this->timeout_ms_ = timeout_ms;
+  this->topic_prefix_ = topic_prefix;
+
+  this->sample_.ValueField.length(PAYLOAD_SIZE);
+  const auto data = random_bytes(PAYLOAD_SIZE);
+  for (CORBA::ULong i = 0; i < PAYLOAD_SIZE; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  this->wait_set_ = new DDS::WaitSet;
+}
+
+DiscoveryTest::Participant DiscoveryTest::create_participant(const CORBA::Long index) const {
+  static std::atomic<unsigned int> counter(0);
+  const std::string name = "discovery_" + this->topic_prefix_ + "_" + std::to_string(index) + "_" + std::to_string(counter++);
+
+  Participant p;
+  p.inst = TheTransportRegistry->create_inst(name, "rtps_udp");
+  const OpenDDS::DCPS::RtpsUdpInst_rch rtps_inst = OpenDDS::DCPS::static_rchandle_cast<OpenDDS::DCPS::RtpsUdpInst>(p.inst);
+  rtps_inst->use_multicast(false);
+  rtps_inst->local_address(OpenDDS::DCPS::NetworkAddress("127.0.0.1:0"));
+
+  p.config = TheTransportRegistry->create_config(name);
+  p.config->instances_.push_back(p.inst);
+
+  p.participant = TheParticipantFactory->create_participant(this->domain_id_, PARTICIPANT_QOS_DEFAULT,
+    DDS::DomainParticipantListener::_nil(), OpenDDS::DCPS::DEFAULT_STATUS_MASK);
+  if (is_nil(p.participant)) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) create_participant failed.\n")));
+    throw std::runtime_error("create_participant failed.");
+  }
+  TheTransportRegistry->bind_config(p.config, p.participant);
+
+  p.publisher = create_publisher(p.participant);
+  p.subscriber = create_subscriber(p.participant);
+
+  return p;
+}
+
+void DiscoveryTest::add_endpoint(Endpoint endpoint, DDS::Entity_ptr entity) {
+  endpoint.status_condition = entity->get_statuscondition();
+  endpoint.status_condition->set_enabled_statuses(is_nil(endpoint.writer)
+    ? DDS::SUBSCRIPTION_MATCHED_STATUS | DDS::DATA_AVAILABLE_STATUS
+    : DDS::PUBLICATION_MATCHED_STATUS);
+  if (this->wait_set_->attach_condition(endpoint.status_condition) != DDS::RETCODE_OK) {
+    throw std::runtime_error("attach_condition failed.");
+  }
+
+  this->conditions_[endpoint.status_condition] = this->endpoints_.size();
+  this->endpoints_.push_back(endpoint);
+
+  if (entity->enable() != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) endpoint enable failed.\n")));
+    throw std::runtime_error("endpoint enable failed.");
+  }
+}
+
+void DiscoveryTest::start() {
+  this->result_ = DiscoveryResult {};
+  this->start_ = std::chrono::steady_clock::now();
+
+  // Every endpoint of a topic matches the endpoints of the other side in the N participants, its own included.
+  const CORBA::Long expected = this->participant_count_;
+  for (CORBA::Long p = 0; p < this->participant_count_; ++p) {
+    Participant participant = this->create_participant(p);
+    this->participants_.push_back(participant);
+
+    for (CORBA::Long t = 0; t < this->endpoints_per_participant_; ++t) {
+      DDS::Topic_ptr topic = create_topic(participant.participant, this->topic_prefix_ + "_" + std::to_string(t));
+
+      if (this->role_ != DISCOVERY_ROLE_READERS) {
+        Endpoint endpoint;
+        endpoint.writer = create_durable_writer(participant.publisher, topic);
+        endpoint.expected_matches = expected;
+        this->add_endpoint(endpoint, endpoint.writer);
+
+        const OpenDDSNative::KeyedOctetsDataWriter_var data_writer = OpenDDSNative::KeyedOctetsDataWriter::_narrow(endpoint.writer);
+        const std::string key = std::to_string(p) + "_" + std::to_string(t);
+        this->sample_.KeyField = key.c_str();
+        if (data_writer->write(this->sample_, DDS::HANDLE_NIL) != DDS::RETCODE_OK) {
+          ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: write of sample %C failed.\n"), key.c_str()));
+        }
+      }
+
+      if (this->role_ != DISCOVERY_ROLE_WRITERS) {
+        Endpoint endpoint;
+        endpoint.reader = create_durable_reader(participant.subscriber, topic);
+        endpoint.data_reader = OpenDDSNative::KeyedOctetsDataReader::_narrow(endpoint.reader);
+        endpoint.expected_matches = expected;
+        this->add_endpoint(endpoint, endpoint.reader);
+      }
+    }
+  }
+
+  this->result_.setup_ms = this->elapsed_ms();
+}
+
+double DiscoveryTest::elapsed_ms() const {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->start_).count();
+}
+
+void DiscoveryTest::update(Endpoint& endpoint) const {
+  const double now = this->elapsed_ms();
+
+  if (!is_nil(endpoint.writer)) {
+    DDS::PublicationMatchedStatus status {};
+    endpoint.writer->get_publication_matched_status(status);
+    endpoint.matched = status.current_count;
+  } else {
+    DDS::SubscriptionMatchedStatus status {};
+    endpoint.reader->get_subscription_matched_status(status);
+    endpoint.matched = status.current_count;
+
+    OpenDDSNative::KeyedOctetsSeq samples;
+    DDS::SampleInfoSeq infos;
+    if (endpoint.data_reader->take(samples, infos, DDS::LENGTH_UNLIMITED,
+          DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE) == DDS::RETCODE_OK) {
+      for (CORBA::ULong i = 0; i < infos.length(); ++i) {
+        if (infos[i].valid_data && endpoint.first_sample_ms < 0) {
+          endpoint.first_sample_ms = now;
+        }
+      }
+      endpoint.data_reader->return_loan(samples, infos);
+    }
+  }
+
+  if (endpoint.matched > 0 && endpoint.first_match_ms < 0) {
+    endpoint.first_match_ms = now;
+  }
+
+  if (endpoint.matched >= endpoint.expected_matches && endpoint.full_match_ms < 0) {
+    endpoint.full_match_ms = now;
+  }
+}
+
+bool DiscoveryTest::done() const {
+  for (const auto& endpoint : this->endpoints_) {
+    if (endpoint.full_match_ms < 0 || (!is_nil(endpoint.reader) && endpoint.first_sample_ms < 0)) {
+      return false;
+    }
+
+    // The writers of the peer keep their durable sample until the readers of the driver are gone.
+    if (this->role_ == DISCOVERY_ROLE_WRITERS && endpoint.matched > 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void DiscoveryTest::wait() {
+  // The statuses changed before the conditions were attached are picked up here.
+  for (auto& endpoint : this->endpoints_) {
+    this->update(endpoint);
+  }
+
+  const auto deadline = this->start_ + std::chrono::milliseconds(this->timeout_ms_);
+  while (!this->done() && std::chrono::steady_clock::now() < deadline) {
+    DDS::ConditionSeq active_conditions;
+    if (this->wait_set_->wait(active_conditions, WAIT_PERIOD) != DDS::RETCODE_OK) {
+      continue;
+    }
+
+    for (CORBA::ULong i = 0; i < active_conditions.length(); ++i) {
+      const auto it = this->conditions_.find(active_conditions[i]);
+      if (it != this->conditions_.end()) {
+        this->update(this->endpoints_[it->second]);
+      }
+    }
+  }
+
+  if (!this->done()) {
+    ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: discovery didn't complete in %d ms.\n"), this->timeout_ms_));
+  }
+
+  this->summarize();
+}
+
+void DiscoveryTest::summarize() {
+  std::vector<double> first_matches;
+  std::vector<double> full_matches;
+  std::vector<double> first_samples;
+
+  this->result_.participants = this->participant_count_;
+  this->result_.endpoints_per_participant = this->endpoints_per_participant_;
+  this->result_.endpoints = static_cast<CORBA::LongLong>(this->endpoints_.size());
+  for (const auto& endpoint : this->endpoints_) {
+    first_matches.push_back(or_infinity(endpoint.first_match_ms));
+    full_matches.push_back(or_infinity(endpoint.full_match_ms));
+    if (endpoint.full_match_ms >= 0) {
+      ++this->result_.endpoints_matched;
+    }
+
+    if (!is_nil(endpoint.reader)) {
+      ++this->result_.readers;
+      first_samples.push_back(or_infinity(endpoint.first_sample_ms));
+      if (endpoint.first_sample_ms >= 0) {
+        ++this->result_.readers_with_data;
+      }
+    }
+  }
+
+  this->result_.first_match_ms = percentile(first_matches, 0.0);
+  this->result_.full_match_fifty_ms = percentile(full_matches, 0.50);
+  this->result_.full_match_ms = percentile(full_matches, 1.0);
+  this->result_.first_sample_fifty_ms = percentile(first_samples, 0.50);
+  this->result_.first_sample_ms = percentile(first_samples, 1.0);
+}
+
+void DiscoveryTest::finalize() {
+  for (auto& endpoint : this->endpoints_) {
+    endpoint.status_condition->set_enabled_statuses(OpenDDS::DCPS::NO_STATUS_MASK);
+    if (this->wait_set_->detach_condition(endpoint.status_condition) != DDS::RETCODE_OK) {
+      throw std::runtime_error("detach_condition failed.");
+    }
+    CORBA::release(endpoint.status_condition);
+  }
+  CORBA::release(this->wait_set_);
+  this->wait_set_ = nullptr;
+
+  for (auto& participant : this->participants_) {
+    participant.participant->delete_contained_entities();
+    TheParticipantFactory->delete_participant(participant.participant);
+    TheTransportRegistry->remove_config(participant.config);
+    TheTransportRegistry->remove_inst(participant.inst);
+  }
+
+  this->endpoints_.clear();
+  this->conditions_.clear();
+  this->participants_.clear();
+}
+
+const DiscoveryResult& DiscoveryTest::result() const {
+  return this->result_;
+}
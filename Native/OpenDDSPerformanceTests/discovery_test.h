@@ -0,0 +1,117 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include "utils.h"
+
+#include <dds/DCPS/transport/framework/TransportRegistry.h>
+
+/// Endpoints hosted by the process running the DiscoveryTest.
+enum DiscoveryRole : CORBA::Long {
+  // Single process: every participant has a writer and a reader on every topic.
+  DISCOVERY_ROLE_ALL = 0,
+  // Multi-process: the readers in this process, the writers in the peer.
+  DISCOVERY_ROLE_READERS = 1,
+  DISCOVERY_ROLE_WRITERS = 2
+};
+
+/// Measurements of a discovery run, all the times in milliseconds from the creation of the first participant.
+/// A time is NaN when no endpoint got there before the timeout.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct DiscoveryResult {
+  CORBA::LongLong participants;
+  CORBA::LongLong endpoints_per_participant;
+  CORBA::LongLong endpoints;
+  CORBA::LongLong endpoints_matched;
+  CORBA::LongLong readers;
+  CORBA::LongLong readers_with_data;
+  // Creation and enabling of every participant and endpoint of this process.
+  double setup_ms;
+  double first_match_ms;
+  // Median and maximum of the time each endpoint took to match all its remote endpoints.
+  double full_match_fifty_ms;
+  double full_match_ms;
+  // Median and maximum of the time each reader took to receive its first sample.
+  double first_sample_fifty_ms;
+  double first_sample_ms;
+};
+
+/// Discovery and time-to-first-sample test. Creates N participants with M topics each and, depending on the role,
+/// a writer and/or a reader per topic, then times the matches and the first samples with the status conditions of
+/// the endpoints instead of polling the matched handles. The discovery of the domain (RTPS with a given resend
+/// period or InfoRepo) is configured by the caller, every participant gets its own rtps_udp transport instance.
+/// The writers are TRANSIENT_LOCAL and write their sample as soon as they are enabled, so the first sample of a reader
+/// only waits for the match and the durable data delivery.
+class CLASS_EXPORT_FLAG DiscoveryTest {
+
+  struct Endpoint {
+    DDS::DataWriter_ptr writer = DDS::DataWriter::_nil();
+    DDS::DataReader_ptr reader = DDS::DataReader::_nil();
+    OpenDDSNative::KeyedOctetsDataReader_ptr data_reader = OpenDDSNative::KeyedOctetsDataReader::_nil();
+    DDS::StatusCondition_ptr status_condition = nullptr;
+    CORBA::Long expected_matches = 0;
+    CORBA::Long matched = 0;
+    double first_match_ms = -1;
+    double full_match_ms = -1;
+    double first_sample_ms = -1;
+  };
+
+  struct Participant {
+    DDS::DomainParticipant_ptr participant = DDS::DomainParticipant::_nil();
+    DDS::Publisher_ptr publisher = DDS::Publisher::_nil();
+    DDS::Subscriber_ptr subscriber = DDS::Subscriber::_nil();
+    OpenDDS::DCPS::TransportConfig_rch config;
+    OpenDDS::DCPS::TransportInst_rch inst;
+  };
+
+  DDS::DomainId_t domain_id_ = 0;
+  DiscoveryRole role_ = DISCOVERY_ROLE_ALL;
+  CORBA::Long participant_count_ = 0;
+  CORBA::Long endpoints_per_participant_ = 0;
+  int timeout_ms_ = 0;
+  std::string topic_prefix_;
+
+  std::vector<Participant> participants_;
+  std::vector<Endpoint> endpoints_;
+  std::map<DDS::Condition_ptr, size_t> conditions_;
+  DDS::WaitSet_ptr wait_set_ = nullptr;
+  OpenDDSNative::KeyedOctets sample_;
+  std::chrono::steady_clock::time_point start_;
+  DiscoveryResult result_ {};
+
+  Participant create_participant(CORBA::Long index) const;
+  void add_endpoint(Endpoint endpoint, DDS::Entity_ptr entity);
+  double elapsed_ms() const;
+  void update(Endpoint& endpoint) const;
+  bool done() const;
+  void summarize();
+
+public:
+  void initialize(DDS::DomainId_t domain_id, DiscoveryRole role, CORBA::Long participants, CORBA::Long endpoints_per_participant,
+                  int timeout_ms, const std::string& topic_prefix);
+  void start();
+  void wait();
+  void finalize();
+  const DiscoveryResult& result() const;
+};
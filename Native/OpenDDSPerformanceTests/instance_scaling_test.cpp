@@ -0,0 +1,218 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "instance_scaling_test.h"
+
+#include <chrono>
+
+namespace {
+  // Samples taken per call, as a reader draining a large cache would do.
+  const CORBA::Long TAKE_BATCH = 1024;
+
+  double per_second(const CORBA::ULongLong operations, const std::chrono::steady_clock::time_point start) {
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds > 0 ? static_cast<double>(operations) / seconds : 0;
+  }
+}
+
+void InstanceScalingTest::initialize(const CORBA::ULong total_instances, const CORBA::ULong samples_per_instance,
+                                     const CORBA::ULong payload_size, const bool keep_all, DDS::DomainParticipant_ptr participant) {
+  this->total_instances_ = total_instances;
+  this->samples_per_instance_ = samples_per_instance;
+  this->participant_ = participant;
+
+  this->sample_.ValueField.length(payload_size);
+  const auto data = random_bytes(payload_size);
+  for (CORBA::ULong i = 0; i < payload_size; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  // The keys are built before the run, only the DDS calls are timed.
+  this->keys_.reserve(total_instances);
+  for (CORBA::ULong i = 0; i < total_instances; ++i) {
+    this->keys_.push_back(std::to_string(i));
+  }
+  this->handles_.resize(total_instances, DDS::HANDLE_NIL);
+
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+  this->topic_ = create_topic(this->participant_);
+
+  this->writer_ = create_data_writer(this->publisher_, this->topic_);
+  this->data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_narrow(writer_);
+
+  DDS::DataWriterQos dw_qos;
+  if (this->data_writer_->get_qos(dw_qos) != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DataWriter get_qos failed.\n")));
+    throw std::runtime_error("DataWriter get_qos failed.");
+  }
+  dw_qos.history.kind = keep_all ? DDS::KEEP_ALL_HISTORY_QOS : DDS::KEEP_LAST_HISTORY_QOS;
+  dw_qos.history.depth = 1;
+  if (this->data_writer_->set_qos(dw_qos) != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DataWriter set_qos failed.\n")));
+    throw std::runtime_error("DataWriter set_qos failed.");
+  }
+
+  this->reader_ = create_data_reader(this->subscriber_, this->topic_);
+  this->data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_narrow(reader_);
+
+  DDS::DataReaderQos dr_qos;
+  if (this->data_reader_->get_qos(dr_qos) != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DataReader get_qos failed.\n")));
+    throw std::runtime_error("DataReader get_qos failed.");
+  }
+  dr_qos.history.kind = keep_all ? DDS::KEEP_ALL_HISTORY_QOS : DDS::KEEP_LAST_HISTORY_QOS;
+  dr_qos.history.depth = 1;
+  if (this->data_reader_->set_qos(dr_qos) != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DataReader set_qos failed.\n")));
+    throw std::runtime_error("DataReader set_qos failed.");
+  }
+
+  auto ret = writer_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+    throw std::runtime_error("writer enable failed.");
+  }
+
+  ret = reader_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+    throw std::runtime_error("reader enable failed.");
+  }
+
+  if (!wait_for_publications(reader_, 1, 5000) || !wait_for_subscriptions(writer_, 1, 5000)) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) The writer and the reader didn't match.\n")));
+    throw std::runtime_error("The writer and the reader didn't match.");
+  }
+}
+
+void InstanceScalingTest::wait_for_acknowledgments() const {
+  // Once acknowledged every sample is in the reader cache.
+  const DDS::Duration_t timeout = { 120, 0 };
+  if (this->writer_->wait_for_acknowledgments(timeout) != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: wait_for_acknowledgments timed out.\n")));
+  }
+}
+
+void InstanceScalingTest::run() {
+  this->result_ = InstanceScalingResult {};
+  this->result_.instances = this->total_instances_;
+  const size_t memory_before = resident_memory();
+
+  auto start = std::chrono::steady_clock::now();
+  for (CORBA::ULong i = 0; i < this->total_instances_; ++i) {
+    this->sample_.KeyField = this->keys_[i].c_str();
+    this->handles_[i] = this->data_writer_->register_instance(this->sample_);
+    if (this->handles_[i] == DDS::HANDLE_NIL) {
+      throw std::runtime_error("register_instance failed.");
+    }
+  }
+  this->result_.register_per_second = per_second(this->total_instances_, start);
+
+  const CORBA::ULongLong total_samples = static_cast<CORBA::ULongLong>(this->total_instances_) * this->samples_per_instance_;
+  start = std::chrono::steady_clock::now();
+  for (CORBA::ULong s = 0; s < this->samples_per_instance_; ++s) {
+    for (CORBA::ULong i = 0; i < this->total_instances_; ++i) {
+      this->sample_.KeyField = this->keys_[i].c_str();
+      if (this->data_writer_->write(this->sample_, this->handles_[i]) != DDS::RETCODE_OK) {
+        throw std::runtime_error("write failed.");
+      }
+    }
+  }
+  this->result_.write_per_second = per_second(total_samples, start);
+  this->result_.samples_written = static_cast<CORBA::LongLong>(total_samples);
+
+  this->wait_for_acknowledgments();
+
+  if (this->total_instances_ > 0) {
+    const size_t memory_after = resident_memory();
+    this->result_.bytes_per_instance = memory_after > memory_before
+      ? static_cast<double>(memory_after - memory_before) / this->total_instances_
+      : 0;
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (CORBA::ULong i = 0; i < this->total_instances_; ++i) {
+    this->sample_.KeyField = this->keys_[i].c_str();
+    if (this->data_writer_->lookup_instance(this->sample_) != this->handles_[i]) {
+      throw std::runtime_error("lookup_instance returned an unexpected handle.");
+    }
+  }
+  this->result_.lookup_per_second = per_second(this->total_instances_, start);
+
+  // KEEP_LAST 1 only keeps the last sample of each instance in the reader cache.
+  CORBA::ULongLong taken = 0;
+  start = std::chrono::steady_clock::now();
+  while (true) {
+    OpenDDSNative::KeyedOctetsSeq samples;
+    DDS::SampleInfoSeq infos;
+    const auto ret = this->data_reader_->take(samples, infos, TAKE_BATCH,
+      DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+    if (ret != DDS::RETCODE_OK) {
+      break;
+    }
+
+    taken += samples.length();
+    this->data_reader_->return_loan(samples, infos);
+  }
+  this->result_.take_per_second = per_second(taken, start);
+  this->result_.samples_taken = static_cast<CORBA::LongLong>(taken);
+
+  start = std::chrono::steady_clock::now();
+  for (CORBA::ULong i = 0; i < this->total_instances_; ++i) {
+    this->sample_.KeyField = this->keys_[i].c_str();
+    if (this->data_writer_->dispose(this->sample_, this->handles_[i]) != DDS::RETCODE_OK) {
+      throw std::runtime_error("dispose failed.");
+    }
+  }
+  this->result_.dispose_per_second = per_second(this->total_instances_, start);
+
+  this->wait_for_acknowledgments();
+}
+
+const InstanceScalingResult& InstanceScalingTest::result() const {
+  return this->result_;
+}
+
+void InstanceScalingTest::finalize() const {
+  DDS::ReturnCode_t result = this->publisher_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->subscriber_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  result = this->participant_->delete_topic(this->topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+}
@@ -0,0 +1,69 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+#include "utils.h"
+
+/// Measurements of an instance scaling run. Every member is 8 bytes wide so the layout is the same in the managed side.
+struct InstanceScalingResult {
+  CORBA::LongLong instances;
+  CORBA::LongLong samples_written;
+  CORBA::LongLong samples_taken;
+  double register_per_second;
+  double write_per_second;
+  double lookup_per_second;
+  double take_per_second;
+  double dispose_per_second;
+  // Resident memory growth of the process (writer and reader caches) after the samples are acknowledged.
+  double bytes_per_instance;
+};
+
+/// Instance count scaling test. Registers, writes, looks up, takes and disposes every instance of a keyed topic,
+/// timing each operation separately, so the cost of the instance maps of the writer and the reader shows up
+/// as the instance count grows. The history is either KEEP_LAST 1 or KEEP_ALL.
+class CLASS_EXPORT_FLAG InstanceScalingTest {
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  DDS::Topic_ptr topic_ = DDS::Topic::_nil();
+  DDS::DataWriter_ptr writer_ = DDS::DataWriter::_nil();
+  DDS::DataReader_ptr reader_ = DDS::DataReader::_nil();
+  OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_nil();
+  OpenDDSNative::KeyedOctetsDataReader_ptr data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_nil();
+  OpenDDSNative::KeyedOctets sample_;
+  std::vector<std::string> keys_;
+  std::vector<DDS::InstanceHandle_t> handles_;
+
+  CORBA::ULong total_instances_ = 0;
+  CORBA::ULong samples_per_instance_ = 0;
+  InstanceScalingResult result_ {};
+
+  void wait_for_acknowledgments() const;
+
+public:
+  void initialize(CORBA::ULong total_instances, CORBA::ULong samples_per_instance, CORBA::ULong payload_size, bool keep_all,
+                  DDS::DomainParticipant_ptr participant);
+  void run();
+  void finalize() const;
+  const InstanceScalingResult& result() const;
+};
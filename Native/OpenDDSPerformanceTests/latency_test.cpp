@@ -19,6 +19,8 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #include "latency_test.h"
 
+#include <cmath>
+
 void LatencyTest::initialize(const CORBA::ULong total_instances, const CORBA::ULong total_samples,
                              const CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant) {
 
@@ -96,19 +98,39 @@ void LatencyTest::initialize(const CORBA::ULong total_instances, const CORBA::UL
   }
 }
 
+void LatencyTest::set_rate(const double samples_per_second) {
+  this->rate_ = samples_per_second > 0.0 ? samples_per_second : 0.0;
+}
+
 void LatencyTest::run() {
-  if (!this->latencies_.empty()) {
-    this->latencies_.clear();
-  }
+  // The round trips go to fixed size histograms, so the memory does not grow with the number of samples.
+  this->histogram_.reset();
+  this->corrected_histogram_.reset();
+  this->sum_squares_ = 0.0;
+  this->corrected_sum_squares_ = 0.0;
 
   std::thread writer_thread([this] {
     this->notified_ = false;
 
+    const auto interval = this->rate_ > 0.0
+      ? std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(1e9 / this->rate_))
+      : std::chrono::nanoseconds::zero();
+    auto intended = std::chrono::steady_clock::now();
+
     for (int i = 1; i <= this->total_samples_; i++) {
       for (int j = 1; j <= this->total_instances_; j++) {
         this->sample_.KeyField = std::to_string(j).c_str();
 
-        auto t_start = std::chrono::high_resolution_clock::now();
+        // At a fixed rate, a slow round trip delays the next sends. Measuring from the scheduled time
+        // accounts the time those samples would have waited instead of omitting it.
+        if (interval.count() > 0) {
+          wait_until(intended);
+        }
+
+        const auto t_start = std::chrono::steady_clock::now();
+        if (interval.count() == 0) {
+          intended = t_start;
+        }
 
         auto ret = this->data_writer_->write(this->sample_, DDS::HANDLE_NIL);
         if (ret != DDS::RETCODE_OK) {
@@ -120,10 +142,15 @@ void LatencyTest::run() {
         this->cv_.wait(u_lock, [this] { return this->notified_; });
         this->notified_ = false;
 
-        const auto t_end = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration<double, std::milli>(t_end - t_start);
+        const auto t_end = std::chrono::steady_clock::now();
+        const auto round_trip = std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start).count();
+        const auto corrected_round_trip = std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - intended).count();
 
-        this->latencies_.push_back(duration.count());
+        this->histogram_.record(round_trip);
+        this->corrected_histogram_.record(corrected_round_trip);
+        this->sum_squares_ += static_cast<double>(round_trip) * static_cast<double>(round_trip);
+        this->corrected_sum_squares_ += static_cast<double>(corrected_round_trip) * static_cast<double>(corrected_round_trip);
+        intended += interval;
 
         u_lock.unlock();
       }
@@ -234,6 +261,25 @@ void LatencyTest::finalize() const {
   }
 }
 
-void* LatencyTest::get_latencies() const {
-  return serialize_latencies(this->latencies_);
+void* LatencyTest::get_histogram(const bool corrected) const {
+  void* ptr = nullptr;
+  (corrected ? this->corrected_histogram_ : this->histogram_).snapshot(ptr);
+  return ptr;
+}
+
+void LatencyTest::get_summary(const bool corrected, LatencySummary& summary) const {
+  const latency_histogram& histogram = corrected ? this->corrected_histogram_ : this->histogram_;
+
+  summary.count = histogram.count();
+  summary.min = histogram.minimum();
+  summary.max = histogram.maximum();
+  summary.mean = summary.count > 0 ? static_cast<double>(histogram.sum()) / static_cast<double>(summary.count) : 0.0;
+  const double sum_squares = corrected ? this->corrected_sum_squares_ : this->sum_squares_;
+  const double variance = summary.count > 0 ? (sum_squares / static_cast<double>(summary.count)) - (summary.mean * summary.mean) : 0.0;
+  summary.deviation = variance > 0.0 ? std::sqrt(variance) : 0.0;
+  summary.fifty = histogram.value_at_percentile(50.0);
+  summary.ninety = histogram.value_at_percentile(90.0);
+  summary.ninety_nine = histogram.value_at_percentile(99.0);
+  summary.ninety_nine_nine = histogram.value_at_percentile(99.9);
+  summary.ninety_nine_nine_nine = histogram.value_at_percentile(99.99);
 }
@@ -22,7 +22,22 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include <mutex>
 #include <condition_variable>
 #include "utils.h"
+#include "../latency_histogram.h"
 
+/// Percentile summary of a latency histogram, in nanoseconds.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct LatencySummary {
+  CORBA::ULongLong count;
+  CORBA::ULongLong min;
+  CORBA::ULongLong max;
+  double mean;
+  double deviation;
+  CORBA::ULongLong fifty;
+  CORBA::ULongLong ninety;
+  CORBA::ULongLong ninety_nine;
+  CORBA::ULongLong ninety_nine_nine;
+  CORBA::ULongLong ninety_nine_nine_nine;
+};
 
 class CLASS_EXPORT_FLAG LatencyTest {
 
@@ -37,7 +52,15 @@ class CLASS_EXPORT_FLAG LatencyTest {
   OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_nil();
   OpenDDSNative::KeyedOctetsDataReader_ptr data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_nil();
   OpenDDSNative::KeyedOctets sample_;
-  std::vector<double> latencies_;
+
+  // Round trips measured from the actual send and, to correct the coordinated omission,
+  // from the send time scheduled by the fixed rate. Both are the same when sending back-to-back.
+  latency_histogram histogram_;
+  latency_histogram corrected_histogram_;
+  // Sums of the squared round trips in ns², so the deviation needs no per-sample storage.
+  double sum_squares_ = 0.0;
+  double corrected_sum_squares_ = 0.0;
+  double rate_ = 0.0;
 
   CORBA::ULong total_instances_ = 0;
   CORBA::ULong total_samples_ = 0;
@@ -50,7 +73,9 @@ class CLASS_EXPORT_FLAG LatencyTest {
 
   public:
     void initialize(CORBA::ULong total_instances, CORBA::ULong total_samples, CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant);
+    void set_rate(double samples_per_second);
     void run();
     void finalize() const;
-    void* get_latencies() const;
+    void* get_histogram(bool corrected) const;
+    void get_summary(bool corrected, LatencySummary& summary) const;
 };
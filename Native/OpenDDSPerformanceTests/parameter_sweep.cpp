@@ -0,0 +1,284 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "parameter_sweep.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace {
+  const char* const PARAMETER_NAMES[SWEEP_PARAMETER_COUNT] = {
+    "max_message_size",
+    "max_samples_per_packet",
+    "send_delay_us",
+    "heartbeat_period_us",
+    "nak_response_delay_us",
+    "responsive_mode",
+    "anticipated_fragments"
+  };
+
+  void apply_parameter(const OpenDDS::DCPS::RtpsUdpInst_rch& inst, const CORBA::Long parameter, const CORBA::LongLong value) {
+    if (value < 0) {
+      return;
+    }
+
+    switch (parameter) {
+      case SWEEP_MAX_MESSAGE_SIZE:
+        inst->max_message_size(static_cast<size_t>(value));
+        break;
+      case SWEEP_MAX_SAMPLES_PER_PACKET:
+        inst->max_samples_per_packet(static_cast<size_t>(value));
+        break;
+      case SWEEP_SEND_DELAY_US:
+        inst->send_delay(OpenDDS::DCPS::TimeDuration(0, static_cast<suseconds_t>(value)));
+        break;
+      case SWEEP_HEARTBEAT_PERIOD_US:
+        inst->heartbeat_period(OpenDDS::DCPS::TimeDuration(0, static_cast<suseconds_t>(value)));
+        break;
+      case SWEEP_NAK_RESPONSE_DELAY_US:
+        inst->nak_response_delay(OpenDDS::DCPS::TimeDuration(0, static_cast<suseconds_t>(value)));
+        break;
+      case SWEEP_RESPONSIVE_MODE:
+        inst->responsive_mode(value != 0);
+        break;
+      case SWEEP_ANTICIPATED_FRAGMENTS:
+        inst->anticipated_fragments(static_cast<size_t>(value));
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void ParameterSweep::initialize(const CORBA::ULong payload_size, const CORBA::ULong throughput_samples, const CORBA::ULong latency_samples) {
+  this->payload_size_ = payload_size;
+  this->throughput_samples_ = throughput_samples;
+  this->latency_samples_ = latency_samples;
+  this->values_.clear();
+  this->results_.clear();
+}
+
+void ParameterSweep::add_values(const CORBA::Long parameter, const CORBA::LongLong* values, const CORBA::Long count) {
+  if (parameter < 0 || parameter >= SWEEP_PARAMETER_COUNT) {
+    throw std::runtime_error("Unknown sweep parameter.");
+  }
+
+  if (count < 0 || (count > 0 && values == nullptr)) {
+    throw std::runtime_error("Invalid sweep values.");
+  }
+
+  auto& list = this->values_[parameter];
+  list.insert(list.end(), values, values + count);
+}
+
+CORBA::ULong ParameterSweep::run() {
+  this->results_.clear();
+
+  // Parameters without values keep the transport default, represented by -1.
+  std::vector<std::vector<CORBA::LongLong>> grid(SWEEP_PARAMETER_COUNT);
+  for (CORBA::Long p = 0; p < SWEEP_PARAMETER_COUNT; ++p) {
+    const auto it = this->values_.find(p);
+    if (it == this->values_.end() || it->second.empty()) {
+      grid[p].push_back(-1);
+    } else {
+      grid[p] = it->second;
+    }
+  }
+
+  // Walk the cartesian product of the grid as an odometer.
+  std::vector<size_t> index(SWEEP_PARAMETER_COUNT, 0);
+  while (true) {
+    SweepResult result {};
+    for (CORBA::Long p = 0; p < SWEEP_PARAMETER_COUNT; ++p) {
+      result.parameters[p] = grid[p][index[p]];
+    }
+
+    this->run_point(result);
+    this->results_.push_back(result);
+
+    CORBA::Long p = 0;
+    while (p < SWEEP_PARAMETER_COUNT && ++index[p] == grid[p].size()) {
+      index[p] = 0;
+      ++p;
+    }
+
+    if (p == SWEEP_PARAMETER_COUNT) {
+      break;
+    }
+  }
+
+  this->mark_pareto_frontier();
+
+  return static_cast<CORBA::ULong>(this->results_.size());
+}
+
+void ParameterSweep::run_point(SweepResult& result) {
+  static std::atomic<unsigned int> counter(0);
+  const std::string name = "sweep_rtps_udp_" + std::to_string(counter++);
+
+  const OpenDDS::DCPS::TransportInst_rch inst = TheTransportRegistry->create_inst(name, "rtps_udp");
+  const OpenDDS::DCPS::RtpsUdpInst_rch rtps_inst = OpenDDS::DCPS::static_rchandle_cast<OpenDDS::DCPS::RtpsUdpInst>(inst);
+
+  // Loopback unicast only, the sweep measures the transport and not the network.
+  rtps_inst->use_multicast(false);
+  rtps_inst->local_address(OpenDDS::DCPS::NetworkAddress("127.0.0.1:0"));
+  for (CORBA::Long p = 0; p < SWEEP_PARAMETER_COUNT; ++p) {
+    apply_parameter(rtps_inst, p, result.parameters[p]);
+  }
+
+  const OpenDDS::DCPS::TransportConfig_rch config = TheTransportRegistry->create_config(name);
+  config->instances_.push_back(inst);
+
+  DDS::DomainParticipant_ptr participant = TheParticipantFactory->create_participant(DOMAIN_ID,
+    PARTICIPANT_QOS_DEFAULT, DDS::DomainParticipantListener::_nil(), OpenDDS::DCPS::DEFAULT_STATUS_MASK);
+  if (is_nil(participant)) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) create_participant failed.\n")));
+    throw std::runtime_error("create_participant failed.");
+  }
+  TheTransportRegistry->bind_config(config, participant);
+
+  result.throughput_samples_per_second = std::numeric_limits<double>::quiet_NaN();
+  result.throughput_megabits_per_second = std::numeric_limits<double>::quiet_NaN();
+  result.latency_average_ms = std::numeric_limits<double>::quiet_NaN();
+  result.latency_fifty_ms = std::numeric_limits<double>::quiet_NaN();
+  result.latency_ninety_nine_ms = std::numeric_limits<double>::quiet_NaN();
+
+  try {
+    ThroughputTest throughput_test;
+    throughput_test.initialize(this->throughput_samples_, this->payload_size_, participant);
+
+    const auto t_start = std::chrono::steady_clock::now();
+    const CORBA::ULong received = throughput_test.run();
+    const auto t_end = std::chrono::steady_clock::now();
+    throughput_test.finalize();
+
+    const double seconds = std::chrono::duration<double>(t_end - t_start).count();
+    result.samples_received = received;
+    if (seconds > 0) {
+      result.throughput_samples_per_second = received / seconds;
+      result.throughput_megabits_per_second = (static_cast<double>(received) * this->payload_size_ * 8.0) / (seconds * 1000000.0);
+    }
+
+    LatencyTest latency_test;
+    latency_test.initialize(1, this->latency_samples_, this->payload_size_, participant);
+    latency_test.run();
+    LatencySummary summary{};
+    latency_test.get_summary(false, summary);
+    latency_test.finalize();
+
+    if (summary.count > 0) {
+      result.latency_average_ms = summary.mean / 1e6;
+      result.latency_fifty_ms = static_cast<double>(summary.fifty) / 1e6;
+      result.latency_ninety_nine_ms = static_cast<double>(summary.ninety_nine) / 1e6;
+    }
+  } catch (const std::exception& ex) {
+    // A failing combination (e.g. a message size too small for the payload) is reported, not fatal.
+    ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: parameter sweep point %C failed: %C\n"), name.c_str(), ex.what()));
+    result.samples_received = 0;
+  }
+
+  global_cleanup(participant);
+  TheTransportRegistry->remove_config(config);
+  TheTransportRegistry->remove_inst(inst);
+}
+
+void ParameterSweep::mark_pareto_frontier() {
+  // A point is on the frontier if no other point has higher or equal throughput with lower or equal p99 latency,
+  // being strictly better in at least one of them.
+  for (auto& candidate : this->results_) {
+    candidate.pareto_optimal = 0;
+    if (candidate.samples_received == 0 || std::isnan(candidate.throughput_samples_per_second) || std::isnan(candidate.latency_ninety_nine_ms)) {
+      continue;
+    }
+
+    bool dominated = false;
+    for (const auto& other : this->results_) {
+      if (&other == &candidate || other.samples_received == 0 ||
+          std::isnan(other.throughput_samples_per_second) || std::isnan(other.latency_ninety_nine_ms)) {
+        continue;
+      }
+
+      const bool better_or_equal = other.throughput_samples_per_second >= candidate.throughput_samples_per_second &&
+                                   other.latency_ninety_nine_ms <= candidate.latency_ninety_nine_ms;
+      const bool strictly_better = other.throughput_samples_per_second > candidate.throughput_samples_per_second ||
+                                   other.latency_ninety_nine_ms < candidate.latency_ninety_nine_ms;
+      if (better_or_equal && strictly_better) {
+        dominated = true;
+        break;
+      }
+    }
+
+    candidate.pareto_optimal = dominated ? 0 : 1;
+  }
+}
+
+void ParameterSweep::report() const {
+  std::cout << "RTPS/UDP parameter sweep, payload " << this->payload_size_ << " bytes, "
+            << this->results_.size() << " points (* = Pareto frontier, -1 = default)" << std::endl;
+
+  std::cout << "  ";
+  for (const char* parameter_name : PARAMETER_NAMES) {
+    std::cout << std::setw(24) << parameter_name;
+  }
+  std::cout << std::setw(16) << "samples/s" << std::setw(12) << "Mbps"
+            << std::setw(12) << "avg ms" << std::setw(12) << "p50 ms" << std::setw(12) << "p99 ms" << std::endl;
+
+  std::vector<const SweepResult*> sorted;
+  for (const auto& result : this->results_) {
+    sorted.push_back(&result);
+  }
+
+  // Frontier first, ordered by latency, so the trade-off reads top to bottom.
+  std::stable_sort(sorted.begin(), sorted.end(), [](const SweepResult* a, const SweepResult* b) {
+    if (a->pareto_optimal != b->pareto_optimal) {
+      return a->pareto_optimal > b->pareto_optimal;
+    }
+    return a->latency_ninety_nine_ms < b->latency_ninety_nine_ms;
+  });
+
+  std::cout << std::fixed << std::setprecision(3);
+  for (const SweepResult* result : sorted) {
+    std::cout << (result->pareto_optimal ? "* " : "  ");
+    for (const CORBA::LongLong value : result->parameters) {
+      std::cout << std::setw(24) << value;
+    }
+    std::cout << std::setw(16) << result->throughput_samples_per_second << std::setw(12) << result->throughput_megabits_per_second
+              << std::setw(12) << result->latency_average_ms << std::setw(12) << result->latency_fifty_ms
+              << std::setw(12) << result->latency_ninety_nine_ms << std::endl;
+  }
+}
+
+void* ParameterSweep::get_results() const {
+  const auto length = static_cast<ACE_UINT32>(this->results_.size());
+  const size_t struct_size = sizeof(SweepResult);
+  const size_t buffer_size = (length * struct_size) + sizeof length;
+
+  // Same layout as the sequences marshalled by the wrapper: the length followed by the structures.
+  char* bytes = static_cast<char*>(ACE_OS::malloc(buffer_size));
+  ACE_OS::memcpy(bytes, &length, sizeof length);
+  for (ACE_UINT32 i = 0; i < length; i++) {
+    ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &this->results_[i], struct_size);
+  }
+
+  return bytes;
+}
@@ -0,0 +1,72 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <map>
+#include <vector>
+#include "latency_test.h"
+#include "throughput_test.h"
+
+#include <dds/DCPS/transport/framework/TransportRegistry.h>
+#include <dds/DCPS/transport/rtps_udp/RtpsUdpInst.h>
+
+/// RtpsUdpInst and TransportInst knobs that can be swept.
+enum SweepParameter : CORBA::Long {
+  SWEEP_MAX_MESSAGE_SIZE = 0,
+  SWEEP_MAX_SAMPLES_PER_PACKET = 1,
+  SWEEP_SEND_DELAY_US = 2,
+  SWEEP_HEARTBEAT_PERIOD_US = 3,
+  SWEEP_NAK_RESPONSE_DELAY_US = 4,
+  SWEEP_RESPONSIVE_MODE = 5,
+  SWEEP_ANTICIPATED_FRAGMENTS = 6,
+  SWEEP_PARAMETER_COUNT = 7
+};
+
+/// One point of the parameter grid and its measurements. A parameter value of -1 means the transport default.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct SweepResult {
+  CORBA::LongLong parameters[SWEEP_PARAMETER_COUNT];
+  CORBA::LongLong samples_received;
+  double throughput_samples_per_second;
+  double throughput_megabits_per_second;
+  double latency_average_ms;
+  double latency_fifty_ms;
+  double latency_ninety_nine_ms;
+  CORBA::LongLong pareto_optimal;
+};
+
+class CLASS_EXPORT_FLAG ParameterSweep {
+
+  CORBA::ULong payload_size_ = 0;
+  CORBA::ULong throughput_samples_ = 0;
+  CORBA::ULong latency_samples_ = 0;
+  std::map<CORBA::Long, std::vector<CORBA::LongLong>> values_;
+  std::vector<SweepResult> results_;
+
+  void run_point(SweepResult& result);
+  void mark_pareto_frontier();
+
+public:
+  void initialize(CORBA::ULong payload_size, CORBA::ULong throughput_samples, CORBA::ULong latency_samples);
+  void add_values(CORBA::Long parameter, const CORBA::LongLong* values, CORBA::Long count);
+  CORBA::ULong run();
+  void report() const;
+  void* get_results() const;
+};
@@ -35,8 +35,16 @@ void latency_run(LatencyTest* test) {
   test->run();
 }
 
-void* latency_get_latencies(const LatencyTest* test) {
-  return test->get_latencies();
+void latency_set_rate(LatencyTest* test, const double samples_per_second) {
+  test->set_rate(samples_per_second);
+}
+
+void* latency_get_histogram(const LatencyTest* test, const CORBA::Boolean corrected) {
+  return test->get_histogram(corrected);
+}
+
+void latency_get_summary(const LatencyTest* test, const CORBA::Boolean corrected, LatencySummary* summary) {
+  test->get_summary(corrected, *summary);
 }
 
 void latency_finalize(LatencyTest* test) {
@@ -76,4 +84,258 @@ CORBA::ULong throughput_run(ThroughputTest* test) {
 
 void throughput_finalize(ThroughputTest* test) {
   test->finalize();
-}
\ No newline at end of file
+}
+
+ParameterSweep* sweep_initialize(const CORBA::ULongLong payload_size, const CORBA::Long throughput_samples,
+  const CORBA::Long latency_samples) {
+
+  auto* sweep = new ParameterSweep();
+
+  sweep->initialize(payload_size, throughput_samples, latency_samples);
+
+  return sweep;
+}
+
+void sweep_add_values(ParameterSweep* sweep, const CORBA::Long parameter, const CORBA::LongLong* values, const CORBA::Long count) {
+  sweep->add_values(parameter, values, count);
+}
+
+CORBA::ULong sweep_run(ParameterSweep* sweep) {
+  return sweep->run();
+}
+
+void sweep_report(const ParameterSweep* sweep) {
+  sweep->report();
+}
+
+void* sweep_get_results(const ParameterSweep* sweep) {
+  return sweep->get_results();
+}
+
+void sweep_finalize(ParameterSweep* sweep) {
+  delete sweep;
+}
+
+ScalingTest* scaling_initialize(const CORBA::Long writers, const CORBA::Long readers, const CORBA::Long topics,
+  const CORBA::Long instances, const CORBA::Long samples_per_writer, const CORBA::ULongLong payload_size,
+  const CORBA::Boolean reliable, const CORBA::Boolean pin_threads, DDS::DomainParticipant_ptr participant) {
+
+  ScalingConfig config {};
+  config.writers = writers;
+  config.readers = readers;
+  config.topics = topics;
+  config.instances = instances;
+  config.samples_per_writer = samples_per_writer;
+  config.payload_size = static_cast<CORBA::ULong>(payload_size);
+  config.reliable = reliable;
+  config.pin_threads = pin_threads;
+
+  auto* test = new ScalingTest();
+
+  test->initialize(config, participant);
+
+  return test;
+}
+
+void scaling_run(ScalingTest* test) {
+  test->run();
+}
+
+void scaling_get_result(const ScalingTest* test, ScalingResult* result) {
+  *result = test->result();
+}
+
+void* scaling_get_readers(const ScalingTest* test) {
+  return test->get_readers();
+}
+
+void scaling_finalize(ScalingTest* test) {
+  test->finalize();
+  delete test;
+}
+
+InstanceScalingTest* instance_scaling_initialize(const CORBA::Long total_instances, const CORBA::Long samples_per_instance,
+  const CORBA::ULongLong payload_size, const CORBA::Boolean keep_all, DDS::DomainParticipant_ptr participant) {
+
+  auto* test = new InstanceScalingTest();
+
+  test->initialize(total_instances, samples_per_instance, payload_size, keep_all, participant);
+
+  return test;
+}
+
+void instance_scaling_run(InstanceScalingTest* test) {
+  test->run();
+}
+
+void instance_scaling_get_result(const InstanceScalingTest* test, InstanceScalingResult* result) {
+  *result = test->result();
+}
+
+void instance_scaling_finalize(InstanceScalingTest* test) {
+  test->finalize();
+  delete test;
+}
+
+SplitProcessTest* split_initialize(const CORBA::Boolean driver, const char* topic_prefix, const CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant) {
+
+  auto* test = new SplitProcessTest();
+
+  test->initialize(driver, topic_prefix, payload_size, participant);
+
+  return test;
+}
+
+void split_run_latency(SplitProcessTest* test, const CORBA::Long total_samples) {
+  test->run_latency(total_samples);
+}
+
+void* split_get_latencies(const SplitProcessTest* test) {
+  return test->get_latencies();
+}
+
+void* split_get_round_trips(const SplitProcessTest* test) {
+  return test->get_round_trips();
+}
+
+CORBA::ULong split_run_throughput(SplitProcessTest* test, const CORBA::Long total_samples) {
+  return test->run_throughput(total_samples);
+}
+
+void split_run_peer(SplitProcessTest* test) {
+  test->run_peer();
+}
+
+void split_finalize(SplitProcessTest* test) {
+  // The driver tells the peer process to exit before deleting its entities.
+  test->stop_peer();
+  test->finalize();
+  delete test;
+}
+
+WrapperOverheadTest* wrapper_overhead_initialize(const CORBA::Long total_samples, const CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant) {
+
+  auto* test = new WrapperOverheadTest();
+
+  test->initialize(total_samples, payload_size, participant);
+
+  return test;
+}
+
+void wrapper_overhead_run(WrapperOverheadTest* test) {
+  test->run();
+}
+
+void* wrapper_overhead_get_results(const WrapperOverheadTest* test) {
+  return test->get_results();
+}
+
+void wrapper_overhead_finalize(WrapperOverheadTest* test) {
+  test->finalize();
+  delete test;
+}
+
+DiscoveryTest* discovery_initialize(const CORBA::Long domain_id, const CORBA::Long role, const CORBA::Long participants,
+  const CORBA::Long endpoints_per_participant, const CORBA::Long timeout_ms, const char* topic_prefix) {
+
+  auto* test = new DiscoveryTest();
+
+  test->initialize(domain_id, static_cast<DiscoveryRole>(role), participants, endpoints_per_participant, timeout_ms,
+    topic_prefix);
+
+  return test;
+}
+
+void discovery_start(DiscoveryTest* test) {
+  test->start();
+}
+
+void discovery_wait(DiscoveryTest* test) {
+  test->wait();
+}
+
+void discovery_get_result(const DiscoveryTest* test, DiscoveryResult* result) {
+  *result = test->result();
+}
+
+void discovery_finalize(DiscoveryTest* test) {
+  test->finalize();
+  delete test;
+}
+
+ShapeTest* shape_initialize(const CORBA::Long shape, const CORBA::ULongLong payload_size, DDS::DomainParticipant_ptr participant) {
+  auto* test = new ShapeTest();
+
+  test->initialize(static_cast<TypeShape>(shape), payload_size, participant);
+
+  return test;
+}
+
+CORBA::ULong shape_run_throughput(ShapeTest* test, const CORBA::Long total_samples) {
+  return test->run_throughput(total_samples);
+}
+
+void shape_run_latency(ShapeTest* test, const CORBA::Long total_samples) {
+  test->run_latency(total_samples);
+}
+
+void* shape_get_latencies(const ShapeTest* test) {
+  return test->get_latencies();
+}
+
+CORBA::ULongLong shape_get_sample_size(const ShapeTest* test) {
+  return test->sample_size();
+}
+
+void shape_finalize(ShapeTest* test) {
+  test->finalize();
+  delete test;
+}
+
+ReceiveStrategyTest* receive_strategy_initialize(const CORBA::Long strategy, const CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant) {
+
+  auto* test = new ReceiveStrategyTest();
+
+  test->initialize(static_cast<ReceiveStrategy>(strategy), payload_size, participant);
+
+  return test;
+}
+
+void receive_strategy_run(ReceiveStrategyTest* test, const CORBA::Long total_samples, const double samples_per_second) {
+  test->run(total_samples, samples_per_second);
+}
+
+void receive_strategy_get_result(const ReceiveStrategyTest* test, ReceiveStrategyResult* result) {
+  *result = test->result();
+}
+
+void receive_strategy_finalize(ReceiveStrategyTest* test) {
+  test->finalize();
+  delete test;
+}
+
+SustainedRateTest* sustained_rate_initialize(const SustainedRateConfig* config, const CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant) {
+
+  auto* test = new SustainedRateTest();
+
+  test->initialize(*config, payload_size, participant);
+
+  return test;
+}
+
+void sustained_rate_run(SustainedRateTest* test, const CORBA::Long total_samples, const double samples_per_second) {
+  test->run(total_samples, samples_per_second);
+}
+
+void sustained_rate_get_result(const SustainedRateTest* test, SustainedRateResult* result) {
+  *result = test->result();
+}
+
+void sustained_rate_finalize(SustainedRateTest* test) {
+  test->finalize();
+  delete test;
+}
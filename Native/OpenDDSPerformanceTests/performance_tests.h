@@ -21,6 +21,15 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 #include "latency_test.h"
 #include "throughput_test.h"
+#include "discovery_test.h"
+#include "instance_scaling_test.h"
+#include "parameter_sweep.h"
+#include "receive_strategy_test.h"
+#include "scaling_test.h"
+#include "shape_test.h"
+#include "split_process_test.h"
+#include "sustained_rate_test.h"
+#include "wrapper_overhead_test.h"
 
 EXTERN_METHOD_EXPORT
 LatencyTest* latency_initialize(CORBA::Long total_instances, CORBA::Long total_samples, CORBA::ULongLong payload_size,
@@ -33,7 +42,13 @@ EXTERN_METHOD_EXPORT
 void latency_finalize(LatencyTest* test);
 
 EXTERN_METHOD_EXPORT
-void* latency_get_latencies(const LatencyTest* test);
+void latency_set_rate(LatencyTest* test, double samples_per_second);
+
+EXTERN_METHOD_EXPORT
+void* latency_get_histogram(const LatencyTest* test, CORBA::Boolean corrected);
+
+EXTERN_METHOD_EXPORT
+void latency_get_summary(const LatencyTest* test, CORBA::Boolean corrected, LatencySummary* summary);
 
 EXTERN_METHOD_EXPORT
 DDS::DomainParticipant* global_setup(const char * config_name);
@@ -51,3 +66,145 @@ CORBA::ULong throughput_run(ThroughputTest* test);
 EXTERN_METHOD_EXPORT
 void throughput_finalize(ThroughputTest* test);
 
+EXTERN_METHOD_EXPORT
+ParameterSweep* sweep_initialize(CORBA::ULongLong payload_size, CORBA::Long throughput_samples, CORBA::Long latency_samples);
+
+EXTERN_METHOD_EXPORT
+void sweep_add_values(ParameterSweep* sweep, CORBA::Long parameter, const CORBA::LongLong* values, CORBA::Long count);
+
+EXTERN_METHOD_EXPORT
+CORBA::ULong sweep_run(ParameterSweep* sweep);
+
+EXTERN_METHOD_EXPORT
+void sweep_report(const ParameterSweep* sweep);
+
+EXTERN_METHOD_EXPORT
+void* sweep_get_results(const ParameterSweep* sweep);
+
+EXTERN_METHOD_EXPORT
+void sweep_finalize(ParameterSweep* sweep);
+
+EXTERN_METHOD_EXPORT
+ScalingTest* scaling_initialize(CORBA::Long writers, CORBA::Long readers, CORBA::Long topics, CORBA::Long instances,
+  CORBA::Long samples_per_writer, CORBA::ULongLong payload_size, CORBA::Boolean reliable, CORBA::Boolean pin_threads,
+  DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+void scaling_run(ScalingTest* test);
+
+EXTERN_METHOD_EXPORT
+void scaling_get_result(const ScalingTest* test, ScalingResult* result);
+
+EXTERN_METHOD_EXPORT
+void* scaling_get_readers(const ScalingTest* test);
+
+EXTERN_METHOD_EXPORT
+void scaling_finalize(ScalingTest* test);
+
+EXTERN_METHOD_EXPORT
+InstanceScalingTest* instance_scaling_initialize(CORBA::Long total_instances, CORBA::Long samples_per_instance,
+  CORBA::ULongLong payload_size, CORBA::Boolean keep_all, DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+void instance_scaling_run(InstanceScalingTest* test);
+
+EXTERN_METHOD_EXPORT
+void instance_scaling_get_result(const InstanceScalingTest* test, InstanceScalingResult* result);
+
+EXTERN_METHOD_EXPORT
+void instance_scaling_finalize(InstanceScalingTest* test);
+
+EXTERN_METHOD_EXPORT
+SplitProcessTest* split_initialize(CORBA::Boolean driver, const char* topic_prefix, CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+void split_run_latency(SplitProcessTest* test, CORBA::Long total_samples);
+
+EXTERN_METHOD_EXPORT
+void* split_get_latencies(const SplitProcessTest* test);
+
+EXTERN_METHOD_EXPORT
+void* split_get_round_trips(const SplitProcessTest* test);
+
+EXTERN_METHOD_EXPORT
+CORBA::ULong split_run_throughput(SplitProcessTest* test, CORBA::Long total_samples);
+
+EXTERN_METHOD_EXPORT
+void split_run_peer(SplitProcessTest* test);
+
+EXTERN_METHOD_EXPORT
+void split_finalize(SplitProcessTest* test);
+
+EXTERN_METHOD_EXPORT
+WrapperOverheadTest* wrapper_overhead_initialize(CORBA::Long total_samples, CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+void wrapper_overhead_run(WrapperOverheadTest* test);
+
+EXTERN_METHOD_EXPORT
+void* wrapper_overhead_get_results(const WrapperOverheadTest* test);
+
+EXTERN_METHOD_EXPORT
+void wrapper_overhead_finalize(WrapperOverheadTest* test);
+
+EXTERN_METHOD_EXPORT
+DiscoveryTest* discovery_initialize(CORBA::Long domain_id, CORBA::Long role, CORBA::Long participants,
+  CORBA::Long endpoints_per_participant, CORBA::Long timeout_ms, const char* topic_prefix);
+
+EXTERN_METHOD_EXPORT
+void discovery_start(DiscoveryTest* test);
+
+EXTERN_METHOD_EXPORT
+void discovery_wait(DiscoveryTest* test);
+
+EXTERN_METHOD_EXPORT
+void discovery_get_result(const DiscoveryTest* test, DiscoveryResult* result);
+
+EXTERN_METHOD_EXPORT
+void discovery_finalize(DiscoveryTest* test);
+
+EXTERN_METHOD_EXPORT
+ShapeTest* shape_initialize(CORBA::Long shape, CORBA::ULongLong payload_size, DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+CORBA::ULong shape_run_throughput(ShapeTest* test, CORBA::Long total_samples);
+
+EXTERN_METHOD_EXPORT
+void shape_run_latency(ShapeTest* test, CORBA::Long total_samples);
+
+EXTERN_METHOD_EXPORT
+void* shape_get_latencies(const ShapeTest* test);
+
+EXTERN_METHOD_EXPORT
+CORBA::ULongLong shape_get_sample_size(const ShapeTest* test);
+
+EXTERN_METHOD_EXPORT
+void shape_finalize(ShapeTest* test);
+
+EXTERN_METHOD_EXPORT
+ReceiveStrategyTest* receive_strategy_initialize(CORBA::Long strategy, CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+void receive_strategy_run(ReceiveStrategyTest* test, CORBA::Long total_samples, double samples_per_second);
+
+EXTERN_METHOD_EXPORT
+void receive_strategy_get_result(const ReceiveStrategyTest* test, ReceiveStrategyResult* result);
+
+EXTERN_METHOD_EXPORT
+void receive_strategy_finalize(ReceiveStrategyTest* test);
+
+EXTERN_METHOD_EXPORT
+SustainedRateTest* sustained_rate_initialize(const SustainedRateConfig* config, CORBA::ULongLong payload_size,
+  DDS::DomainParticipant_ptr participant);
+
+EXTERN_METHOD_EXPORT
+void sustained_rate_run(SustainedRateTest* test, CORBA::Long total_samples, double samples_per_second);
+
+EXTERN_METHOD_EXPORT
+void sustained_rate_get_result(const SustainedRateTest* test, SustainedRateResult* result);
+
+EXTERN_METHOD_EXPORT
+void sustained_rate_finalize(SustainedRateTest* test);
@@ -0,0 +1,329 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "receive_strategy_test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ace/Profile_Timer.h>
+#include <dds/DCPS/LocalObject.h>
+
+namespace {
+  // Without progress for this long the run gives up, the result keeps the samples received so far.
+  const std::chrono::seconds IDLE_TIMEOUT(10);
+}
+
+/// DATA_AVAILABLE listener of the reader. With the thread dispatch it serializes the callbacks with a lock and runs
+/// the take in a new thread joined before returning, the same work the DataReaderListenerImpl of the wrapper does
+/// for every callback before the managed listener gets control.
+class ReceiveStrategyTest::Listener : public virtual OpenDDS::DCPS::LocalObject<DDS::DataReaderListener> {
+  ReceiveStrategyTest* test_;
+  bool dispatch_thread_;
+  std::mutex lock_;
+
+  void on_data() const {
+    ++this->test_->wakeups_;
+    this->test_->take_samples();
+
+    if (this->test_->samples_received_ >= this->test_->total_samples_) {
+      std::lock_guard<std::mutex> lock(this->test_->mtx_);
+      this->test_->cv_.notify_all();
+    }
+  }
+
+public:
+  Listener(ReceiveStrategyTest* test, const bool dispatch_thread) : test_(test), dispatch_thread_(dispatch_thread) { }
+
+  void on_data_available(DDS::DataReader_ptr) override {
+    if (!this->dispatch_thread_) {
+      this->on_data();
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->lock_);
+    std::thread thread([this] { this->on_data(); });
+    thread.join();
+  }
+
+  void on_requested_deadline_missed(DDS::DataReader_ptr, const DDS::RequestedDeadlineMissedStatus&) override { }
+  void on_requested_incompatible_qos(DDS::DataReader_ptr, const DDS::RequestedIncompatibleQosStatus&) override { }
+  void on_sample_rejected(DDS::DataReader_ptr, const DDS::SampleRejectedStatus&) override { }
+  void on_liveliness_changed(DDS::DataReader_ptr, const DDS::LivelinessChangedStatus&) override { }
+  void on_subscription_matched(DDS::DataReader_ptr, const DDS::SubscriptionMatchedStatus&) override { }
+  void on_sample_lost(DDS::DataReader_ptr, const DDS::SampleLostStatus&) override { }
+};
+
+void ReceiveStrategyTest::initialize(const ReceiveStrategy strategy, const CORBA::ULong payload_size,
+                                     DDS::DomainParticipant_ptr participant) {
+  if (strategy < RECEIVE_LISTENER || strategy >= RECEIVE_STRATEGY_COUNT) {
+    throw std::runtime_error("Unknown receive strategy.");
+  }
+
+  this->strategy_ = strategy;
+  this->participant_ = participant;
+
+  // The first bytes of the payload carry the send time.
+  const CORBA::ULong length = (std::max)(payload_size, static_cast<CORBA::ULong>(sizeof(CORBA::LongLong)));
+  this->sample_.KeyField = "1";
+  this->sample_.ValueField.length(length);
+
+  const auto data = random_bytes(length);
+  for (CORBA::ULong i = 0; i < length; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+  this->topic_ = create_topic(this->participant_);
+
+  this->writer_ = create_data_writer(this->publisher_, this->topic_);
+  this->data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_narrow(writer_);
+  this->reader_ = create_data_reader(this->subscriber_, this->topic_);
+  this->data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_narrow(reader_);
+
+  if (strategy == RECEIVE_LISTENER || strategy == RECEIVE_LISTENER_THREAD) {
+    this->listener_ = new Listener(this, strategy == RECEIVE_LISTENER_THREAD);
+    if (this->reader_->set_listener(this->listener_.in(), DDS::DATA_AVAILABLE_STATUS) != DDS::RETCODE_OK) {
+      throw std::runtime_error("set_listener failed.");
+    }
+  } else if (strategy == RECEIVE_WAITSET) {
+    this->status_condition_ = this->reader_->get_statuscondition();
+    this->status_condition_->set_enabled_statuses(DDS::DATA_AVAILABLE_STATUS);
+    this->wait_set_ = new DDS::WaitSet;
+    if (this->wait_set_->attach_condition(this->status_condition_) != DDS::RETCODE_OK) {
+      throw std::runtime_error("attach_condition failed.");
+    }
+  }
+
+  auto ret = writer_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+    throw std::runtime_error("writer enable failed.");
+  }
+
+  ret = reader_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+    throw std::runtime_error("reader enable failed.");
+  }
+
+  wait_for_publications(reader_, 1, 5000);
+  wait_for_subscriptions(writer_, 1, 5000);
+}
+
+void ReceiveStrategyTest::write_samples(const double samples_per_second) {
+  const auto interval = samples_per_second > 0.0
+    ? std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(1e9 / samples_per_second))
+    : std::chrono::nanoseconds::zero();
+  auto intended = std::chrono::steady_clock::now();
+
+  for (CORBA::ULong i = 0; i < this->total_samples_; ++i) {
+    if (interval.count() > 0) {
+      wait_until(intended);
+      intended += interval;
+    }
+
+    const CORBA::LongLong sent = steady_nanoseconds();
+    ACE_OS::memcpy(this->sample_.ValueField.get_buffer(), &sent, sizeof sent);
+
+    const auto ret = this->data_writer_->write(this->sample_, DDS::HANDLE_NIL);
+    if (ret != DDS::RETCODE_OK) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) Error writing sample %d.\n"), ret));
+      break;
+    }
+    ++this->result_.samples_written;
+  }
+}
+
+CORBA::ULong ReceiveStrategyTest::take_samples() {
+  OpenDDSNative::KeyedOctetsSeq samples;
+  DDS::SampleInfoSeq infos;
+  const auto ret = this->data_reader_->take(samples, infos, DDS::LENGTH_UNLIMITED, DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE,
+                                            DDS::ANY_INSTANCE_STATE);
+  if (ret != DDS::RETCODE_OK) {
+    return 0;
+  }
+
+  // The samples of a take reach the application together.
+  const CORBA::LongLong now = steady_nanoseconds();
+  CORBA::ULong count = 0;
+  for (CORBA::ULong i = 0; i < samples.length(); ++i) {
+    if (!infos[i].valid_data) {
+      continue;
+    }
+
+    CORBA::LongLong sent = 0;
+    ACE_OS::memcpy(&sent, samples[i].ValueField.get_buffer(), sizeof sent);
+    this->histogram_.record(now > sent ? static_cast<ACE_UINT64>(now - sent) : 0);
+    ++count;
+  }
+  this->data_reader_->return_loan(samples, infos);
+
+  this->samples_received_ += count;
+  return count;
+}
+
+void ReceiveStrategyTest::receive_listener() {
+  // The listener takes the samples, this thread only waits for the last one or the idle timeout.
+  std::unique_lock<std::mutex> lock(this->mtx_);
+  CORBA::ULong last = 0;
+  auto last_progress = std::chrono::steady_clock::now();
+  while (!this->cv_.wait_for(lock, std::chrono::seconds(1), [this] { return this->samples_received_ >= this->total_samples_; })) {
+    const CORBA::ULong received = this->samples_received_;
+    if (received != last) {
+      last = received;
+      last_progress = std::chrono::steady_clock::now();
+    } else if (std::chrono::steady_clock::now() - last_progress > IDLE_TIMEOUT) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: Timeout waiting for the listener samples.\n")));
+      break;
+    }
+  }
+}
+
+void ReceiveStrategyTest::receive_waitset() {
+  const DDS::Duration_t timeout = { static_cast<CORBA::Long>(IDLE_TIMEOUT.count()), 0 };
+  while (this->samples_received_ < this->total_samples_) {
+    DDS::ConditionSeq active_conditions;
+    if (this->wait_set_->wait(active_conditions, timeout) != DDS::RETCODE_OK) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: Timeout waiting for the WaitSet samples.\n")));
+      break;
+    }
+
+    ++this->wakeups_;
+    this->take_samples();
+  }
+}
+
+void ReceiveStrategyTest::receive_polling() {
+  auto last_progress = std::chrono::steady_clock::now();
+  while (this->samples_received_ < this->total_samples_) {
+    ++this->wakeups_;
+    if (this->take_samples() > 0) {
+      last_progress = std::chrono::steady_clock::now();
+    } else if (std::chrono::steady_clock::now() - last_progress > IDLE_TIMEOUT) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: Timeout polling for samples.\n")));
+      break;
+    }
+  }
+}
+
+void ReceiveStrategyTest::run(const CORBA::ULong total_samples, const double samples_per_second) {
+  this->total_samples_ = total_samples;
+  this->samples_received_ = 0;
+  this->wakeups_ = 0;
+  this->histogram_.reset();
+  this->result_ = {};
+
+  ACE_Profile_Timer timer;
+  timer.start();
+
+  std::thread writer_thread([this, samples_per_second] { this->write_samples(samples_per_second); });
+
+  switch (this->strategy_) {
+    case RECEIVE_LISTENER:
+    case RECEIVE_LISTENER_THREAD:
+      this->receive_listener();
+      break;
+    case RECEIVE_WAITSET:
+      this->receive_waitset();
+      break;
+    case RECEIVE_POLLING:
+      this->receive_polling();
+      break;
+    default:
+      break;
+  }
+
+  writer_thread.join();
+
+  timer.stop();
+  ACE_Profile_Timer::ACE_Elapsed_Time elapsed;
+  timer.elapsed_time(elapsed);
+  const double elapsed_ns = elapsed.real_time * 1e9;
+  const double cpu_ns = (elapsed.user_time + elapsed.system_time) * 1e9;
+
+  this->result_.strategy = this->strategy_;
+  this->result_.samples_received = this->samples_received_;
+  this->result_.wakeups = static_cast<CORBA::LongLong>(this->wakeups_.load());
+  this->result_.target_rate = samples_per_second;
+  this->result_.achieved_rate = elapsed_ns > 0 ? this->result_.samples_received * 1e9 / elapsed_ns : 0;
+  this->result_.cpu_ns_per_sample = this->result_.samples_received > 0 ? cpu_ns / this->result_.samples_received : 0;
+  this->result_.cpu_utilization = elapsed_ns > 0 ? cpu_ns / elapsed_ns : 0;
+
+  const ACE_UINT64 count = this->histogram_.count();
+  this->result_.latency_mean_ns = count > 0 ? static_cast<double>(this->histogram_.sum()) / static_cast<double>(count) : 0.0;
+  this->result_.latency_fifty_ns = this->histogram_.value_at_percentile(50.0);
+  this->result_.latency_ninety_ns = this->histogram_.value_at_percentile(90.0);
+  this->result_.latency_ninety_nine_ns = this->histogram_.value_at_percentile(99.0);
+  this->result_.latency_ninety_nine_nine_ns = this->histogram_.value_at_percentile(99.9);
+  this->result_.latency_max_ns = this->histogram_.maximum();
+}
+
+const ReceiveStrategyResult& ReceiveStrategyTest::result() const {
+  return this->result_;
+}
+
+void ReceiveStrategyTest::finalize() {
+  DDS::ReturnCode_t result = DDS::RETCODE_OK;
+  if (!CORBA::is_nil(this->listener_.in())) {
+    result = this->reader_->set_listener(DDS::DataReaderListener::_nil(), OpenDDS::DCPS::NO_STATUS_MASK);
+    if (result != DDS::RETCODE_OK) {
+      throw std::runtime_error("set_listener failed.");
+    }
+  }
+
+  if (this->wait_set_ != nullptr) {
+    result = this->status_condition_->set_enabled_statuses(OpenDDS::DCPS::NO_STATUS_MASK);
+    if (result != DDS::RETCODE_OK) {
+      throw std::runtime_error("set_enabled_statuses failed.");
+    }
+
+    result = this->wait_set_->detach_condition(this->status_condition_);
+    if (result != DDS::RETCODE_OK) {
+      throw std::runtime_error("detach_condition failed.");
+    }
+    CORBA::release(this->wait_set_);
+    this->wait_set_ = nullptr;
+  }
+
+  result = this->publisher_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->subscriber_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  result = this->participant_->delete_topic(this->topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+}
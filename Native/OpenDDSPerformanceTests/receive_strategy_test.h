@@ -0,0 +1,107 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include "utils.h"
+#include "../latency_histogram.h"
+
+/// How the ReceiveStrategyTest reader gets its samples.
+enum ReceiveStrategy : CORBA::Long {
+  // Take in on_data_available, on the transport thread that delivers the samples.
+  RECEIVE_LISTENER = 0,
+  // Take in on_data_available from a new thread joined by the callback, as the OpenDDSharp DataReaderListenerImpl
+  // dispatches to the managed listeners.
+  RECEIVE_LISTENER_THREAD = 1,
+  // Wait for the DATA_AVAILABLE status of the reader in a WaitSet, then take.
+  RECEIVE_WAITSET = 2,
+  // Call take in a tight loop, without waiting or yielding.
+  RECEIVE_POLLING = 3,
+  RECEIVE_STRATEGY_COUNT = 4
+};
+
+/// Measurements of a receive strategy run, the latencies are in nanoseconds.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct ReceiveStrategyResult {
+  CORBA::LongLong strategy;
+  CORBA::LongLong samples_written;
+  CORBA::LongLong samples_received;
+  // Listener callbacks, WaitSet wake ups or polling take calls.
+  CORBA::LongLong wakeups;
+  double target_rate;
+  double achieved_rate;
+  // CPU time of the whole process, writer and transport threads included, divided by the samples received.
+  double cpu_ns_per_sample;
+  // CPU time over wall time, 1.0 is one core busy during the whole run.
+  double cpu_utilization;
+  double latency_mean_ns;
+  CORBA::ULongLong latency_fifty_ns;
+  CORBA::ULongLong latency_ninety_ns;
+  CORBA::ULongLong latency_ninety_nine_ns;
+  CORBA::ULongLong latency_ninety_nine_nine_ns;
+  CORBA::ULongLong latency_max_ns;
+};
+
+/// Latency and CPU cost of a receive strategy at a fixed write rate, between a writer and a reader of the same
+/// participant. The writer stamps every sample with the steady clock just before writing it, the reader records the
+/// difference once the sample is taken, so the latency includes the dispatch to the code that takes the samples.
+/// Only the receive side changes between the strategies, the writer, the QoS and the transport are the same.
+class CLASS_EXPORT_FLAG ReceiveStrategyTest {
+
+  class Listener;
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  DDS::Topic_ptr topic_ = DDS::Topic::_nil();
+  DDS::WaitSet_ptr wait_set_ = nullptr;
+  DDS::StatusCondition_ptr status_condition_ = nullptr;
+  DDS::DataReaderListener_var listener_;
+  DDS::DataWriter_ptr writer_ = DDS::DataWriter::_nil();
+  DDS::DataReader_ptr reader_ = DDS::DataReader::_nil();
+  OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_nil();
+  OpenDDSNative::KeyedOctetsDataReader_ptr data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_nil();
+  OpenDDSNative::KeyedOctets sample_;
+
+  ReceiveStrategy strategy_ = RECEIVE_WAITSET;
+  latency_histogram histogram_;
+  ReceiveStrategyResult result_ {};
+
+  CORBA::ULong total_samples_ = 0;
+  std::atomic<CORBA::ULong> samples_received_ {0};
+  std::atomic<CORBA::ULongLong> wakeups_ {0};
+
+  std::mutex mtx_;
+  std::condition_variable cv_;
+
+  void write_samples(double samples_per_second);
+  CORBA::ULong take_samples();
+  void receive_listener();
+  void receive_waitset();
+  void receive_polling();
+
+public:
+  void initialize(ReceiveStrategy strategy, CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant);
+  void run(CORBA::ULong total_samples, double samples_per_second);
+  void finalize();
+  const ReceiveStrategyResult& result() const;
+};
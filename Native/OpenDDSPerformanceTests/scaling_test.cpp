@@ -0,0 +1,322 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "scaling_test.h"
+
+#include <algorithm>
+#include <ace/Profile_Timer.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+namespace {
+  // Best effort readers never get the lost samples, they give up once the writers are done and nothing arrived for a while.
+  const auto IDLE_TIMEOUT = std::chrono::seconds(2);
+  const DDS::Duration_t READ_WAIT_TIMEOUT = { 0, 100000000 };
+
+  void pin_thread(std::thread& thread, const unsigned int index) {
+    const unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+      return;
+    }
+
+#if defined(_WIN32)
+    SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(1) << (index % cores % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(index % cores, &cpu_set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof cpu_set, &cpu_set);
+#else
+    // No thread affinity API (e.g. macOS), the scheduler places the threads.
+    ACE_UNUSED_ARG(thread);
+    ACE_UNUSED_ARG(index);
+#endif
+  }
+}
+
+void ScalingTest::initialize(const ScalingConfig& config, DDS::DomainParticipant_ptr participant) {
+  if (config.writers <= 0 || config.readers <= 0 || config.topics <= 0 || config.instances <= 0) {
+    throw std::runtime_error("The writers, readers, topics and instances must be greater than zero.");
+  }
+
+  this->config_ = config;
+  this->participant_ = participant;
+
+  this->sample_.ValueField.length(config.payload_size);
+  const auto data = random_bytes(config.payload_size);
+  for (CORBA::ULong i = 0; i < config.payload_size; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+
+  const auto reliability = config.reliable ? DDS::RELIABLE_RELIABILITY_QOS : DDS::BEST_EFFORT_RELIABILITY_QOS;
+  const std::string prefix = random_string(16);
+  for (CORBA::Long t = 0; t < config.topics; ++t) {
+    DDS::Topic_ptr topic = create_topic(this->participant_, prefix + "_" + std::to_string(t));
+    this->topics_.push_back(topic);
+
+    for (CORBA::Long w = 0; w < config.writers; ++w) {
+      Writer writer;
+      writer.writer = create_data_writer(this->publisher_, topic, reliability);
+      writer.data_writer = OpenDDSNative::KeyedOctetsDataWriter::_narrow(writer.writer);
+      for (CORBA::Long i = 0; i < config.instances; ++i) {
+        writer.keys.push_back(std::to_string(w) + "_" + std::to_string(i));
+      }
+      this->writers_.push_back(writer);
+    }
+
+    for (CORBA::Long r = 0; r < config.readers; ++r) {
+      Reader reader;
+      reader.reader = create_data_reader(this->subscriber_, topic, reliability);
+      reader.data_reader = OpenDDSNative::KeyedOctetsDataReader::_narrow(reader.reader);
+      reader.topic = t;
+      reader.result.topic = t;
+      reader.result.reader = r;
+      reader.result.samples_expected = static_cast<CORBA::LongLong>(config.writers) * config.samples_per_writer;
+
+      reader.status_condition = reader.data_reader->get_statuscondition();
+      reader.status_condition->set_enabled_statuses(DDS::DATA_AVAILABLE_STATUS);
+      reader.wait_set = new DDS::WaitSet;
+      if (reader.wait_set->attach_condition(reader.status_condition) != DDS::RETCODE_OK) {
+        throw std::runtime_error("attach_condition failed.");
+      }
+      this->readers_.push_back(reader);
+    }
+  }
+
+  for (const auto& writer : this->writers_) {
+    if (writer.writer->enable() != DDS::RETCODE_OK) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+      throw std::runtime_error("writer enable failed.");
+    }
+  }
+
+  for (const auto& reader : this->readers_) {
+    if (reader.reader->enable() != DDS::RETCODE_OK) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+      throw std::runtime_error("reader enable failed.");
+    }
+  }
+
+  // Every reader matches the writers of its topic and every writer the readers of its topic.
+  const int discovery_timeout = 5000 + (100 * static_cast<int>(this->writers_.size() + this->readers_.size()));
+  for (const auto& reader : this->readers_) {
+    if (!wait_for_publications(reader.reader, config.writers, discovery_timeout)) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: reader of topic %d didn't match all the writers.\n"), reader.topic));
+    }
+  }
+
+  for (const auto& writer : this->writers_) {
+    if (!wait_for_subscriptions(writer.writer, config.readers, discovery_timeout)) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: writer didn't match all the readers.\n")));
+    }
+  }
+}
+
+void ScalingTest::write(const Writer& writer) {
+  // Each thread writes its own copy, the key changes on every write.
+  OpenDDSNative::KeyedOctets sample = this->sample_;
+  const auto instances = writer.keys.size();
+  for (CORBA::Long i = 0; i < this->config_.samples_per_writer; ++i) {
+    sample.KeyField = writer.keys[i % instances].c_str();
+    const auto ret = writer.data_writer->write(sample, DDS::HANDLE_NIL);
+    if (ret != DDS::RETCODE_OK) {
+      // The samples not written are reported as lost by the readers.
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) Error writing sample %d.\n"), ret));
+      break;
+    }
+    this->samples_sent_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void ScalingTest::read(Reader& reader, const std::chrono::steady_clock::time_point start) {
+  CORBA::LongLong received = 0;
+  auto last_sample = start;
+  auto last_activity = std::chrono::steady_clock::now();
+
+  while (received < reader.result.samples_expected) {
+    DDS::ConditionSeq active_conditions;
+    if (reader.wait_set->wait(active_conditions, READ_WAIT_TIMEOUT) == DDS::RETCODE_OK) {
+      OpenDDSNative::KeyedOctetsSeq samples;
+      DDS::SampleInfoSeq infos;
+      const auto ret = reader.data_reader->take(samples, infos, DDS::LENGTH_UNLIMITED,
+        DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+
+      if (ret == DDS::RETCODE_OK) {
+        for (CORBA::ULong i = 0; i < infos.length(); ++i) {
+          if (infos[i].valid_data) {
+            ++received;
+          }
+        }
+        reader.data_reader->return_loan(samples, infos);
+
+        last_sample = std::chrono::steady_clock::now();
+        last_activity = last_sample;
+        continue;
+      }
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!this->writers_done_.load(std::memory_order_acquire)) {
+      last_activity = now;
+    } else if (now - last_activity > IDLE_TIMEOUT) {
+      break;
+    }
+  }
+
+  const double seconds = std::chrono::duration<double>(last_sample - start).count();
+  reader.result.samples_received = received;
+  reader.result.seconds = seconds;
+  reader.result.samples_per_second = seconds > 0 ? static_cast<double>(received) / seconds : 0;
+  reader.result.loss_percentage = reader.result.samples_expected > 0
+    ? 100.0 * static_cast<double>(reader.result.samples_expected - received) / static_cast<double>(reader.result.samples_expected)
+    : 0;
+}
+
+void ScalingTest::run() {
+  this->writers_done_.store(false, std::memory_order_release);
+  this->samples_sent_.store(0, std::memory_order_relaxed);
+  this->result_ = ScalingResult {};
+
+  std::vector<std::thread> reader_threads;
+  std::vector<std::thread> writer_threads;
+  unsigned int core = 0;
+
+  ACE_Profile_Timer timer;
+  timer.start();
+  const auto start = std::chrono::steady_clock::now();
+
+  // Readers first, so they are already waiting when the first sample arrives.
+  for (auto& reader : this->readers_) {
+    reader_threads.emplace_back([this, &reader, start] { this->read(reader, start); });
+    if (this->config_.pin_threads) {
+      pin_thread(reader_threads.back(), core++);
+    }
+  }
+
+  for (const auto& writer : this->writers_) {
+    writer_threads.emplace_back([this, &writer] { this->write(writer); });
+    if (this->config_.pin_threads) {
+      pin_thread(writer_threads.back(), core++);
+    }
+  }
+
+  for (auto& thread : writer_threads) {
+    thread.join();
+  }
+  this->writers_done_.store(true, std::memory_order_release);
+
+  for (auto& thread : reader_threads) {
+    thread.join();
+  }
+
+  timer.stop();
+  ACE_Profile_Timer::ACE_Elapsed_Time elapsed;
+  timer.elapsed_time(elapsed);
+
+  // The run lasts until the last sample of the slowest reader, not until the idle timeout of the lossy ones.
+  double seconds = 0;
+  for (const auto& reader : this->readers_) {
+    this->result_.samples_expected += reader.result.samples_expected;
+    this->result_.samples_received += reader.result.samples_received;
+    seconds = (std::max)(seconds, reader.result.seconds);
+  }
+
+  this->result_.samples_sent = this->samples_sent_.load(std::memory_order_relaxed);
+  this->result_.seconds = seconds;
+  if (seconds > 0) {
+    this->result_.samples_per_second = static_cast<double>(this->result_.samples_received) / seconds;
+    this->result_.megabits_per_second = (static_cast<double>(this->result_.samples_received) * this->config_.payload_size * 8.0) / (seconds * 1000000.0);
+  }
+  if (this->result_.samples_expected > 0) {
+    this->result_.loss_percentage = 100.0 * static_cast<double>(this->result_.samples_expected - this->result_.samples_received) /
+                                    static_cast<double>(this->result_.samples_expected);
+  }
+
+  this->result_.cpu_user_seconds = elapsed.user_time;
+  this->result_.cpu_system_seconds = elapsed.system_time;
+  if (elapsed.real_time > 0) {
+    this->result_.cpu_cores = (elapsed.user_time + elapsed.system_time) / elapsed.real_time;
+  }
+}
+
+const ScalingResult& ScalingTest::result() const {
+  return this->result_;
+}
+
+void* ScalingTest::get_readers() const {
+  const auto length = static_cast<ACE_UINT32>(this->readers_.size());
+  const size_t struct_size = sizeof(ScalingReaderResult);
+  const size_t buffer_size = (length * struct_size) + sizeof length;
+
+  // Same layout as the sequences marshalled by the wrapper: the length followed by the structures.
+  char* bytes = static_cast<char*>(ACE_OS::malloc(buffer_size));
+  ACE_OS::memcpy(bytes, &length, sizeof length);
+  for (ACE_UINT32 i = 0; i < length; i++) {
+    ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &this->readers_[i].result, struct_size);
+  }
+
+  return bytes;
+}
+
+void ScalingTest::finalize() {
+  for (auto& reader : this->readers_) {
+    reader.status_condition->set_enabled_statuses(OpenDDS::DCPS::NO_STATUS_MASK);
+    if (reader.wait_set->detach_condition(reader.status_condition) != DDS::RETCODE_OK) {
+      throw std::runtime_error("detach_condition failed.");
+    }
+    CORBA::release(reader.wait_set);
+    reader.wait_set = nullptr;
+  }
+
+  DDS::ReturnCode_t result = this->publisher_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->subscriber_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  for (DDS::Topic_ptr topic : this->topics_) {
+    result = this->participant_->delete_topic(topic);
+    if (result != DDS::RETCODE_OK) {
+      throw std::runtime_error("delete_topic failed.");
+    }
+  }
+
+  this->writers_.clear();
+  this->readers_.clear();
+  this->topics_.clear();
+}
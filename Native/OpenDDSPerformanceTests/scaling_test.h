@@ -0,0 +1,109 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "utils.h"
+
+/// Shape of a scaling run. The writer and reader counts are per topic, so 1 writer and N readers is a fan-out,
+/// N writers and 1 reader a fan-in, and every topic repeats the same topology in the same participant.
+struct ScalingConfig {
+  CORBA::Long writers;
+  CORBA::Long readers;
+  CORBA::Long topics;
+  CORBA::Long instances;
+  CORBA::Long samples_per_writer;
+  CORBA::ULong payload_size;
+  bool reliable;
+  bool pin_threads;
+};
+
+/// Aggregate measurements of a scaling run. Every member is 8 bytes wide so the layout is the same in the managed side.
+struct ScalingResult {
+  CORBA::LongLong samples_sent;
+  CORBA::LongLong samples_expected;
+  CORBA::LongLong samples_received;
+  double seconds;
+  double samples_per_second;
+  double megabits_per_second;
+  double loss_percentage;
+  double cpu_user_seconds;
+  double cpu_system_seconds;
+  // Process CPU time over the wall time, i.e. the average number of busy cores.
+  double cpu_cores;
+};
+
+/// Measurements of a single reader.
+struct ScalingReaderResult {
+  CORBA::LongLong topic;
+  CORBA::LongLong reader;
+  CORBA::LongLong samples_expected;
+  CORBA::LongLong samples_received;
+  double loss_percentage;
+  // From the start of the run to the last sample received.
+  double seconds;
+  double samples_per_second;
+};
+
+/// Fan-out/fan-in scaling test. Every writer and every reader runs in its own thread, optionally pinned to the
+/// cores in round robin, and the readers wait in their own wait set, so the aggregate throughput shows where
+/// OpenDDS and the wrapper stop scaling with the number of entities.
+class CLASS_EXPORT_FLAG ScalingTest {
+
+  struct Writer {
+    DDS::DataWriter_ptr writer = DDS::DataWriter::_nil();
+    OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer = OpenDDSNative::KeyedOctetsDataWriter::_nil();
+    std::vector<std::string> keys;
+  };
+
+  struct Reader {
+    DDS::DataReader_ptr reader = DDS::DataReader::_nil();
+    OpenDDSNative::KeyedOctetsDataReader_ptr data_reader = OpenDDSNative::KeyedOctetsDataReader::_nil();
+    DDS::StatusCondition_ptr status_condition = nullptr;
+    DDS::WaitSet_ptr wait_set = nullptr;
+    CORBA::Long topic = 0;
+    ScalingReaderResult result {};
+  };
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  std::vector<DDS::Topic_ptr> topics_;
+  std::vector<Writer> writers_;
+  std::vector<Reader> readers_;
+  OpenDDSNative::KeyedOctets sample_;
+  ScalingConfig config_ {};
+  ScalingResult result_ {};
+  std::atomic<bool> writers_done_ {false};
+  std::atomic<CORBA::LongLong> samples_sent_ {0};
+
+  void write(const Writer& writer);
+  void read(Reader& reader, std::chrono::steady_clock::time_point start);
+
+public:
+  void initialize(const ScalingConfig& config, DDS::DomainParticipant_ptr participant);
+  void run();
+  void finalize();
+  const ScalingResult& result() const;
+  void* get_readers() const;
+};
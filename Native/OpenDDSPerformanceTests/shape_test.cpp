@@ -0,0 +1,318 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "shape_test.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <dds/DCPS/Serializer.h>
+
+namespace {
+  const CORBA::ULong CONFIG_ENTRIES_PER_SECTION = 8;
+  // Approximate XCDR2 size of a config section with its entries.
+  const CORBA::ULong CONFIG_SECTION_SIZE = 600;
+
+  CORBA::LongLong now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  }
+
+  void fill_sample(OpenDDSNative::KeyedOctets& sample, const CORBA::ULong payload_size) {
+    sample.KeyField = "1";
+    sample.ValueField.length(payload_size);
+
+    const auto data = random_bytes(payload_size);
+    for (CORBA::ULong i = 0; i < payload_size; ++i) {
+      sample.ValueField[i] = data[i];
+    }
+  }
+
+  void fill_sample(OpenDDSNative::MarketTick& sample, CORBA::ULong) {
+    sample.Symbol = "EURUSD";
+    sample.Venue = 1;
+    sample.Side = OpenDDSNative::TICK_TRADE;
+    sample.Price = 1.08425;
+    sample.Quantity = 1000000.0;
+    sample.ExchangeTimestamp = now_ns();
+    sample.SequenceNumber = 1;
+    sample.Currency = "USD";
+  }
+
+  void fill_sample(OpenDDSNative::TelemetryFrame& sample, const CORBA::ULong payload_size) {
+    sample.DeviceId = 1;
+    sample.Stream = 1;
+    sample.Timestamp = static_cast<CORBA::ULongLong>(now_ns());
+
+    const CORBA::ULong channels = sizeof sample.Channels / sizeof sample.Channels[0];
+    for (CORBA::ULong i = 0; i < channels; ++i) {
+      OpenDDSNative::TelemetryChannel& channel = sample.Channels[i];
+      channel.Id = static_cast<CORBA::UShort>(i);
+      channel.Value = static_cast<CORBA::Float>(i) * 1.5f;
+      channel.Minimum = -100.0f;
+      channel.Maximum = 100.0f;
+      channel.Valid = true;
+    }
+
+    const CORBA::ULong count = payload_size / sizeof(CORBA::Float);
+    sample.Samples.length(count);
+    for (CORBA::ULong i = 0; i < count; ++i) {
+      sample.Samples[i] = static_cast<CORBA::Float>(i % 1000) * 0.25f;
+    }
+  }
+
+  void fill_sample(OpenDDSNative::ConfigRecord& sample, const CORBA::ULong payload_size) {
+    sample.Application = "order-gateway";
+    sample.Deployment = "production";
+    sample.Revision = 1;
+
+    const char* tags[] = { "trading", "eu-west", "critical", "v2" };
+    sample.Tags.length(sizeof tags / sizeof tags[0]);
+    for (CORBA::ULong i = 0; i < sample.Tags.length(); ++i) {
+      sample.Tags[i] = tags[i];
+    }
+
+    const CORBA::ULong sections = (std::max)(payload_size / CONFIG_SECTION_SIZE, static_cast<CORBA::ULong>(1));
+    sample.Sections.length(sections);
+    for (CORBA::ULong s = 0; s < sections; ++s) {
+      OpenDDSNative::ConfigSection& section = sample.Sections[s];
+      section.Name = ("section_" + std::to_string(s)).c_str();
+      section.Owner.Team = "platform";
+      section.Owner.Contact = "platform-oncall@example.com";
+
+      section.Entries.length(CONFIG_ENTRIES_PER_SECTION);
+      for (CORBA::ULong e = 0; e < CONFIG_ENTRIES_PER_SECTION; ++e) {
+        OpenDDSNative::ConfigEntry& entry = section.Entries[e];
+        entry.Name = random_string(16).c_str();
+        entry.Kind = static_cast<OpenDDSNative::ConfigValueKind>(e % 3);
+        entry.Value = random_string(32).c_str();
+      }
+    }
+  }
+}
+
+template <typename Sample>
+class ShapeTest::TypedChannel : public ShapeTest::Channel {
+
+  typedef OpenDDS::DCPS::DDSTraits<Sample> Traits;
+  typedef typename Traits::DataWriterType DataWriter;
+  typedef typename Traits::DataReaderType DataReader;
+  typedef typename Traits::MessageSequenceType SampleSeq;
+
+  typename DataWriter::_var_type data_writer_;
+  typename DataReader::_var_type data_reader_;
+  Sample sample_;
+
+public:
+  TypedChannel(DDS::DataWriter_ptr writer, DDS::DataReader_ptr reader, const CORBA::ULong payload_size)
+    : data_writer_(DataWriter::_narrow(writer)), data_reader_(DataReader::_narrow(reader)) {
+    fill_sample(this->sample_, payload_size);
+  }
+
+  DDS::ReturnCode_t write() override {
+    return this->data_writer_->write(this->sample_, DDS::HANDLE_NIL);
+  }
+
+  CORBA::ULong take() override {
+    SampleSeq samples;
+    DDS::SampleInfoSeq infos;
+
+    const auto ret = this->data_reader_->take(samples, infos, DDS::LENGTH_UNLIMITED,
+      DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+    if (ret != DDS::RETCODE_OK) {
+      return 0;
+    }
+
+    const CORBA::ULong taken = samples.length();
+    this->data_reader_->return_loan(samples, infos);
+
+    return taken;
+  }
+
+  size_t sample_size() const override {
+    const OpenDDS::DCPS::Encoding encoding(OpenDDS::DCPS::Encoding::KIND_XCDR2);
+    return OpenDDS::DCPS::serialized_size(encoding, this->sample_);
+  }
+};
+
+template <typename Sample>
+void ShapeTest::create_entities(const CORBA::ULong payload_size) {
+  typedef typename OpenDDS::DCPS::DDSTraits<Sample>::TypeSupportImplType TypeSupportImpl;
+
+  const DDS::TypeSupport_var type_support = new TypeSupportImpl;
+  this->topic_ = create_topic(this->participant_, random_string(16), type_support);
+  this->writer_ = create_data_writer(this->publisher_, this->topic_);
+  this->reader_ = create_data_reader(this->subscriber_, this->topic_);
+  this->channel_.reset(new TypedChannel<Sample>(this->writer_, this->reader_, payload_size));
+}
+
+void ShapeTest::initialize(const TypeShape shape, const CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant) {
+  this->participant_ = participant;
+
+  // Initialize the Publisher and Subscriber entities
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+
+  // Initialize the Topic, DataWriter and DataReader entities of the shape
+  switch (shape) {
+    case SHAPE_KEYED_OCTETS:
+      this->create_entities<OpenDDSNative::KeyedOctets>(payload_size);
+      break;
+    case SHAPE_MARKET_TICK:
+      this->create_entities<OpenDDSNative::MarketTick>(payload_size);
+      break;
+    case SHAPE_TELEMETRY_FRAME:
+      this->create_entities<OpenDDSNative::TelemetryFrame>(payload_size);
+      break;
+    case SHAPE_CONFIG_RECORD:
+      this->create_entities<OpenDDSNative::ConfigRecord>(payload_size);
+      break;
+    default:
+      throw std::runtime_error("Unknown type shape.");
+  }
+
+  // Initialize waitset and status condition
+  this->status_condition_ = this->reader_->get_statuscondition();
+  this->status_condition_->set_enabled_statuses(DDS::DATA_AVAILABLE_STATUS);
+  this->wait_set_ = new DDS::WaitSet;
+  if (this->wait_set_->attach_condition(this->status_condition_) != DDS::RETCODE_OK) {
+    throw std::runtime_error("attach_condition failed.");
+  }
+
+  // Enable the entities and wait for discovery
+  auto ret = this->writer_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+    throw std::runtime_error("writer enable failed.");
+  }
+
+  ret = this->reader_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+    throw std::runtime_error("reader enable failed.");
+  }
+
+  if (!wait_for_publications(this->reader_, 1, 5000)) {
+    throw std::runtime_error("wait_for_publications failed.");
+  }
+
+  if (!wait_for_subscriptions(this->writer_, 1, 5000)) {
+    throw std::runtime_error("wait_for_subscriptions failed.");
+  }
+}
+
+bool ShapeTest::wait_samples() const {
+  DDS::ConditionSeq active_conditions;
+  const DDS::Duration_t timeout = { 10, 0 };
+  return this->wait_set_->wait(active_conditions, timeout) == DDS::RETCODE_OK;
+}
+
+CORBA::ULong ShapeTest::run_throughput(const CORBA::ULong total_samples) {
+  std::thread writer_thread([this, total_samples] {
+    for (CORBA::ULong i = 0; i < total_samples; ++i) {
+      this->channel_->write();
+    }
+  });
+
+  CORBA::ULong received = 0;
+  while (received < total_samples && this->wait_samples()) {
+    received += this->channel_->take();
+  }
+
+  writer_thread.join();
+
+  return received;
+}
+
+void ShapeTest::run_latency(const CORBA::ULong total_samples) {
+  this->latencies_.clear();
+  this->latencies_.reserve(total_samples);
+
+  for (CORBA::ULong i = 0; i < total_samples; ++i) {
+    const auto t_start = std::chrono::steady_clock::now();
+    if (this->channel_->write() != DDS::RETCODE_OK) {
+      throw std::runtime_error("Error writing sample.");
+    }
+
+    CORBA::ULong taken = 0;
+    while (taken == 0) {
+      if (!this->wait_samples()) {
+        throw std::runtime_error("Timeout waiting for samples.");
+      }
+      taken = this->channel_->take();
+    }
+
+    const auto t_end = std::chrono::steady_clock::now();
+    this->latencies_.push_back(std::chrono::duration<double, std::milli>(t_end - t_start).count());
+  }
+}
+
+void* ShapeTest::get_latencies() const {
+  return serialize_latencies(this->latencies_);
+}
+
+CORBA::ULongLong ShapeTest::sample_size() const {
+  return this->channel_->sample_size();
+}
+
+void ShapeTest::finalize() {
+  // The typed writer and reader references go first.
+  this->channel_.reset();
+
+  DDS::ReturnCode_t result = this->status_condition_->set_enabled_statuses(OpenDDS::DCPS::NO_STATUS_MASK);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("set_enabled_statuses failed.");
+  }
+
+  result = this->wait_set_->detach_condition(this->status_condition_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("detach_condition failed.");
+  }
+  CORBA::release(this->wait_set_);
+  this->wait_set_ = nullptr;
+
+  result = this->publisher_->delete_datawriter(this->writer_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_datawriter failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->reader_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->subscriber_->delete_datareader(this->reader_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_datareader failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  result = this->participant_->delete_topic(this->topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+}
@@ -0,0 +1,79 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "utils.h"
+
+/// The TestData topic types measured by the ShapeTest.
+enum TypeShape : CORBA::Long {
+  // String key and an octet sequence of the payload size, the best case for the serializers.
+  SHAPE_KEYED_OCTETS = 0,
+  // Small fixed-size record with a multi-field key and an enum, the payload size is ignored.
+  SHAPE_MARKET_TICK = 1,
+  // Array of 16 structs plus a float sequence filling the payload size.
+  SHAPE_TELEMETRY_FRAME = 2,
+  // Nested string-heavy record, with as many sections of 8 entries as needed to fill the payload size.
+  SHAPE_CONFIG_RECORD = 3,
+  SHAPE_COUNT = 4
+};
+
+/// Throughput and latency of one TestData type between a writer and a reader of the same participant.
+/// The types only differ in their sample, the DDS entities and the QoS are the ones of the ThroughputTest
+/// and the LatencyTest, so the difference between the shapes is the cost of their serialization.
+class CLASS_EXPORT_FLAG ShapeTest {
+
+  /// Typed writer and reader of the shape under test.
+  struct Channel {
+    virtual ~Channel() = default;
+    virtual DDS::ReturnCode_t write() = 0;
+    virtual CORBA::ULong take() = 0;
+    virtual size_t sample_size() const = 0;
+  };
+
+  template <typename Sample>
+  class TypedChannel;
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  DDS::Topic_ptr topic_ = DDS::Topic::_nil();
+  DDS::WaitSet_ptr wait_set_ = nullptr;
+  DDS::StatusCondition_ptr status_condition_ = nullptr;
+  DDS::DataWriter_ptr writer_ = DDS::DataWriter::_nil();
+  DDS::DataReader_ptr reader_ = DDS::DataReader::_nil();
+  std::unique_ptr<Channel> channel_;
+  std::vector<double> latencies_;
+
+  template <typename Sample>
+  void create_entities(CORBA::ULong payload_size);
+
+  bool wait_samples() const;
+
+public:
+  void initialize(TypeShape shape, CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant);
+  CORBA::ULong run_throughput(CORBA::ULong total_samples);
+  void run_latency(CORBA::ULong total_samples);
+  void finalize();
+  void* get_latencies() const;
+  /// XCDR2 size of the sample, the bytes actually serialized for the requested payload size.
+  CORBA::ULongLong sample_size() const;
+};
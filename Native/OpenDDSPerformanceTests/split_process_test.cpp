@@ -0,0 +1,305 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "split_process_test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace {
+  const char* const LATENCY_KEY = "ping";
+  const char* const DATA_KEY = "data";
+  const char* const FLUSH_KEY = "flush";
+  const char* const COUNT_KEY = "count";
+  const char* const STOP_KEY = "stop";
+
+  // Layout of the timestamps at the start of the ping payload, in steady clock nanoseconds:
+  // driver send, peer receive and peer send.
+  const CORBA::ULong PING_SENT = 0;
+  const CORBA::ULong ECHO_RECEIVED = 1;
+  const CORBA::ULong ECHO_SENT = 2;
+  const CORBA::ULong TIMESTAMP_COUNT = 3;
+
+  void set_timestamp(OpenDDSNative::KeyedOctets& sample, const CORBA::ULong index, const CORBA::LongLong value) {
+    ACE_OS::memcpy(sample.ValueField.get_buffer() + (index * sizeof value), &value, sizeof value);
+  }
+
+  CORBA::LongLong get_timestamp(const OpenDDSNative::KeyedOctets& sample, const CORBA::ULong index) {
+    CORBA::LongLong value = 0;
+    ACE_OS::memcpy(&value, sample.ValueField.get_buffer() + (index * sizeof value), sizeof value);
+    return value;
+  }
+}
+
+void SplitProcessTest::initialize(const bool driver, const std::string& topic_prefix, const CORBA::ULong payload_size,
+                                  DDS::DomainParticipant_ptr participant) {
+  this->driver_ = driver;
+  this->participant_ = participant;
+
+  // The payload must be large enough to carry the ping timestamps.
+  const CORBA::ULong length = std::max<CORBA::ULong>(payload_size, TIMESTAMP_COUNT * sizeof(CORBA::LongLong));
+  this->sample_.ValueField.length(length);
+  const auto data = random_bytes(length);
+  for (CORBA::ULong i = 0; i < length; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+  this->ping_topic_ = create_topic(this->participant_, topic_prefix + "_ping");
+  this->pong_topic_ = create_topic(this->participant_, topic_prefix + "_pong");
+
+  // The driver writes pings and reads pongs, the peer does the opposite.
+  this->writer_ = create_data_writer(this->publisher_, driver ? this->ping_topic_ : this->pong_topic_);
+  this->data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_narrow(this->writer_);
+  this->reader_ = create_data_reader(this->subscriber_, driver ? this->pong_topic_ : this->ping_topic_);
+  this->data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_narrow(this->reader_);
+
+  this->status_condition_ = this->data_reader_->get_statuscondition();
+  this->status_condition_->set_enabled_statuses(DDS::DATA_AVAILABLE_STATUS);
+  this->wait_set_ = new DDS::WaitSet;
+  if (this->wait_set_->attach_condition(this->status_condition_) != DDS::RETCODE_OK) {
+    throw std::runtime_error("attach_condition failed.");
+  }
+
+  if (this->writer_->enable() != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+    throw std::runtime_error("writer enable failed.");
+  }
+
+  if (this->reader_->enable() != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+    throw std::runtime_error("reader enable failed.");
+  }
+
+  // The other process may take a while to start, give discovery more time than the single process tests.
+  if (!wait_for_publications(this->reader_, 1, 30000)) {
+    throw std::runtime_error("wait_for_publications failed.");
+  }
+
+  if (!wait_for_subscriptions(this->writer_, 1, 30000)) {
+    throw std::runtime_error("wait_for_subscriptions failed.");
+  }
+}
+
+void SplitProcessTest::write(const char* key) {
+  this->sample_.KeyField = key;
+
+  const auto ret = this->data_writer_->write(this->sample_, DDS::HANDLE_NIL);
+  if (ret != DDS::RETCODE_OK) {
+    std::cout << "Error writing sample " << ret << std::endl;
+    throw std::runtime_error("Error writing sample.");
+  }
+}
+
+bool SplitProcessTest::wait_samples(const std::function<void(const OpenDDSNative::KeyedOctets&)>& handler, const int seconds) {
+  while (true) {
+    DDS::ConditionSeq active_conditions;
+    const DDS::Duration_t duration = { seconds, 0 };
+    if (this->wait_set_->wait(active_conditions, duration) != DDS::RETCODE_OK) {
+      return false;
+    }
+
+    OpenDDSNative::KeyedOctetsSeq samples;
+    DDS::SampleInfoSeq infos;
+    const auto ret = this->data_reader_->take(samples, infos, DDS::LENGTH_UNLIMITED,
+      DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+    if (ret != DDS::RETCODE_OK) {
+      continue;
+    }
+
+    for (CORBA::ULong i = 0; i < samples.length(); ++i) {
+      if (infos[i].valid_data) {
+        handler(samples[i]);
+      }
+    }
+    this->data_reader_->return_loan(samples, infos);
+
+    return true;
+  }
+}
+
+void SplitProcessTest::echo(const OpenDDSNative::KeyedOctets& ping, const CORBA::LongLong received) {
+  OpenDDSNative::KeyedOctets pong(ping);
+  if (pong.ValueField.length() >= TIMESTAMP_COUNT * sizeof(CORBA::LongLong)) {
+    set_timestamp(pong, ECHO_RECEIVED, received);
+    set_timestamp(pong, ECHO_SENT, steady_nanoseconds());
+  }
+
+  const auto ret = this->data_writer_->write(pong, DDS::HANDLE_NIL);
+  if (ret != DDS::RETCODE_OK) {
+    std::cout << "Error writing sample " << ret << std::endl;
+    throw std::runtime_error("Error writing sample.");
+  }
+}
+
+void SplitProcessTest::run_latency(const CORBA::ULong total_samples) {
+  this->latencies_.clear();
+  this->latencies_.reserve(total_samples);
+  this->round_trips_.clear();
+  this->round_trips_.reserve(total_samples);
+
+  for (CORBA::ULong i = 0; i < total_samples; ++i) {
+    const CORBA::LongLong sent = steady_nanoseconds();
+    set_timestamp(this->sample_, PING_SENT, sent);
+
+    this->write(LATENCY_KEY);
+
+    CORBA::LongLong turnaround = 0;
+    bool answered = false;
+    while (!answered) {
+      const bool ok = this->wait_samples([sent, &turnaround, &answered](const OpenDDSNative::KeyedOctets& pong) {
+        // Late answers of a previous ping that timed out are discarded.
+        if (get_timestamp(pong, PING_SENT) == sent) {
+          turnaround = get_timestamp(pong, ECHO_SENT) - get_timestamp(pong, ECHO_RECEIVED);
+          answered = true;
+        }
+      }, 10);
+
+      if (!ok) {
+        throw std::runtime_error("Timeout waiting for the peer answer.");
+      }
+    }
+
+    const CORBA::LongLong round_trip = steady_nanoseconds() - sent;
+
+    // The one-way estimate is half of the round trip without the peer turnaround, both
+    // differences are taken in a single process so the clocks don't need to be synchronized.
+    this->round_trips_.push_back(static_cast<double>(round_trip) / 1e6);
+    this->latencies_.push_back(static_cast<double>(std::max<CORBA::LongLong>(round_trip - turnaround, 0)) / 2e6);
+  }
+}
+
+CORBA::ULong SplitProcessTest::run_throughput(const CORBA::ULong total_samples) {
+  for (CORBA::ULong i = 0; i < total_samples; ++i) {
+    this->write(DATA_KEY);
+  }
+
+  // Samples of the same writer are delivered in order, so the flush arrives after all the data.
+  this->write(FLUSH_KEY);
+
+  bool answered = false;
+  CORBA::ULong received = 0;
+  while (!answered) {
+    const bool ok = this->wait_samples([&answered, &received](const OpenDDSNative::KeyedOctets& sample) {
+      if (std::string(sample.KeyField.in()) == COUNT_KEY && sample.ValueField.length() >= sizeof received) {
+        ACE_OS::memcpy(&received, sample.ValueField.get_buffer(), sizeof received);
+        answered = true;
+      }
+    }, 60);
+
+    if (!ok) {
+      throw std::runtime_error("Timeout waiting for the peer count.");
+    }
+  }
+
+  return received;
+}
+
+void SplitProcessTest::run_peer() {
+  CORBA::ULong received = 0;
+  bool stop = false;
+
+  while (!stop) {
+    const bool ok = this->wait_samples([this, &received, &stop](const OpenDDSNative::KeyedOctets& sample) {
+      const std::string key = sample.KeyField.in();
+      if (key == LATENCY_KEY) {
+        this->echo(sample, steady_nanoseconds());
+      } else if (key == DATA_KEY) {
+        ++received;
+      } else if (key == FLUSH_KEY) {
+        OpenDDSNative::KeyedOctets count;
+        count.KeyField = COUNT_KEY;
+        count.ValueField.length(sizeof received);
+        ACE_OS::memcpy(count.ValueField.get_buffer(), &received, sizeof received);
+        const auto ret = this->data_writer_->write(count, DDS::HANDLE_NIL);
+        if (ret != DDS::RETCODE_OK) {
+          std::cout << "Error writing sample " << ret << std::endl;
+          throw std::runtime_error("Error writing sample.");
+        }
+        received = 0;
+      } else if (key == STOP_KEY) {
+        stop = true;
+      }
+    }, 60);
+
+    if (!ok) {
+      std::cout << "Peer timeout waiting for the driver." << std::endl;
+      return;
+    }
+  }
+}
+
+void SplitProcessTest::stop_peer() {
+  if (this->driver_) {
+    this->write(STOP_KEY);
+    this->data_writer_->wait_for_acknowledgments({ 5, 0 });
+  }
+}
+
+void SplitProcessTest::finalize() const {
+  DDS::ReturnCode_t result = this->status_condition_->set_enabled_statuses(OpenDDS::DCPS::NO_STATUS_MASK);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("set_enabled_statuses failed.");
+  }
+
+  result = this->wait_set_->detach_condition(this->status_condition_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("detach_condition failed.");
+  }
+
+  result = this->publisher_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->subscriber_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  result = this->participant_->delete_topic(this->ping_topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+
+  result = this->participant_->delete_topic(this->pong_topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+}
+
+void* SplitProcessTest::get_latencies() const {
+  return serialize_latencies(this->latencies_);
+}
+
+void* SplitProcessTest::get_round_trips() const {
+  return serialize_latencies(this->round_trips_);
+}
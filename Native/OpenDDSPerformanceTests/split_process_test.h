@@ -0,0 +1,63 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "utils.h"
+
+/// Latency and throughput test between two participants living in separate local processes.
+/// The driver publishes in the "<prefix>_ping" topic and the peer answers in the "<prefix>_pong" topic,
+/// so the transport under test (e.g. shmem or rtps_udp loopback) is crossed in both directions.
+/// The peer echoes each ping with its receive and send times, so the driver can remove the peer turnaround
+/// from the round trip and estimate the one-way latency without synchronized clocks.
+class CLASS_EXPORT_FLAG SplitProcessTest {
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  DDS::Topic_ptr ping_topic_ = DDS::Topic::_nil();
+  DDS::Topic_ptr pong_topic_ = DDS::Topic::_nil();
+  DDS::WaitSet_ptr wait_set_ = nullptr;
+  DDS::StatusCondition_ptr status_condition_ = nullptr;
+  DDS::DataWriter_ptr writer_ = DDS::DataWriter::_nil();
+  DDS::DataReader_ptr reader_ = DDS::DataReader::_nil();
+  OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_nil();
+  OpenDDSNative::KeyedOctetsDataReader_ptr data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_nil();
+  OpenDDSNative::KeyedOctets sample_;
+  std::vector<double> latencies_;
+  std::vector<double> round_trips_;
+  bool driver_ = false;
+
+  void write(const char* key);
+  void echo(const OpenDDSNative::KeyedOctets& ping, CORBA::LongLong received);
+  bool wait_samples(const std::function<void(const OpenDDSNative::KeyedOctets&)>& handler, int seconds);
+
+public:
+  void initialize(bool driver, const std::string& topic_prefix, CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant);
+  void run_latency(CORBA::ULong total_samples);
+  CORBA::ULong run_throughput(CORBA::ULong total_samples);
+  void run_peer();
+  void stop_peer();
+  void finalize() const;
+  void* get_latencies() const;
+  void* get_round_trips() const;
+};
@@ -0,0 +1,298 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "sustained_rate_test.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+  // Once the writer is done, the reader stops after this long without samples, the missing ones are not coming.
+  const std::chrono::seconds DRAIN_TIMEOUT(2);
+
+  double milliseconds(const std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  }
+}
+
+void SustainedRateTest::initialize(const SustainedRateConfig& config, const CORBA::ULong payload_size,
+                                   DDS::DomainParticipant_ptr participant) {
+  if (config.depth < 1) {
+    throw std::runtime_error("The history depth must be at least one.");
+  }
+
+  this->config_ = config;
+  this->participant_ = participant;
+
+  // The first bytes of the payload carry the send time.
+  const CORBA::ULong length = (std::max)(payload_size, static_cast<CORBA::ULong>(sizeof(CORBA::LongLong)));
+  this->sample_.KeyField = "1";
+  this->sample_.ValueField.length(length);
+
+  const auto data = random_bytes(length);
+  for (CORBA::ULong i = 0; i < length; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+  this->topic_ = create_topic(this->participant_);
+
+  const auto reliability = config.reliable ? DDS::RELIABLE_RELIABILITY_QOS : DDS::BEST_EFFORT_RELIABILITY_QOS;
+  const auto history = config.keep_all ? DDS::KEEP_ALL_HISTORY_QOS : DDS::KEEP_LAST_HISTORY_QOS;
+  const auto depth = static_cast<CORBA::Long>(config.depth);
+
+  // The entities are not enabled yet, so the history and the resource limits can still change.
+  this->writer_ = create_data_writer(this->publisher_, this->topic_, reliability);
+  this->data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_narrow(writer_);
+
+  DDS::DataWriterQos dw_qos;
+  this->data_writer_->get_qos(dw_qos);
+  dw_qos.history.kind = history;
+  dw_qos.history.depth = depth;
+  dw_qos.reliability.max_blocking_time.sec = static_cast<CORBA::Long>(config.max_blocking_ms / 1000);
+  dw_qos.reliability.max_blocking_time.nanosec = static_cast<CORBA::ULong>(config.max_blocking_ms % 1000) * 1000000;
+  if (config.keep_all) {
+    dw_qos.resource_limits.max_samples = depth;
+    dw_qos.resource_limits.max_samples_per_instance = depth;
+  }
+  if (this->data_writer_->set_qos(dw_qos) != DDS::RETCODE_OK) {
+    throw std::runtime_error("DataWriter set_qos failed.");
+  }
+
+  this->reader_ = create_data_reader(this->subscriber_, this->topic_, reliability);
+  this->data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_narrow(reader_);
+
+  DDS::DataReaderQos dr_qos;
+  this->data_reader_->get_qos(dr_qos);
+  dr_qos.history.kind = history;
+  dr_qos.history.depth = depth;
+  if (config.keep_all) {
+    dr_qos.resource_limits.max_samples = depth;
+    dr_qos.resource_limits.max_samples_per_instance = depth;
+  }
+  if (this->data_reader_->set_qos(dr_qos) != DDS::RETCODE_OK) {
+    throw std::runtime_error("DataReader set_qos failed.");
+  }
+
+  // Initialize waitset and status condition
+  this->status_condition_ = this->reader_->get_statuscondition();
+  this->status_condition_->set_enabled_statuses(DDS::DATA_AVAILABLE_STATUS);
+  this->wait_set_ = new DDS::WaitSet;
+  if (this->wait_set_->attach_condition(this->status_condition_) != DDS::RETCODE_OK) {
+    throw std::runtime_error("attach_condition failed.");
+  }
+
+  // Enable the entities and wait for discovery
+  auto ret = writer_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+    throw std::runtime_error("writer enable failed.");
+  }
+
+  ret = reader_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+    throw std::runtime_error("reader enable failed.");
+  }
+
+  wait_for_publications(reader_, 1, 5000);
+  wait_for_subscriptions(writer_, 1, 5000);
+}
+
+void SustainedRateTest::write_samples(const CORBA::ULong total_samples, const double samples_per_second) {
+  const auto interval = samples_per_second > 0.0
+    ? std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(1e9 / samples_per_second))
+    : std::chrono::nanoseconds::zero();
+  std::chrono::steady_clock::duration blocked {0};
+  std::chrono::steady_clock::duration total {0};
+
+  // Past twice the scheduled duration the writer gives up, a blocked writer would otherwise run for
+  // max_blocking_time per sample. The samples not attempted are neither written nor timed out.
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline = start + 2 * interval * total_samples;
+  auto intended = start;
+  for (CORBA::ULong i = 0; i < total_samples; ++i) {
+    // A write slower than the interval delays the next ones, the offered load is kept on average.
+    if (interval.count() > 0) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        break;
+      }
+
+      wait_until(intended);
+      intended += interval;
+    }
+
+    const auto t_start = std::chrono::steady_clock::now();
+    const CORBA::LongLong sent = steady_nanoseconds();
+    ACE_OS::memcpy(this->sample_.ValueField.get_buffer(), &sent, sizeof sent);
+
+    const auto ret = this->data_writer_->write(this->sample_, DDS::HANDLE_NIL);
+    const auto duration = std::chrono::steady_clock::now() - t_start;
+    total += duration;
+
+    if (ret == DDS::RETCODE_OK) {
+      ++this->result_.samples_written;
+    } else if (ret == DDS::RETCODE_TIMEOUT) {
+      ++this->result_.write_timeouts;
+      blocked += duration;
+    } else {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) Error writing sample %d.\n"), ret));
+      break;
+    }
+  }
+
+  const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  this->result_.achieved_write_rate = elapsed_s > 0 ? this->result_.samples_written / elapsed_s : 0;
+  this->result_.write_blocked_ms = milliseconds(blocked);
+  this->result_.write_total_ms = milliseconds(total);
+
+  this->writing_ = false;
+}
+
+void SustainedRateTest::receive_samples() {
+  const DDS::Duration_t timeout = { 0, 100000000 };
+  const auto reader_delay = std::chrono::microseconds(this->config_.reader_delay_us);
+
+  const auto start = std::chrono::steady_clock::now();
+  auto last_receive = start;
+  CORBA::LongLong received = 0;
+
+  while (true) {
+    DDS::ConditionSeq active_conditions;
+    if (this->wait_set_->wait(active_conditions, timeout) == DDS::RETCODE_OK) {
+      OpenDDSNative::KeyedOctetsSeq samples;
+      DDS::SampleInfoSeq infos;
+      const auto ret = this->data_reader_->take(samples, infos, DDS::LENGTH_UNLIMITED, DDS::ANY_SAMPLE_STATE,
+                                                DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+      if (ret == DDS::RETCODE_OK) {
+        const CORBA::LongLong now = steady_nanoseconds();
+        CORBA::ULong count = 0;
+        for (CORBA::ULong i = 0; i < samples.length(); ++i) {
+          if (!infos[i].valid_data) {
+            continue;
+          }
+
+          CORBA::LongLong sent = 0;
+          ACE_OS::memcpy(&sent, samples[i].ValueField.get_buffer(), sizeof sent);
+          this->histogram_.record(now > sent ? static_cast<ACE_UINT64>(now - sent) : 0);
+          ++count;
+        }
+        this->data_reader_->return_loan(samples, infos);
+
+        if (count > 0) {
+          received += count;
+          last_receive = std::chrono::steady_clock::now();
+
+          // A slow reader keeps the samples it took busy, the next ones pile up in the history meanwhile.
+          if (reader_delay.count() > 0) {
+            std::this_thread::sleep_for(reader_delay * count);
+          }
+        }
+      }
+    }
+
+    if (!this->writing_ && (received >= this->result_.samples_written ||
+                            std::chrono::steady_clock::now() - last_receive > DRAIN_TIMEOUT)) {
+      break;
+    }
+  }
+
+  const double elapsed_s = std::chrono::duration<double>(last_receive - start).count();
+  this->result_.samples_received = received;
+  this->result_.achieved_receive_rate = elapsed_s > 0 ? received / elapsed_s : 0;
+}
+
+void SustainedRateTest::run(const CORBA::ULong total_samples, const double samples_per_second) {
+  this->histogram_.reset();
+  this->result_ = {};
+  this->result_.offered_rate = samples_per_second;
+  this->result_.samples_offered = total_samples;
+
+  DDS::SampleLostStatus lost_start {};
+  DDS::SampleRejectedStatus rejected_start {};
+  this->reader_->get_sample_lost_status(lost_start);
+  this->reader_->get_sample_rejected_status(rejected_start);
+
+  this->writing_ = true;
+  std::thread writer_thread([this, total_samples, samples_per_second] {
+    this->write_samples(total_samples, samples_per_second);
+  });
+
+  this->receive_samples();
+  writer_thread.join();
+
+  DDS::SampleLostStatus lost {};
+  DDS::SampleRejectedStatus rejected {};
+  this->reader_->get_sample_lost_status(lost);
+  this->reader_->get_sample_rejected_status(rejected);
+  this->result_.samples_lost = lost.total_count - lost_start.total_count;
+  this->result_.samples_rejected = rejected.total_count - rejected_start.total_count;
+  this->result_.samples_missing = (std::max)(this->result_.samples_written - this->result_.samples_received, static_cast<CORBA::LongLong>(0));
+
+  const ACE_UINT64 count = this->histogram_.count();
+  this->result_.latency_mean_ns = count > 0 ? static_cast<double>(this->histogram_.sum()) / static_cast<double>(count) : 0.0;
+  this->result_.latency_fifty_ns = this->histogram_.value_at_percentile(50.0);
+  this->result_.latency_ninety_nine_ns = this->histogram_.value_at_percentile(99.0);
+  this->result_.latency_ninety_nine_nine_ns = this->histogram_.value_at_percentile(99.9);
+  this->result_.latency_max_ns = this->histogram_.maximum();
+}
+
+const SustainedRateResult& SustainedRateTest::result() const {
+  return this->result_;
+}
+
+void SustainedRateTest::finalize() {
+  DDS::ReturnCode_t result = this->status_condition_->set_enabled_statuses(OpenDDS::DCPS::NO_STATUS_MASK);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("set_enabled_statuses failed.");
+  }
+
+  result = this->wait_set_->detach_condition(this->status_condition_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("detach_condition failed.");
+  }
+  CORBA::release(this->wait_set_);
+  this->wait_set_ = nullptr;
+
+  result = this->publisher_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->subscriber_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  result = this->participant_->delete_topic(this->topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+}
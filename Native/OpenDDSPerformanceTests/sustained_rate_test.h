@@ -0,0 +1,98 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <atomic>
+#include "utils.h"
+#include "../latency_histogram.h"
+
+/// Reliability, history and reader speed of a SustainedRateTest run.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct SustainedRateConfig {
+  CORBA::LongLong reliable;
+  CORBA::LongLong keep_all;
+  // KEEP_LAST depth, or max_samples_per_instance of the writer and the reader with KEEP_ALL,
+  // so the reliable flow control pushes back once the reader falls behind.
+  CORBA::LongLong depth;
+  // Reliability max_blocking_time of the writer, a write blocked longer returns TIMEOUT.
+  CORBA::LongLong max_blocking_ms;
+  // Processing time the reader spends on every sample it takes, zero for a reader as fast as the take.
+  CORBA::LongLong reader_delay_us;
+};
+
+/// Measurements of a SustainedRateTest run, the latencies are in nanoseconds.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct SustainedRateResult {
+  double offered_rate;
+  double achieved_write_rate;
+  double achieved_receive_rate;
+  CORBA::LongLong samples_offered;
+  CORBA::LongLong samples_written;
+  CORBA::LongLong samples_received;
+  // Writes returning TIMEOUT and the time spent in them.
+  CORBA::LongLong write_timeouts;
+  double write_blocked_ms;
+  // Time spent in every write, the blocked ones included.
+  double write_total_ms;
+  // SAMPLE_LOST and SAMPLE_REJECTED total counts of the reader.
+  CORBA::LongLong samples_lost;
+  CORBA::LongLong samples_rejected;
+  // Written samples the reader never took, overwritten in a KEEP_LAST history or lost by a best effort reader.
+  CORBA::LongLong samples_missing;
+  double latency_mean_ns;
+  CORBA::ULongLong latency_fifty_ns;
+  CORBA::ULongLong latency_ninety_nine_ns;
+  CORBA::ULongLong latency_ninety_nine_nine_ns;
+  CORBA::ULongLong latency_max_ns;
+};
+
+/// Throughput at a target write rate, between a writer and a reader of the same participant. The writer paces its
+/// writes to the offered rate and stamps every sample with the steady clock, the reader takes them from a WaitSet
+/// and records the write-to-take latency. Unlike the ThroughputTest, the writes that block and the samples that
+/// never arrive are measured instead of waited for, so sweeping the offered rate shows where the achieved rate stops
+/// following it and the latency starts growing.
+class CLASS_EXPORT_FLAG SustainedRateTest {
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  DDS::Topic_ptr topic_ = DDS::Topic::_nil();
+  DDS::WaitSet_ptr wait_set_ = nullptr;
+  DDS::StatusCondition_ptr status_condition_ = nullptr;
+  DDS::DataWriter_ptr writer_ = DDS::DataWriter::_nil();
+  DDS::DataReader_ptr reader_ = DDS::DataReader::_nil();
+  OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_nil();
+  OpenDDSNative::KeyedOctetsDataReader_ptr data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_nil();
+  OpenDDSNative::KeyedOctets sample_;
+
+  SustainedRateConfig config_ {};
+  latency_histogram histogram_;
+  SustainedRateResult result_ {};
+  std::atomic<bool> writing_ {false};
+
+  void write_samples(CORBA::ULong total_samples, double samples_per_second);
+  void receive_samples();
+
+public:
+  void initialize(const SustainedRateConfig& config, CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant);
+  void run(CORBA::ULong total_samples, double samples_per_second);
+  void finalize();
+  const SustainedRateResult& result() const;
+};
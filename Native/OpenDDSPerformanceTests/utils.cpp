@@ -19,6 +19,15 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #include "utils.h"
 
+#if defined(_WIN32)
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
+
 std::string random_string(const std::size_t length) {
   const std::string CHARACTERS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
 
@@ -139,16 +148,22 @@ DDS::Subscriber_ptr create_subscriber(DDS::DomainParticipant_ptr participant) {
 }
 
 DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant) {
+  return create_topic(participant, random_string(16));
+}
+
+DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant, const std::string& topic_name) {
   const OpenDDSNative::KeyedOctetsTypeSupport_var ts = new OpenDDSNative::KeyedOctetsTypeSupportImpl;
-  const auto type_name = ts->get_type_name();
-  auto ret = ts->register_type(participant, type_name);
+  return create_topic(participant, topic_name, ts);
+}
+
+DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant, const std::string& topic_name, DDS::TypeSupport_ptr type_support) {
+  const CORBA::String_var type_name = type_support->get_type_name();
+  auto ret = type_support->register_type(participant, type_name);
   if (ret != ::DDS::RETCODE_OK) {
     ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) register_type failed.\n")));
     throw std::runtime_error("register_type failed.");
   }
 
-  const auto topic_name = random_string(16);
-
   ::DDS::TopicQos topic_qos;
   participant->get_default_topic_qos(topic_qos);
   topic_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
@@ -165,9 +180,13 @@ DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant) {
 }
 
 DDS::DataWriter_ptr create_data_writer(DDS::Publisher_ptr publisher, DDS::Topic_ptr topic) {
+  return create_data_writer(publisher, topic, DDS::RELIABLE_RELIABILITY_QOS);
+}
+
+DDS::DataWriter_ptr create_data_writer(DDS::Publisher_ptr publisher, DDS::Topic_ptr topic, const DDS::ReliabilityQosPolicyKind reliability) {
   DDS::DataWriterQos dw_qos;
   publisher->get_default_datawriter_qos(dw_qos);
-  dw_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  dw_qos.reliability.kind = reliability;
   dw_qos.reliability.max_blocking_time = {DDS::DURATION_INFINITE_SEC, DDS::DURATION_INFINITE_NSEC};
   dw_qos.history.kind = DDS::KEEP_ALL_HISTORY_QOS;
 
@@ -182,9 +201,13 @@ DDS::DataWriter_ptr create_data_writer(DDS::Publisher_ptr publisher, DDS::Topic_
 }
 
 DDS::DataReader_ptr create_data_reader(DDS::Subscriber_ptr subscriber, DDS::Topic_ptr topic) {
+  return create_data_reader(subscriber, topic, DDS::RELIABLE_RELIABILITY_QOS);
+}
+
+DDS::DataReader_ptr create_data_reader(DDS::Subscriber_ptr subscriber, DDS::Topic_ptr topic, const DDS::ReliabilityQosPolicyKind reliability) {
   DDS::DataReaderQos dr_qos;
   subscriber->get_default_datareader_qos(dr_qos);
-  dr_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  dr_qos.reliability.kind = reliability;
   dr_qos.reliability.max_blocking_time = {DDS::DURATION_INFINITE_SEC, DDS::DURATION_INFINITE_NSEC};
   dr_qos.history.kind = DDS::KEEP_ALL_HISTORY_QOS;
 
@@ -196,4 +219,48 @@ DDS::DataReader_ptr create_data_reader(DDS::Subscriber_ptr subscriber, DDS::Topi
   }
 
   return reader;
-}
\ No newline at end of file
+}
+
+size_t resident_memory() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof counters)) {
+    return counters.WorkingSetSize;
+  }
+  return 0;
+#elif defined(__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+    return info.resident_size;
+  }
+  return 0;
+#elif defined(__linux__)
+  // Second field of statm, in pages.
+  std::ifstream statm("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  if (statm >> size >> resident) {
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
+  return 0;
+#else
+  return 0;
+#endif
+}
+
+CORBA::LongLong steady_nanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void wait_until(const std::chrono::steady_clock::time_point intended) {
+  auto remaining = intended - std::chrono::steady_clock::now();
+  while (remaining.count() > 0) {
+    if (remaining > std::chrono::milliseconds(1)) {
+      std::this_thread::sleep_for(remaining - std::chrono::milliseconds(1));
+    } else {
+      std::this_thread::yield();
+    }
+    remaining = intended - std::chrono::steady_clock::now();
+  }
+}
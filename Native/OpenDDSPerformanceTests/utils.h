@@ -19,6 +19,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #pragma once
 
+#include <chrono>
 #include <random>
 #include <thread>
 #include <dds/DCPS/WaitSet.h>
@@ -65,8 +66,26 @@ DDS::Subscriber_ptr create_subscriber(DDS::DomainParticipant_ptr participant);
 
 DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant);
 
+DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant, const std::string& topic_name);
+
+DDS::Topic_ptr create_topic(DDS::DomainParticipant_ptr participant, const std::string& topic_name, DDS::TypeSupport_ptr type_support);
+
 DDS::DataWriter_ptr create_data_writer(DDS::Publisher_ptr publisher, DDS::Topic_ptr topic);
 
+DDS::DataWriter_ptr create_data_writer(DDS::Publisher_ptr publisher, DDS::Topic_ptr topic, DDS::ReliabilityQosPolicyKind reliability);
+
 DDS::DataReader_ptr create_data_reader(DDS::Subscriber_ptr subscriber, DDS::Topic_ptr topic);
 
-void* serialize_latencies(const std::vector<double>& vec);
\ No newline at end of file
+DDS::DataReader_ptr create_data_reader(DDS::Subscriber_ptr subscriber, DDS::Topic_ptr topic, DDS::ReliabilityQosPolicyKind reliability);
+
+void* serialize_latencies(const std::vector<double>& vec);
+
+/// Resident set size of the process in bytes, zero when the platform doesn't expose it.
+size_t resident_memory();
+
+/// Steady clock time in nanoseconds, the timestamp the benchmarks write in the samples to measure their latency.
+CORBA::LongLong steady_nanoseconds();
+
+/// Blocks until the intended send time of a paced writer. Sleeps until the last millisecond and yields the rest,
+/// the sleep alone overshoots by the scheduler granularity.
+void wait_until(std::chrono::steady_clock::time_point intended);
\ No newline at end of file
@@ -0,0 +1,271 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "wrapper_overhead_test.h"
+
+#include <chrono>
+
+// Entry points of the TestData wrapper built in OpenDDSTestData, declared by its generated header. They are imported
+// from that library, the marshaling helpers also defined by the header are left to the wrapper itself.
+#pragma push_macro("EXTERN_METHOD_EXPORT")
+#undef EXTERN_METHOD_EXPORT
+#ifdef _WIN32
+  #define EXTERN_METHOD_EXPORT extern "C" __declspec(dllimport)
+#else
+  #define EXTERN_METHOD_EXPORT extern "C"
+#endif
+#define OPENDDSHARP_CWRAPPER_DECLARATIONS_ONLY
+#include "TestDataTypeSupport.h"
+#pragma pop_macro("EXTERN_METHOD_EXPORT")
+
+namespace {
+  // Samples taken per call, the same for every path.
+  const CORBA::Long TAKE_BATCH = 256;
+
+  // A failed write would be timed as a fast one and hide the overhead, the run is aborted instead.
+  void check_write(const DDS::ReturnCode_t ret, const char* path) {
+    if (ret != DDS::RETCODE_OK) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) %C write failed: %d.\n"), path, ret));
+      throw std::runtime_error(std::string(path) + " write failed.");
+    }
+  }
+
+  double nanoseconds_per_sample(const std::chrono::steady_clock::duration elapsed, const CORBA::LongLong samples) {
+    return samples > 0 ? static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / samples : 0;
+  }
+}
+
+void WrapperOverheadTest::initialize(const CORBA::ULong total_samples, const CORBA::ULong payload_size,
+                                     DDS::DomainParticipant_ptr participant) {
+  this->total_samples_ = total_samples;
+  this->payload_size_ = payload_size;
+  this->participant_ = participant;
+
+  this->sample_.KeyField = "1";
+  this->sample_.ValueField.length(payload_size);
+
+  const auto data = random_bytes(payload_size);
+  for (CORBA::ULong i = 0; i < payload_size; ++i) {
+    this->sample_.ValueField[i] = data[i];
+  }
+
+  // Same encoding as the managed CDR marshaller.
+  const OpenDDS::DCPS::Encoding encoding(OpenDDS::DCPS::Encoding::KIND_XCDR1, OpenDDS::DCPS::ENDIAN_LITTLE);
+  const size_t cdr_size = OpenDDS::DCPS::serialized_size(encoding, this->sample_);
+  ACE_Message_Block mb(cdr_size);
+  OpenDDS::DCPS::Serializer serializer(&mb, encoding);
+  if (!(serializer << this->sample_)) {
+    throw std::runtime_error("Failed to serialize the CDR sample.");
+  }
+  this->cdr_sample_.assign(mb.rd_ptr(), mb.rd_ptr() + cdr_size);
+
+  const OpenDDSNative::KeyedOctetsTypeSupport_var ts = new OpenDDSNative::KeyedOctetsTypeSupportImpl;
+  const OpenDDS::DCPS::RepresentationFormat_var format = ts->make_format(OpenDDS::DCPS::JSON_DATA_REPRESENTATION);
+  CORBA::String_var json;
+  if (ts->encode_to_string(this->sample_, json, format) != DDS::RETCODE_OK) {
+    throw std::runtime_error("Failed to encode the JSON sample.");
+  }
+  this->json_sample_ = json.in();
+
+  this->publisher_ = create_publisher(this->participant_);
+  this->subscriber_ = create_subscriber(this->participant_);
+  this->topic_ = create_topic(this->participant_);
+
+  this->writer_ = create_data_writer(this->publisher_, this->topic_);
+  this->data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_narrow(writer_);
+  this->reader_ = create_data_reader(this->subscriber_, this->topic_);
+  this->data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_narrow(reader_);
+
+  auto ret = writer_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) writer enable failed.\n")));
+    throw std::runtime_error("writer enable failed.");
+  }
+
+  ret = reader_->enable();
+  if (ret != ::DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) reader enable failed.\n")));
+    throw std::runtime_error("reader enable failed.");
+  }
+
+  if (!wait_for_publications(reader_, 1, 5000)) {
+    throw std::runtime_error("wait_for_publications failed.");
+  }
+
+  if (!wait_for_subscriptions(writer_, 1, 5000)) {
+    throw std::runtime_error("wait_for_subscriptions failed.");
+  }
+}
+
+double WrapperOverheadTest::write(const WrapperPath path) const {
+  const auto start = std::chrono::steady_clock::now();
+  switch (path) {
+    case WRAPPER_PATH_NATIVE:
+      for (CORBA::ULong i = 0; i < this->total_samples_; ++i) {
+        check_write(this->data_writer_->write(this->sample_, DDS::HANDLE_NIL), "Native");
+      }
+      break;
+    case WRAPPER_PATH_CDR:
+      for (CORBA::ULong i = 0; i < this->total_samples_; ++i) {
+        check_write(OpenDDSNative_KeyedOctetsDataWriter_Write_Cdr(this->data_writer_, this->cdr_sample_.data(),
+          this->cdr_sample_.size(), DDS::HANDLE_NIL), "CDR");
+      }
+      break;
+    case WRAPPER_PATH_JSON:
+      for (CORBA::ULong i = 0; i < this->total_samples_; ++i) {
+        check_write(OpenDDSNative_KeyedOctetsDataWriter_Write_Json(this->data_writer_, this->json_sample_.c_str(),
+          DDS::HANDLE_NIL), "JSON");
+      }
+      break;
+    default:
+      break;
+  }
+
+  return nanoseconds_per_sample(std::chrono::steady_clock::now() - start, this->total_samples_);
+}
+
+double WrapperOverheadTest::take(const WrapperPath path, CORBA::LongLong& taken) const {
+  taken = 0;
+  std::chrono::steady_clock::duration elapsed {0};
+
+  // The samples are already acknowledged, only the take and the release of its output are timed,
+  // the same work the managed side does for every call.
+  while (taken < this->total_samples_) {
+    CORBA::ULong count = 0;
+    DDS::ReturnCode_t ret = DDS::RETCODE_ERROR;
+    const auto start = std::chrono::steady_clock::now();
+
+    if (path == WRAPPER_PATH_NATIVE) {
+      OpenDDSNative::KeyedOctetsSeq samples;
+      DDS::SampleInfoSeq infos;
+      ret = this->data_reader_->take(samples, infos, TAKE_BATCH, DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+      if (ret == DDS::RETCODE_OK) {
+        count = samples.length();
+        this->data_reader_->return_loan(samples, infos);
+      }
+    } else if (path == WRAPPER_PATH_CDR) {
+      char* data = nullptr;
+      size_t data_size = 0;
+      char* info = nullptr;
+      size_t info_size = 0;
+      ret = OpenDDSNative_KeyedOctetsDataReader_Take_Cdr(this->data_reader_, data, data_size, info, info_size, TAKE_BATCH,
+        DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+      if (ret == DDS::RETCODE_OK) {
+        // XCDR1 little endian sequence, the length goes first.
+        ACE_OS::memcpy(&count, data, sizeof count);
+        ACE_OS::free(data);
+        ACE_OS::free(info);
+      }
+    } else {
+      void* data = nullptr;
+      void* info = nullptr;
+      ret = OpenDDSNative_KeyedOctetsDataReader_Take_Json(this->data_reader_, data, info, TAKE_BATCH,
+        DDS::ANY_SAMPLE_STATE, DDS::ANY_VIEW_STATE, DDS::ANY_INSTANCE_STATE);
+      if (ret == DDS::RETCODE_OK) {
+        // The length followed by the pointers to the JSON strings.
+        ACE_OS::memcpy(&count, data, sizeof count);
+        const char* strings = static_cast<const char*>(data) + sizeof count;
+        for (CORBA::ULong i = 0; i < count; ++i) {
+          char* json = nullptr;
+          ACE_OS::memcpy(&json, strings + (i * sizeof json), sizeof json);
+          CORBA::string_free(json);
+        }
+        ACE_OS::free(data);
+        ACE_OS::free(info);
+      }
+    }
+
+    elapsed += std::chrono::steady_clock::now() - start;
+    if (ret != DDS::RETCODE_OK) {
+      break;
+    }
+    taken += count;
+  }
+
+  return nanoseconds_per_sample(elapsed, taken);
+}
+
+void WrapperOverheadTest::run() {
+  this->results_.clear();
+
+  const DDS::Duration_t timeout = { 60, 0 };
+  for (CORBA::LongLong p = 0; p < WRAPPER_PATH_COUNT; ++p) {
+    const auto path = static_cast<WrapperPath>(p);
+
+    WrapperOverheadResult result {};
+    result.path = path;
+    result.payload_size = this->payload_size_;
+    result.samples_written = this->total_samples_;
+    result.write_ns_per_sample = this->write(path);
+
+    if (this->writer_->wait_for_acknowledgments(timeout) != DDS::RETCODE_OK) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: wait_for_acknowledgments timed out.\n")));
+    }
+
+    result.take_ns_per_sample = this->take(path, result.samples_taken);
+    this->results_.push_back(result);
+  }
+
+  for (auto& result : this->results_) {
+    result.write_overhead_ns = result.write_ns_per_sample - this->results_[WRAPPER_PATH_NATIVE].write_ns_per_sample;
+    result.take_overhead_ns = result.take_ns_per_sample - this->results_[WRAPPER_PATH_NATIVE].take_ns_per_sample;
+  }
+}
+
+void* WrapperOverheadTest::get_results() const {
+  const auto length = static_cast<ACE_UINT32>(this->results_.size());
+  const size_t struct_size = sizeof(WrapperOverheadResult);
+  const size_t buffer_size = (length * struct_size) + sizeof length;
+
+  // Same layout as the sequences marshalled by the wrapper: the length followed by the structures.
+  char* bytes = static_cast<char*>(ACE_OS::malloc(buffer_size));
+  ACE_OS::memcpy(bytes, &length, sizeof length);
+  for (ACE_UINT32 i = 0; i < length; i++) {
+    ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &this->results_[i], struct_size);
+  }
+
+  return bytes;
+}
+
+void WrapperOverheadTest::finalize() const {
+  DDS::ReturnCode_t result = this->publisher_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_publisher(this->publisher_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_publisher failed.");
+  }
+
+  result = this->subscriber_->delete_contained_entities();
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_contained_entities failed.");
+  }
+
+  result = this->participant_->delete_subscriber(this->subscriber_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_subscriber failed.");
+  }
+
+  result = this->participant_->delete_topic(this->topic_);
+  if (result != DDS::RETCODE_OK) {
+    throw std::runtime_error("delete_topic failed.");
+  }
+}
@@ -0,0 +1,77 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2025 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+#include "utils.h"
+
+/// The write and take paths measured by the WrapperOverheadTest.
+enum WrapperPath : CORBA::LongLong {
+  WRAPPER_PATH_NATIVE = 0,
+  WRAPPER_PATH_CDR = 1,
+  WRAPPER_PATH_JSON = 2,
+  WRAPPER_PATH_COUNT = 3
+};
+
+/// Cost of one path. The overhead is the difference with the typed KeyedOctetsDataWriter/DataReader calls.
+/// Every member is 8 bytes wide so the layout is the same in the managed side.
+struct WrapperOverheadResult {
+  CORBA::LongLong path;
+  CORBA::LongLong payload_size;
+  CORBA::LongLong samples_written;
+  CORBA::LongLong samples_taken;
+  double write_ns_per_sample;
+  double take_ns_per_sample;
+  double write_overhead_ns;
+  double take_overhead_ns;
+};
+
+/// Calls the generated DataWriter_Write_Cdr/_Json and DataReader_Take_Cdr/_Json entry points of the TestData wrapper
+/// directly from C++ and compares them with the typed OpenDDS calls on the same writer and reader. No managed code is
+/// involved, so the difference is the cost of the wrapper alone: decoding the input, encoding the output and the
+/// copies between both. The CDR and JSON inputs are encoded once before the run, as the managed side would hand them.
+class CLASS_EXPORT_FLAG WrapperOverheadTest {
+
+  DDS::DomainParticipant_ptr participant_ = DDS::DomainParticipant::_nil();
+  DDS::Publisher_ptr publisher_ = DDS::Publisher::_nil();
+  DDS::Subscriber_ptr subscriber_ = DDS::Subscriber::_nil();
+  DDS::Topic_ptr topic_ = DDS::Topic::_nil();
+  DDS::DataWriter_ptr writer_ = DDS::DataWriter::_nil();
+  DDS::DataReader_ptr reader_ = DDS::DataReader::_nil();
+  OpenDDSNative::KeyedOctetsDataWriter_ptr data_writer_ = OpenDDSNative::KeyedOctetsDataWriter::_nil();
+  OpenDDSNative::KeyedOctetsDataReader_ptr data_reader_ = OpenDDSNative::KeyedOctetsDataReader::_nil();
+  OpenDDSNative::KeyedOctets sample_;
+  std::vector<char> cdr_sample_;
+  std::string json_sample_;
+
+  CORBA::ULong total_samples_ = 0;
+  CORBA::ULong payload_size_ = 0;
+  std::vector<WrapperOverheadResult> results_;
+
+  double write(WrapperPath path) const;
+  double take(WrapperPath path, CORBA::LongLong& taken) const;
+
+public:
+  void initialize(CORBA::ULong total_samples, CORBA::ULong payload_size, DDS::DomainParticipant_ptr participant);
+  void run();
+  void finalize() const;
+  void* get_results() const;
+};
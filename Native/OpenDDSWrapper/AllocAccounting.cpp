@@ -0,0 +1,195 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "AllocAccounting.h"
+
+#ifdef OPENDDSHARP_ALLOC_ACCOUNTING
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+  struct live_allocation {
+    alloc_site *site;
+    size_t size;
+  };
+
+  // The live buffers are spread over several maps so concurrent entry points rarely share a lock.
+  struct live_shard {
+    std::mutex lock;
+    std::unordered_map<const void *, live_allocation> live;
+  };
+
+  // Never destroyed, buffers can still be released by the managed side while the process exits.
+  // The sites are statics of OpenDDSWrapper and the generated libraries, which are never unloaded.
+  struct registry {
+    std::mutex sites_lock;
+    std::vector<alloc_site *> sites;
+    alloc_site unscoped{"(unscoped)"};
+    std::array<live_shard, 16> shards;
+
+    static registry &instance() {
+      static registry *r = new registry();
+      return *r;
+    }
+
+    live_shard &shard(const void *ptr) {
+      return shards[(reinterpret_cast<uintptr_t>(ptr) >> 4) % shards.size()];
+    }
+
+    void enlist(alloc_site *site) {
+      if (!site->enlisted.exchange(true, std::memory_order_acq_rel)) {
+        std::lock_guard<std::mutex> guard(sites_lock);
+        sites.push_back(site);
+      }
+    }
+  };
+
+  void count_release(alloc_site *site, size_t size) {
+    site->releases.fetch_add(1, std::memory_order_relaxed);
+    site->live_allocations.fetch_sub(1, std::memory_order_relaxed);
+    site->live_bytes.fetch_sub(size, std::memory_order_relaxed);
+  }
+
+  void on_allocated(alloc_site *site, const void *ptr, size_t size) {
+    registry &r = registry::instance();
+    if (!site) {
+      site = &r.unscoped;
+    }
+    r.enlist(site);
+
+    site->allocations.fetch_add(1, std::memory_order_relaxed);
+    site->bytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (!ptr) {
+      site->releases.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    site->live_allocations.fetch_add(1, std::memory_order_relaxed);
+    site->live_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    live_shard &shard = r.shard(ptr);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto result = shard.live.emplace(ptr, live_allocation{site, size});
+    if (!result.second) {
+      // The address was reused, the previous buffer was freed without being reported.
+      count_release(result.first->second.site, result.first->second.size);
+      result.first->second = live_allocation{site, size};
+    }
+  }
+
+  void on_released(const void *ptr) {
+    live_shard &shard = registry::instance().shard(ptr);
+    std::lock_guard<std::mutex> guard(shard.lock);
+
+    auto it = shard.live.find(ptr);
+    if (it == shard.live.end()) {
+      return;
+    }
+
+    count_release(it->second.site, it->second.size);
+    shard.live.erase(it);
+  }
+
+  const alloc_hooks hooks = { on_allocated, on_released };
+
+  // OpenDDSWrapper accounts its own allocations as soon as it is loaded.
+  struct self_attach {
+    self_attach() {
+      ALLOC_ATTACH(&hooks);
+    }
+  } attach_on_load;
+}
+
+CORBA::Boolean AllocAccounting_GetEnabled() {
+  return true;
+}
+
+void *AllocAccounting_GetHooks() {
+  return const_cast<alloc_hooks *>(&hooks);
+}
+
+void AllocAccounting_GetSnapshot(void *&sites) {
+  // Sites of different libraries sharing an entry point name are reported together.
+  std::map<std::string, AllocSiteWrapper> merged;
+  {
+    registry &r = registry::instance();
+    std::lock_guard<std::mutex> guard(r.sites_lock);
+    for (const alloc_site *site : r.sites) {
+      AllocSiteWrapper &w = merged[site->entry_point];
+      w.allocations += site->allocations.load(std::memory_order_relaxed);
+      w.bytes += site->bytes.load(std::memory_order_relaxed);
+      w.releases += site->releases.load(std::memory_order_relaxed);
+      w.live_allocations += site->live_allocations.load(std::memory_order_relaxed);
+      w.live_bytes += site->live_bytes.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Built outside the lock, the snapshot buffer is accounted as any other allocation.
+  ALLOC_ENTRY_SCOPE(__func__);
+  TAO::unbounded_value_sequence<AllocSiteWrapper> seq(static_cast<CORBA::ULong>(merged.size()));
+  seq.length(static_cast<CORBA::ULong>(merged.size()));
+  CORBA::ULong i = 0;
+  for (const auto &m : merged) {
+    seq[i] = m.second;
+    ACE_OS::strsncpy(seq[i].entry_point, m.first.c_str(), ALLOC_ACCOUNTING_ENTRY_POINT_LENGTH);
+    ++i;
+  }
+
+  unbounded_sequence_to_ptr(seq, sites);
+}
+
+void AllocAccounting_Reset() {
+  registry &r = registry::instance();
+  std::lock_guard<std::mutex> guard(r.sites_lock);
+
+  // Outstanding buffers stay tracked so their release is still matched. Allocations made
+  // while resetting may be left out of the new totals.
+  for (alloc_site *site : r.sites) {
+    site->allocations.store(site->live_allocations.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    site->bytes.store(site->live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    site->releases.store(0, std::memory_order_relaxed);
+  }
+}
+
+#else
+
+CORBA::Boolean AllocAccounting_GetEnabled() {
+  return false;
+}
+
+void *AllocAccounting_GetHooks() {
+  return NULL;
+}
+
+void AllocAccounting_GetSnapshot(void *&sites) {
+  TAO::unbounded_value_sequence<AllocSiteWrapper> empty;
+  unbounded_sequence_to_ptr(empty, sites);
+}
+
+void AllocAccounting_Reset() {
+}
+
+#endif
@@ -79,12 +79,12 @@ public:
       lifespan = native.lifespan;
       liveliness = native.liveliness;
       if (native.name != NULL) {
-        name = CORBA::string_dup(native.name);
+        name = ALLOC_STRING_DUP(native.name);
       } else {
         name = NULL;
       }
       if (native.type_name != NULL) {
-        type_name = CORBA::string_dup(native.type_name);
+        type_name = ALLOC_STRING_DUP(native.type_name);
       } else {
         type_name = NULL;
       }
@@ -148,12 +148,12 @@ public:
       key = native.key;
       participant_key = native.participant_key;
       if (native.topic_name != NULL) {
-        topic_name = CORBA::string_dup(native.topic_name);
+        topic_name = ALLOC_STRING_DUP(native.topic_name);
       } else {
         topic_name = NULL;
       }
       if (native.type_name != NULL) {
-        type_name = CORBA::string_dup(native.type_name);
+        type_name = ALLOC_STRING_DUP(native.type_name);
       } else {
         type_name = NULL;
       }
@@ -229,12 +229,12 @@ public:
       key = native.key;
       participant_key = native.participant_key;
       if (native.topic_name != NULL) {
-        topic_name = CORBA::string_dup(native.topic_name);
+        topic_name = ALLOC_STRING_DUP(native.topic_name);
       } else {
         topic_name = NULL;
       }
       if (native.type_name != NULL) {
-        type_name = CORBA::string_dup(native.type_name);
+        type_name = ALLOC_STRING_DUP(native.type_name);
       } else {
         type_name = NULL;
       }
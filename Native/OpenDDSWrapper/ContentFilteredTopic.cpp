@@ -44,6 +44,7 @@ char *ContentFilteredTopic_GetFilterExpression(::DDS::ContentFilteredTopic_ptr t
 }
 
 ::DDS::ReturnCode_t ContentFilteredTopic_GetExpressionParameters(::DDS::ContentFilteredTopic_ptr t, void *&seq) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::StringSeq parameters;
 
   ::DDS::ReturnCode_t ret = t->get_expression_parameters(parameters);
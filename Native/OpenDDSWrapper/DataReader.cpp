@@ -24,6 +24,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 }
 
 ::DDS::ReturnCode_t DataReader_GetMatchedPublications(::DDS::DataReader_ptr dr, void *&ptr) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::InstanceHandleSeq publication_handles;
   ::DDS::ReturnCode_t ret = dr->get_matched_publications(publication_handles);
 
@@ -39,6 +40,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 }
 
 ::DDS::ReturnCode_t DataReader_GetQos(::DDS::DataReader_ptr dr, DataReaderQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DataReaderQos qos_native;
   ::DDS::ReturnCode_t ret = dr->get_qos(qos_native);
 
@@ -53,6 +55,15 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
   return dr->set_qos(qos_wrapper);
 }
 
+::DDS::ReturnCode_t DataReader_SetQosWithProfile(::DDS::DataReader_ptr dr, OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile) {
+  std::shared_ptr<const ::DDS::DataReaderQos> qos = profile->datareader_qos();
+  if (!qos) {
+    return ::DDS::RETCODE_PRECONDITION_NOT_MET;
+  }
+
+  return dr->set_qos(*qos);
+}
+
 ::DDS::ReturnCode_t
 DataReader_SetListener(::DDS::DataReader_ptr dr, OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr listener,
                        ::DDS::StatusMask mask) {
@@ -108,6 +119,7 @@ DataReader_GetRequestedDeadlineMissedStatus(::DDS::DataReader_ptr dr, ::DDS::Req
 
 ::DDS::ReturnCode_t
 DataReader_GetRequestedIncompatibleQosStatus(::DDS::DataReader_ptr dr, RequestedIncompatibleQosStatusWrapper &status) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::RequestedIncompatibleQosStatus s;
   ::DDS::ReturnCode_t ret = dr->get_requested_incompatible_qos_status(s);
 
@@ -22,6 +22,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include "Utils.h"
 #include "marshal.h"
 #include "QosPolicies.h"
+#include "QosProfile.h"
 #include "DataReaderListenerImpl.h"
 #include "Statuses.h"
 #include "BuiltinTopicData.h"
@@ -41,6 +42,9 @@ EXTERN_METHOD_EXPORT
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t DataReader_SetQos(::DDS::DataReader_ptr dr, DataReaderQosWrapper qos_wrapper);
 
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t DataReader_SetQosWithProfile(::DDS::DataReader_ptr dr, OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile);
+
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t
 DataReader_SetListener(::DDS::DataReader_ptr dr, OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr listener,
@@ -19,6 +19,9 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #include <thread>
 #include "DataReaderListenerImpl.h"
+#include "Tracer.h"
+#include "LifecycleTrace.h"
+#include "../usdt_probes.h"
 
 ::OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl::DataReaderListenerImpl(void *onDataAvailable,
                                                                             void *onRequestedDeadlineMissed,
@@ -62,6 +65,10 @@ void ::OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl::dispose() {
 }
 
 void ::OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl::on_data_available(::DDS::DataReader_ptr reader) {
+  TRACE_EVENT_SCOPE("DataReaderListener_OnDataAvailable", "listener");
+  USDT_LISTENER_SCOPE(reader);
+  lifecycle_slot *lifecycle = lifecycle_trace::find(reader);
+  lifecycle_trace::notification(lifecycle);
   _lock.acquire();
 
   if (_disposed) {
@@ -70,11 +77,13 @@ void ::OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl::on_data_available(::DD
   }
 
   if (_onDataAvailable) {
-    auto f = [](void *ptr, ::DDS::Entity_ptr entity) {
+    auto f = [](void *ptr, ::DDS::Entity_ptr entity, lifecycle_slot *slot) {
+        TRACE_EVENT_SCOPE("DataReaderListener_OnDataAvailable_Managed", "managed");
+        lifecycle_trace::managed_scope lifecycle_scope(slot);
         reinterpret_cast<onDataAvailableDeclaration>(ptr)(entity);
     };
 
-    std::thread thread(f, _onDataAvailable, static_cast< ::DDS::Entity_ptr>(reader));
+    std::thread thread(f, _onDataAvailable, static_cast< ::DDS::Entity_ptr>(reader), lifecycle);
     thread.join();
   }
 
@@ -33,6 +33,7 @@ DataWriter_GetPublicationMatchedStatus(::DDS::DataWriter_ptr dw, ::DDS::Publicat
 };
 
 ::DDS::ReturnCode_t DataWriter_GetQos(::DDS::DataWriter_ptr dw, DataWriterQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DataWriterQos qos_native;
   ::DDS::ReturnCode_t ret = dw->get_qos(qos_native);
 
@@ -47,6 +48,15 @@ DataWriter_GetPublicationMatchedStatus(::DDS::DataWriter_ptr dw, ::DDS::Publicat
   return dw->set_qos(qos_wrapper);
 }
 
+::DDS::ReturnCode_t DataWriter_SetQosWithProfile(::DDS::DataWriter_ptr dw, OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile) {
+  std::shared_ptr<const ::DDS::DataWriterQos> qos = profile->datawriter_qos();
+  if (!qos) {
+    return ::DDS::RETCODE_PRECONDITION_NOT_MET;
+  }
+
+  return dw->set_qos(*qos);
+}
+
 ::DDS::ReturnCode_t DataWriter_AssertLiveliness(::DDS::DataWriter_ptr dw) {
   return dw->assert_liveliness();
 }
@@ -77,6 +87,7 @@ DataWriter_GetOfferedDeadlineMissedStatus(::DDS::DataWriter_ptr dw, ::DDS::Offer
 
 ::DDS::ReturnCode_t
 DataWriter_GetOfferedIncompatibleQosStatus(::DDS::DataWriter_ptr dw, OfferedIncompatibleQosStatusWrapper &status) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::OfferedIncompatibleQosStatus s;
   ::DDS::ReturnCode_t ret = dw->get_offered_incompatible_qos_status(s);
 
@@ -88,6 +99,7 @@ DataWriter_GetOfferedIncompatibleQosStatus(::DDS::DataWriter_ptr dw, OfferedInco
 }
 
 ::DDS::ReturnCode_t DataWriter_GetMatchedSubscriptions(::DDS::DataWriter_ptr dw, void *&ptr) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::InstanceHandleSeq seq;
   ::DDS::ReturnCode_t ret = dw->get_matched_subscriptions(seq);
 
@@ -21,6 +21,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Utils.h"
 #include "QosPolicies.h"
+#include "QosProfile.h"
 #include "DataWriterListenerImpl.h"
 #include "Statuses.h"
 #include "BuiltinTopicData.h"
@@ -41,6 +42,9 @@ EXTERN_METHOD_EXPORT
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t DataWriter_SetQos(::DDS::DataWriter_ptr dw, DataWriterQosWrapper qos_wrapper);
 
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t DataWriter_SetQosWithProfile(::DDS::DataWriter_ptr dw, OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile);
+
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t DataWriter_AssertLiveliness(::DDS::DataWriter_ptr dw);
 
@@ -20,5 +20,6 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include "Discovery.h"
 
 char *Discovery_GetKey(::OpenDDS::DCPS::Discovery *d) {
-  return CORBA::string_dup(d->key().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(d->key().c_str());
 }
\ No newline at end of file
@@ -36,6 +36,7 @@ CORBA::Long DomainParticipant_GetDomainId(::DDS::DomainParticipant_ptr dp) {
 
 ::DDS::ReturnCode_t
 DomainParticipant_GetDefaultPublisherQos(::DDS::DomainParticipant_ptr dp, PublisherQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublisherQos qos_native;
   ::DDS::ReturnCode_t ret = dp->get_default_publisher_qos(qos_native);
 
@@ -60,6 +61,7 @@ DomainParticipant_SetDefaultPublisherQos(::DDS::DomainParticipant_ptr dp, Publis
 
 ::DDS::ReturnCode_t
 DomainParticipant_GetDefaultSubscriberQos(::DDS::DomainParticipant_ptr dp, SubscriberQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriberQos qos_native;
   ::DDS::ReturnCode_t ret = dp->get_default_subscriber_qos(qos_native);
 
@@ -84,8 +86,23 @@ DomainParticipant_SetDefaultSubscriberQos(::DDS::DomainParticipant_ptr dp, Subsc
   return dp->create_topic(topic_name, type_name, qos, a_listener, mask);
 }
 
+::DDS::Topic_ptr DomainParticipant_CreateTopicWithProfile(::DDS::DomainParticipant_ptr dp,
+                                                          const char *topic_name,
+                                                          const char *type_name,
+                                                          OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile,
+                                                          OpenDDSharp::OpenDDS::DDS::TopicListenerImpl_ptr a_listener,
+                                                          ::DDS::StatusMask mask) {
+  std::shared_ptr<const ::DDS::TopicQos> qos = profile->topic_qos();
+  if (!qos) {
+    return dp->create_topic(topic_name, type_name, TOPIC_QOS_DEFAULT, a_listener, mask);
+  }
+
+  return dp->create_topic(topic_name, type_name, *qos, a_listener, mask);
+}
+
 ::DDS::ReturnCode_t
 DomainParticipant_GetDefaultTopicQos(::DDS::DomainParticipant_ptr dp, TopicQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicQos qos_native;
   ::DDS::ReturnCode_t ret = dp->get_default_topic_qos(qos_native);
 
@@ -102,6 +119,7 @@ DomainParticipant_GetDefaultTopicQos(::DDS::DomainParticipant_ptr dp, TopicQosWr
 
 ::DDS::ReturnCode_t
 DomainParticipant_GetQos(::DDS::DomainParticipant_ptr dp, DomainParticipantQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DomainParticipantQos qos_native;
   ::DDS::ReturnCode_t ret = dp->get_qos(qos_native);
 
@@ -184,6 +202,7 @@ DomainParticipant_IgnoreSubscription(::DDS::DomainParticipant_ptr dp, ::DDS::Ins
 }
 
 ::DDS::ReturnCode_t DomainParticipant_GetDiscoveredParticipants(::DDS::DomainParticipant_ptr dp, void *&ptr) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::InstanceHandleSeq seq;
   ::DDS::ReturnCode_t ret = dp->get_discovered_participants(seq);
 
@@ -195,6 +214,7 @@ DomainParticipant_IgnoreSubscription(::DDS::DomainParticipant_ptr dp, ::DDS::Ins
 }
 
 ::DDS::ReturnCode_t DomainParticipant_GetDiscoveredTopics(::DDS::DomainParticipant_ptr dp, void *&ptr) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::InstanceHandleSeq seq;
   ::DDS::ReturnCode_t ret = dp->get_discovered_topics(seq);
 
@@ -254,4 +274,262 @@ DomainParticipant_CreateMultiTopic(::DDS::DomainParticipant_ptr dp, char *name,
 
 ::DDS::ReturnCode_t DomainParticipant_DeleteMultiTopic(::DDS::DomainParticipant_ptr dp, ::DDS::MultiTopic_ptr mt) {
   return dp->delete_multitopic(mt);
-}
\ No newline at end of file
+}
+
+static ::DDS::ReturnCode_t endpoint_spec_topic_qos(::DDS::DomainParticipant_ptr dp, const EndpointSpecWrapper &spec, ::DDS::TopicQos &qos) {
+  if (spec.profile != nullptr) {
+    std::shared_ptr<const ::DDS::TopicQos> profile_qos = spec.profile->topic_qos();
+    if (profile_qos) {
+      qos = *profile_qos;
+      return ::DDS::RETCODE_OK;
+    }
+  }
+
+  return dp->get_default_topic_qos(qos);
+}
+
+static bool endpoint_spec_matches_topic(::DDS::DomainParticipant_ptr dp, const EndpointSpecWrapper &spec, ::DDS::Topic_ptr topic) {
+  using ::OpenDDS::DCPS::operator==;
+
+  CORBA::String_var type_name = topic->get_type_name();
+  if (std::strcmp(type_name.in(), spec.type_name) != 0) {
+    return false;
+  }
+
+  ::DDS::TopicQos topic_qos;
+  ::DDS::TopicQos spec_qos;
+  if (topic->get_qos(topic_qos) != ::DDS::RETCODE_OK || endpoint_spec_topic_qos(dp, spec, spec_qos) != ::DDS::RETCODE_OK) {
+    return false;
+  }
+
+  return topic_qos == spec_qos;
+}
+
+::DDS::ReturnCode_t DomainParticipant_CreateEndpoints(::DDS::DomainParticipant_ptr dp,
+                                                      ::DDS::Publisher_ptr pub,
+                                                      ::DDS::Subscriber_ptr sub,
+                                                      EndpointSpecWrapper specs[],
+                                                      CORBA::Long count,
+                                                      EndpointResultWrapper results[],
+                                                      CORBA::Boolean enable) {
+  if (count < 0 || (count > 0 && (specs == nullptr || results == nullptr))) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  // The endpoints are created under the factory QoS of the publisher and subscriber, which
+  // are shared with the other threads. When they do not autoenable the created entities, the
+  // batch is enabled at the end so the discovery announcements are sent together.
+  std::map<std::string, ::DDS::Topic_ptr> topics;
+  for (CORBA::Long i = 0; i < count; i++) {
+    const EndpointSpecWrapper &spec = specs[i];
+    EndpointResultWrapper &result = results[i];
+
+    result.topic = nullptr;
+    result.topic_entity = nullptr;
+    result.topic_description = nullptr;
+    result.endpoint = nullptr;
+    result.endpoint_entity = nullptr;
+    result.return_code = ::DDS::RETCODE_OK;
+
+    if (spec.topic_name == nullptr || spec.type_name == nullptr || (spec.is_reader ? CORBA::is_nil(sub) : CORBA::is_nil(pub))) {
+      result.return_code = ::DDS::RETCODE_BAD_PARAMETER;
+      continue;
+    }
+
+    ::DDS::Topic_ptr topic;
+    std::map<std::string, ::DDS::Topic_ptr>::iterator it = topics.find(spec.topic_name);
+    if (it != topics.end()) {
+      // A topic name is shared by the whole batch, a later spec must agree with the type and QoS it was created with.
+      if (!endpoint_spec_matches_topic(dp, spec, it->second)) {
+        result.return_code = ::DDS::RETCODE_PRECONDITION_NOT_MET;
+        continue;
+      }
+
+      topic = it->second;
+    } else {
+      if (spec.profile == nullptr) {
+        topic = dp->create_topic(spec.topic_name, spec.type_name, TOPIC_QOS_DEFAULT, nullptr, ::OpenDDS::DCPS::DEFAULT_STATUS_MASK);
+      } else {
+        topic = DomainParticipant_CreateTopicWithProfile(dp, spec.topic_name, spec.type_name, spec.profile, nullptr, ::OpenDDS::DCPS::DEFAULT_STATUS_MASK);
+      }
+
+      if (CORBA::is_nil(topic)) {
+        result.return_code = ::DDS::RETCODE_ERROR;
+        continue;
+      }
+
+      topics[spec.topic_name] = topic;
+    }
+
+    result.topic = topic;
+    result.topic_entity = static_cast< ::DDS::Entity_ptr>(topic);
+    result.topic_description = static_cast< ::DDS::TopicDescription_ptr>(topic);
+
+    if (spec.is_reader) {
+      OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr listener = static_cast<OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr>(spec.listener);
+
+      ::DDS::DataReader_ptr dr;
+      if (spec.profile == nullptr) {
+        dr = sub->create_datareader(topic, DATAREADER_QOS_DEFAULT, listener, spec.mask);
+      } else {
+        dr = Subscriber_CreateDataReaderWithProfile(sub, topic, spec.profile, listener, spec.mask);
+      }
+
+      if (CORBA::is_nil(dr)) {
+        result.return_code = ::DDS::RETCODE_ERROR;
+        continue;
+      }
+
+      result.endpoint = dr;
+      result.endpoint_entity = static_cast< ::DDS::Entity_ptr>(dr);
+    } else {
+      OpenDDSharp::OpenDDS::DDS::DataWriterListenerImpl_ptr listener = static_cast<OpenDDSharp::OpenDDS::DDS::DataWriterListenerImpl_ptr>(spec.listener);
+
+      ::DDS::DataWriter_ptr dw;
+      if (spec.profile == nullptr) {
+        dw = pub->create_datawriter(topic, DATAWRITER_QOS_DEFAULT, listener, spec.mask);
+      } else {
+        dw = Publisher_CreateDataWriterWithProfile(pub, topic, spec.profile, listener, spec.mask);
+      }
+
+      if (CORBA::is_nil(dw)) {
+        result.return_code = ::DDS::RETCODE_ERROR;
+        continue;
+      }
+
+      result.endpoint = dw;
+      result.endpoint_entity = static_cast< ::DDS::Entity_ptr>(dw);
+    }
+  }
+
+  ::DDS::ReturnCode_t ret = ::DDS::RETCODE_OK;
+  for (CORBA::Long i = 0; i < count; i++) {
+    EndpointResultWrapper &result = results[i];
+
+    if (enable && result.return_code == ::DDS::RETCODE_OK) {
+      result.return_code = result.endpoint_entity->enable();
+    }
+
+    if (result.return_code == ::DDS::RETCODE_PRECONDITION_NOT_MET) {
+      ret = ::DDS::RETCODE_PRECONDITION_NOT_MET;
+    } else if (result.return_code != ::DDS::RETCODE_OK && ret == ::DDS::RETCODE_OK) {
+      ret = ::DDS::RETCODE_ERROR;
+    }
+  }
+
+  return ret;
+}
+
+template <typename T>
+static ::DDS::ReturnCode_t detach_listeners(T *entities[], CORBA::Long count) {
+  for (CORBA::Long i = 0; i < count; i++) {
+    ::DDS::ReturnCode_t ret = entities[i]->set_listener(nullptr, 0);
+    if (ret != ::DDS::RETCODE_OK) {
+      return ret;
+    }
+  }
+
+  return ::DDS::RETCODE_OK;
+}
+
+::DDS::ReturnCode_t DomainParticipant_FastDeleteContainedEntities(::DDS::DomainParticipant_ptr dp,
+                                                                  ::DDS::Publisher_ptr pubs[],
+                                                                  CORBA::Long pub_count,
+                                                                  ::DDS::Subscriber_ptr subs[],
+                                                                  CORBA::Long sub_count,
+                                                                  ::DDS::DataWriter_ptr writers[],
+                                                                  CORBA::Long writer_count,
+                                                                  ::DDS::DataReader_ptr readers[],
+                                                                  CORBA::Long reader_count,
+                                                                  CORBA::Long max_threads,
+                                                                  TeardownTimingsWrapper &timings,
+                                                                  CORBA::Boolean &listeners_detached) {
+  listeners_detached = false;
+  if (pub_count < 0 || sub_count < 0 || writer_count < 0 || reader_count < 0 ||
+      (pub_count > 0 && pubs == nullptr) || (sub_count > 0 && subs == nullptr) ||
+      (writer_count > 0 && writers == nullptr) || (reader_count > 0 && readers == nullptr)) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  timings.listeners_us = 0;
+  timings.endpoints_us = 0;
+  timings.entities_us = 0;
+  timings.threads = 0;
+
+  // Detach every listener first, the endpoints included, so no callback is dispatched while the entities are going
+  // away. Nothing is deleted if any of them cannot be detached.
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  ::DDS::ReturnCode_t ret = dp->set_listener(nullptr, 0);
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = detach_listeners(writers, writer_count);
+  }
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = detach_listeners(readers, reader_count);
+  }
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = detach_listeners(pubs, pub_count);
+  }
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = detach_listeners(subs, sub_count);
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  timings.listeners_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  if (ret != ::DDS::RETCODE_OK) {
+    return ret;
+  }
+  listeners_detached = true;
+
+  // Each publisher and subscriber deletes its own writers and readers, in parallel with the others.
+  const size_t total = static_cast<size_t>(pub_count) + static_cast<size_t>(sub_count);
+
+  CORBA::Long threads = max_threads > 0 ? max_threads : static_cast<CORBA::Long>(std::thread::hardware_concurrency());
+  if (threads < 1) {
+    threads = 1;
+  }
+  if (static_cast<size_t>(threads) > total) {
+    threads = static_cast<CORBA::Long>(total);
+  }
+  timings.threads = threads;
+
+  std::atomic<size_t> next(0);
+  std::atomic<bool> failed(false);
+  auto worker = [&]() {
+    for (size_t i = next++; i < total; i = next++) {
+      ::DDS::ReturnCode_t deleted;
+      if (i < static_cast<size_t>(pub_count)) {
+        deleted = pubs[i]->delete_contained_entities();
+      } else {
+        deleted = subs[i - pub_count]->delete_contained_entities();
+      }
+
+      if (deleted != ::DDS::RETCODE_OK) {
+        failed = true;
+      }
+    }
+  };
+
+  start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (CORBA::Long i = 1; i < threads; i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &t : workers) {
+    t.join();
+  }
+  end = std::chrono::steady_clock::now();
+  timings.endpoints_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  // The publishers and subscribers are empty now, the participant only has to release them and the topics.
+  start = std::chrono::steady_clock::now();
+  ret = dp->delete_contained_entities();
+  end = std::chrono::steady_clock::now();
+  timings.entities_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  if (ret == ::DDS::RETCODE_OK && failed) {
+    ret = ::DDS::RETCODE_ERROR;
+  }
+
+  return ret;
+}
@@ -22,16 +22,52 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include "Utils.h"
 #include "marshal.h"
 #include "QosPolicies.h"
+#include "QosProfile.h"
 #include "DomainParticipantListenerImpl.h"
 #include "TopicListenerImpl.h"
 #include "SubscriberListenerImpl.h"
 #include "PublisherListenerImpl.h"
+#include "DataWriterListenerImpl.h"
+#include "DataReaderListenerImpl.h"
 #include "BuiltinTopicData.h"
 
 #include "dds/DCPS/Marked_Default_Qos.h"
 #include "dds/DCPS/PublisherImpl.h"
 #include "dds/DCPS/DomainParticipantImpl.h"
 
+#include <map>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <vector>
+
+EXTERN_STRUCT_EXPORT EndpointSpecWrapper {
+    const char *topic_name;
+    const char *type_name;
+    CORBA::Boolean is_reader;
+    OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile;
+    void *listener;
+    ::DDS::StatusMask mask;
+};
+
+EXTERN_STRUCT_EXPORT TeardownTimingsWrapper {
+    CORBA::LongLong listeners_us;
+    CORBA::LongLong endpoints_us;
+    CORBA::LongLong entities_us;
+    CORBA::Long threads;
+};
+
+EXTERN_STRUCT_EXPORT EndpointResultWrapper {
+    ::DDS::Topic_ptr topic;
+    ::DDS::Entity_ptr topic_entity;
+    ::DDS::TopicDescription_ptr topic_description;
+    void *endpoint;
+    ::DDS::Entity_ptr endpoint_entity;
+    ::DDS::ReturnCode_t return_code;
+};
+
 EXTERN_METHOD_EXPORT
 ::DDS::Entity_ptr DomainParticipant_NarrowBase(::DDS::DomainParticipant_ptr dp);
 
@@ -74,6 +110,14 @@ EXTERN_METHOD_EXPORT
                                                OpenDDSharp::OpenDDS::DDS::TopicListenerImpl_ptr a_listener,
                                                ::DDS::StatusMask mask);
 
+EXTERN_METHOD_EXPORT
+::DDS::Topic_ptr DomainParticipant_CreateTopicWithProfile(::DDS::DomainParticipant_ptr dp,
+                                                          const char *topic_name,
+                                                          const char *type_name,
+                                                          OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile,
+                                                          OpenDDSharp::OpenDDS::DDS::TopicListenerImpl_ptr a_listener,
+                                                          ::DDS::StatusMask mask);
+
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t DomainParticipant_GetDefaultTopicQos(::DDS::DomainParticipant_ptr dp, TopicQosWrapper &qos_wrapper);
 
@@ -168,4 +212,27 @@ DomainParticipant_CreateMultiTopic(::DDS::DomainParticipant_ptr dp, char *name,
                                    void *seq);
 
 EXTERN_METHOD_EXPORT
-::DDS::ReturnCode_t DomainParticipant_DeleteMultiTopic(::DDS::DomainParticipant_ptr dp, ::DDS::MultiTopic_ptr cft);
\ No newline at end of file
+::DDS::ReturnCode_t DomainParticipant_DeleteMultiTopic(::DDS::DomainParticipant_ptr dp, ::DDS::MultiTopic_ptr cft);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t DomainParticipant_CreateEndpoints(::DDS::DomainParticipant_ptr dp,
+                                                      ::DDS::Publisher_ptr pub,
+                                                      ::DDS::Subscriber_ptr sub,
+                                                      EndpointSpecWrapper specs[],
+                                                      CORBA::Long count,
+                                                      EndpointResultWrapper results[],
+                                                      CORBA::Boolean enable);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t DomainParticipant_FastDeleteContainedEntities(::DDS::DomainParticipant_ptr dp,
+                                                                  ::DDS::Publisher_ptr pubs[],
+                                                                  CORBA::Long pub_count,
+                                                                  ::DDS::Subscriber_ptr subs[],
+                                                                  CORBA::Long sub_count,
+                                                                  ::DDS::DataWriter_ptr writers[],
+                                                                  CORBA::Long writer_count,
+                                                                  ::DDS::DataReader_ptr readers[],
+                                                                  CORBA::Long reader_count,
+                                                                  CORBA::Long max_threads,
+                                                                  TeardownTimingsWrapper &timings,
+                                                                  CORBA::Boolean &listeners_detached);
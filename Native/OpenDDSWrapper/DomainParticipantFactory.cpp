@@ -34,6 +34,7 @@ DomainParticipantFactory_DeleteParticipant(::DDS::DomainParticipantFactory_ptr d
 
 ::DDS::ReturnCode_t DomainParticipantFactory_GetDefaultDomainParticipantQos(::DDS::DomainParticipantFactory_ptr dpf,
                                                                             DomainParticipantQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DomainParticipantQos qos_native;
   ::DDS::ReturnCode_t ret = dpf->get_default_participant_qos(qos_native);
 
@@ -51,6 +52,7 @@ DomainParticipantFactory_DeleteParticipant(::DDS::DomainParticipantFactory_ptr d
 
 ::DDS::ReturnCode_t DomainParticipantFactory_GetQos(::DDS::DomainParticipantFactory_ptr dpf,
                                                     DomainParticipantFactoryQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DomainParticipantFactoryQos qos_native;
   ::DDS::ReturnCode_t ret = dpf->get_qos(qos_native);
 
@@ -38,7 +38,8 @@ void InfoRepoDiscovery_SetBitTransportPort(::OpenDDS::DCPS::InfoRepoDiscovery *i
 }
 
 char *InfoRepoDiscovery_GetBitTransportIp(::OpenDDS::DCPS::InfoRepoDiscovery *idr) {
-  return CORBA::string_dup(idr->bit_transport_ip().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(idr->bit_transport_ip().c_str());
 }
 
 void InfoRepoDiscovery_SetBitTransportIp(::OpenDDS::DCPS::InfoRepoDiscovery *idr, char *ip) {
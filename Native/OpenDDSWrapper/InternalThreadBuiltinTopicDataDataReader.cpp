@@ -0,0 +1,130 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "InternalThreadBuiltinTopicDataDataReader.h"
+
+#include <map>
+#include <string>
+
+namespace {
+  void to_ptr(const ::OpenDDS::DCPS::InternalThreadBuiltinTopicDataSeq &received_data,
+              const ::DDS::SampleInfoSeq &info_seq, void *&receivedData) {
+    TAO::unbounded_value_sequence<InternalThreadBuiltinTopicDataWrapper> seq(received_data.length());
+    seq.length(received_data.length());
+    for (CORBA::ULong i = 0; i < received_data.length(); i++) {
+      seq[i] = InternalThreadBuiltinTopicDataWrapper(received_data[i], info_seq[i]);
+    }
+
+    unbounded_sequence_to_ptr(seq, receivedData);
+  }
+}
+
+::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr
+InternalThreadBuiltinTopicDataDataReader_Narrow(::DDS::DataReader_ptr dr) {
+  return ::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader::_narrow(dr);
+}
+
+::DDS::ReturnCode_t
+InternalThreadBuiltinTopicDataDataReader_Read(::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr dr,
+                                              void *&receivedData, void *&receivedInfo, CORBA::Long maxSamples,
+                                              ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
+                                              ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  ::OpenDDS::DCPS::InternalThreadBuiltinTopicDataSeq received_data;
+  ::DDS::SampleInfoSeq info_seq;
+
+  ::DDS::ReturnCode_t ret = dr->read(received_data, info_seq, maxSamples, sampleStates, viewStates, instanceStates);
+  if (ret == ::DDS::RETCODE_OK) {
+    to_ptr(received_data, info_seq, receivedData);
+    unbounded_sequence_to_ptr(info_seq, receivedInfo);
+  }
+
+  dr->return_loan(received_data, info_seq);
+
+  return ret;
+}
+
+::DDS::ReturnCode_t
+InternalThreadBuiltinTopicDataDataReader_Take(::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr dr,
+                                              void *&receivedData, void *&receivedInfo, CORBA::Long maxSamples,
+                                              ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
+                                              ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  ::OpenDDS::DCPS::InternalThreadBuiltinTopicDataSeq received_data;
+  ::DDS::SampleInfoSeq info_seq;
+
+  ::DDS::ReturnCode_t ret = dr->take(received_data, info_seq, maxSamples, sampleStates, viewStates, instanceStates);
+  if (ret == ::DDS::RETCODE_OK) {
+    to_ptr(received_data, info_seq, receivedData);
+    unbounded_sequence_to_ptr(info_seq, receivedInfo);
+  }
+
+  dr->return_loan(received_data, info_seq);
+
+  return ret;
+}
+
+::DDS::ReturnCode_t
+InternalThreadBuiltinTopicDataDataReader_GetSnapshot(::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr dr,
+                                                     void *&receivedData) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  ::OpenDDS::DCPS::InternalThreadBuiltinTopicDataSeq received_data;
+  ::DDS::SampleInfoSeq info_seq;
+
+  // Non destructive read of every alive thread, only the most recent report of each one is kept.
+  ::DDS::ReturnCode_t ret = dr->read(received_data, info_seq, ::DDS::LENGTH_UNLIMITED, ::DDS::ANY_SAMPLE_STATE,
+                                     ::DDS::ANY_VIEW_STATE, ::DDS::ALIVE_INSTANCE_STATE);
+  if (ret == ::DDS::RETCODE_NO_DATA) {
+    TAO::unbounded_value_sequence<InternalThreadBuiltinTopicDataWrapper> empty;
+    unbounded_sequence_to_ptr(empty, receivedData);
+    return ::DDS::RETCODE_OK;
+  }
+
+  if (ret == ::DDS::RETCODE_OK) {
+    std::map<std::string, InternalThreadBuiltinTopicDataWrapper> latest;
+    for (CORBA::ULong i = 0; i < received_data.length(); i++) {
+      if (!info_seq[i].valid_data) {
+        continue;
+      }
+
+      InternalThreadBuiltinTopicDataWrapper status(received_data[i], info_seq[i]);
+      auto it = latest.find(status.thread_id);
+      if (it == latest.end()) {
+        latest.emplace(status.thread_id, status);
+      } else if (status.timestamp.sec > it->second.timestamp.sec ||
+                 (status.timestamp.sec == it->second.timestamp.sec &&
+                  status.timestamp.nanosec >= it->second.timestamp.nanosec)) {
+        it->second = status;
+      }
+    }
+
+    TAO::unbounded_value_sequence<InternalThreadBuiltinTopicDataWrapper> seq(static_cast<CORBA::ULong>(latest.size()));
+    seq.length(static_cast<CORBA::ULong>(latest.size()));
+    CORBA::ULong i = 0;
+    for (const auto &entry : latest) {
+      seq[i++] = entry.second;
+    }
+
+    unbounded_sequence_to_ptr(seq, receivedData);
+  }
+
+  dr->return_loan(received_data, info_seq);
+
+  return ret;
+}
@@ -0,0 +1,67 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include "Utils.h"
+#include "marshal.h"
+
+#include <ace/OS_NS_string.h>
+#include <dds/OpenddsDcpsExtTypeSupportImpl.h>
+
+#define INTERNAL_THREAD_ID_LENGTH 256
+
+EXTERN_STRUCT_EXPORT InternalThreadBuiltinTopicDataWrapper {
+    CORBA::Char thread_id[INTERNAL_THREAD_ID_LENGTH];
+    CORBA::Double utilization;
+    ::DDS::Time_t timestamp;
+
+public:
+    InternalThreadBuiltinTopicDataWrapper() = default;
+
+    InternalThreadBuiltinTopicDataWrapper(const ::OpenDDS::DCPS::InternalThreadBuiltinTopicData &native,
+                                          const ::DDS::SampleInfo &info) {
+      ACE_OS::strsncpy(thread_id, native.thread_id.in() ? native.thread_id.in() : "", INTERNAL_THREAD_ID_LENGTH);
+      utilization = native.utilization;
+      timestamp = info.source_timestamp;
+    }
+};
+
+EXTERN_METHOD_EXPORT
+::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr
+InternalThreadBuiltinTopicDataDataReader_Narrow(::DDS::DataReader_ptr dr);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t
+InternalThreadBuiltinTopicDataDataReader_Read(::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr dr,
+                                              void *&receivedData, void *&receivedInfo, CORBA::Long maxSamples,
+                                              ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
+                                              ::DDS::InstanceStateMask instanceStates);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t
+InternalThreadBuiltinTopicDataDataReader_Take(::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr dr,
+                                              void *&receivedData, void *&receivedInfo, CORBA::Long maxSamples,
+                                              ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
+                                              ::DDS::InstanceStateMask instanceStates);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t
+InternalThreadBuiltinTopicDataDataReader_GetSnapshot(::OpenDDS::DCPS::InternalThreadBuiltinTopicDataDataReader_ptr dr,
+                                                     void *&receivedData);
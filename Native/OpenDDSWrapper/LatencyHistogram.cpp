@@ -0,0 +1,40 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "LatencyHistogram.h"
+
+namespace {
+  latency_histogram_registry &latency_histogram_state() {
+    static latency_histogram_registry *state = []() {
+      latency_histogram_registry *s = new latency_histogram_registry();
+      latency_histogram::attach(s);
+      return s;
+    }();
+
+    return *state;
+  }
+}
+
+void *LatencyHistogram_GetState() {
+  return &latency_histogram_state();
+}
+
+void LatencyHistogram_Release(::DDS::DataReader_ptr dr) {
+  latency_histogram::release(&latency_histogram_state(), dr);
+}
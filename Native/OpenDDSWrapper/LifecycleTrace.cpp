@@ -0,0 +1,136 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "LifecycleTrace.h"
+
+#include <dds/DdsDcpsSubscriptionExtC.h>
+
+namespace {
+  lifecycle_state &lifecycle_trace_state() {
+    static lifecycle_state *state = []() {
+      lifecycle_state *s = new lifecycle_state();
+      lifecycle_trace::attach(s);
+      return s;
+    }();
+
+    return *state;
+  }
+
+  ACE_UINT64 seconds_to_nanoseconds(double seconds) {
+    return seconds > 0.0 ? static_cast<ACE_UINT64>(seconds * 1e9) : 0;
+  }
+
+  // The transport stage is measured by OpenDDS itself when the reader
+  // statistics are enabled, one entry per matched publication. It covers every
+  // sample received since the statistics were enabled or reset, read or not.
+  void transport_stats(::DDS::DataReader_ptr dr, LifecycleStageWrapper &stage) {
+    stage.count = 0;
+    stage.sum = 0;
+    stage.min = 0;
+    stage.max = 0;
+
+    ::OpenDDS::DCPS::DataReaderEx_var ex = ::OpenDDS::DCPS::DataReaderEx::_narrow(dr);
+    if (CORBA::is_nil(ex.in())) {
+      return;
+    }
+
+    ::OpenDDS::DCPS::LatencyStatisticsSeq stats;
+    ex->get_latency_stats(stats);
+
+    for (CORBA::ULong i = 0; i < stats.length(); ++i) {
+      if (stats[i].n == 0) {
+        continue;
+      }
+
+      const ACE_UINT64 min = seconds_to_nanoseconds(stats[i].minimum);
+      const ACE_UINT64 max = seconds_to_nanoseconds(stats[i].maximum);
+      stage.min = stage.count == 0 || min < stage.min ? min : stage.min;
+      stage.max = max > stage.max ? max : stage.max;
+      stage.count += stats[i].n;
+      stage.sum += seconds_to_nanoseconds(stats[i].mean * stats[i].n);
+    }
+  }
+}
+
+void *LifecycleTrace_GetState() {
+  return &lifecycle_trace_state();
+}
+
+CORBA::Boolean LifecycleTrace_Enable(::DDS::DataReader_ptr dr, CORBA::Boolean enabled) {
+  lifecycle_state *s = &lifecycle_trace_state();
+  ::OpenDDS::DCPS::DataReaderEx_var ex = ::OpenDDS::DCPS::DataReaderEx::_narrow(dr);
+
+  // The reader statistics may have been enabled by the user for other purposes,
+  // so the previous setting is kept in the slot and restored on disable.
+  lifecycle_slot *slot = lifecycle_trace::find(s, dr);
+  if (!enabled) {
+    if (slot && !CORBA::is_nil(ex.in())) {
+      ex->statistics_enabled(slot->statistics_enabled.load(std::memory_order_relaxed));
+    }
+
+    lifecycle_trace::enable(s, dr, false);
+    return true;
+  }
+
+  if (slot) {
+    return true;
+  }
+
+  if (!lifecycle_trace::enable(s, dr, true)) {
+    return false;
+  }
+
+  slot = lifecycle_trace::find(s, dr);
+  if (slot && !CORBA::is_nil(ex.in())) {
+    slot->statistics_enabled.store(ex->statistics_enabled(), std::memory_order_relaxed);
+    ex->statistics_enabled(true);
+  }
+
+  return true;
+}
+
+CORBA::Boolean LifecycleTrace_GetStatistics(::DDS::DataReader_ptr dr, LifecycleStageWrapper *stages) {
+  lifecycle_slot *slot = lifecycle_trace::find(&lifecycle_trace_state(), dr);
+  if (!slot) {
+    return false;
+  }
+
+  lifecycle_trace::snapshot(*slot, stages);
+  transport_stats(dr, stages[LIFECYCLE_STAGE_TRANSPORT]);
+
+  return true;
+}
+
+void LifecycleTrace_Reset(::DDS::DataReader_ptr dr) {
+  lifecycle_slot *slot = lifecycle_trace::find(&lifecycle_trace_state(), dr);
+  if (!slot) {
+    return;
+  }
+
+  lifecycle_trace::reset(*slot);
+
+  ::OpenDDS::DCPS::DataReaderEx_var ex = ::OpenDDS::DCPS::DataReaderEx::_narrow(dr);
+  if (!CORBA::is_nil(ex.in())) {
+    ex->reset_latency_stats();
+  }
+}
+
+void LifecycleTrace_Release(::DDS::DataReader_ptr dr) {
+  lifecycle_trace::release(&lifecycle_trace_state(), dr);
+}
@@ -40,6 +40,7 @@ char *MultiTopic_GetSubscriptionExpression(::DDS::MultiTopic_ptr t) {
 }
 
 ::DDS::ReturnCode_t MultiTopic_GetExpressionParameters(::DDS::MultiTopic_ptr t, void *&seq) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::StringSeq parameters;
 
   ::DDS::ReturnCode_t ret = t->get_expression_parameters(parameters);
@@ -57,11 +57,12 @@ void MulticastInst_SetPortOffset(::OpenDDS::DCPS::MulticastInst *mi, CORBA::USho
 }
 
 char *MulticastInst_GetGroupAddress(::OpenDDS::DCPS::MulticastInst *mi) {
+  ALLOC_ENTRY_SCOPE(__func__);
   const std::string addr_str = ::OpenDDS::DCPS::LogAddr(mi->group_address()).str();
   if (addr_str.empty()) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
-  return CORBA::string_dup(addr_str.c_str());
+  return ALLOC_STRING_DUP(addr_str.c_str());
 }
 
 void MulticastInst_SetGroupAddress(::OpenDDS::DCPS::MulticastInst *mi, char *value) {
@@ -70,11 +71,12 @@ void MulticastInst_SetGroupAddress(::OpenDDS::DCPS::MulticastInst *mi, char *val
 }
 
 char *MulticastInst_GetLocalAddress(::OpenDDS::DCPS::MulticastInst *mi) {
-  const char * addr = CORBA::string_dup(mi->local_address().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  const char * addr = ALLOC_STRING_DUP(mi->local_address().c_str());
   if (addr == NULL) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
-  return CORBA::string_dup(addr);
+  return ALLOC_STRING_DUP(addr);
 }
 
 void MulticastInst_SetLocalAddress(::OpenDDS::DCPS::MulticastInst *mi, char *value) {
@@ -26,6 +26,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 int ParticipantBuiltinTopicDataDataReader_ReadNextSample(::DDS::ParticipantBuiltinTopicDataDataReader_ptr dr,
                                                          ParticipantBuiltinTopicDataWrapper &data,
                                                          ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->read_next_sample(nativeData, *sampleInfo);
 
@@ -39,6 +40,7 @@ int ParticipantBuiltinTopicDataDataReader_ReadNextSample(::DDS::ParticipantBuilt
 int ParticipantBuiltinTopicDataDataReader_TakeNextSample(::DDS::ParticipantBuiltinTopicDataDataReader_ptr dr,
                                                          ParticipantBuiltinTopicDataWrapper &data,
                                                          ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->take_next_sample(nativeData, *sampleInfo);
   if (ret == ::DDS::RETCODE_OK) {
@@ -53,6 +55,7 @@ ParticipantBuiltinTopicDataDataReader_Read(::DDS::ParticipantBuiltinTopicDataDat
                                            void *&receivedInfo, CORBA::Long maxSamples,
                                            ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                            ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -77,6 +80,7 @@ ParticipantBuiltinTopicDataDataReader_Read(::DDS::ParticipantBuiltinTopicDataDat
 ParticipantBuiltinTopicDataDataReader_ReadWithCondition(::DDS::ParticipantBuiltinTopicDataDataReader_ptr dr,
                                                         void *&receivedData, void *&receivedInfo,
                                                         CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -102,6 +106,7 @@ ParticipantBuiltinTopicDataDataReader_Take(::DDS::ParticipantBuiltinTopicDataDat
                                            void *&receivedInfo, CORBA::Long maxSamples,
                                            ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                            ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take(received_data, info_seq, maxSamples, sampleStates, viewStates, instanceStates);
@@ -125,6 +130,7 @@ ParticipantBuiltinTopicDataDataReader_Take(::DDS::ParticipantBuiltinTopicDataDat
 ParticipantBuiltinTopicDataDataReader_TakeWithCondition(::DDS::ParticipantBuiltinTopicDataDataReader_ptr dr,
                                                         void *&receivedData, void *&receivedInfo,
                                                         CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -158,6 +164,7 @@ ParticipantBuiltinTopicDataDataReader_ReadInstance(::DDS::ParticipantBuiltinTopi
                                                    ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                    ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                                    ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -183,6 +190,7 @@ ParticipantBuiltinTopicDataDataReader_ReadInstanceWithCondition(::DDS::Participa
                                                                 void *&receivedData, void *&receivedInfo,
                                                                 ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                                 ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -209,6 +217,7 @@ ParticipantBuiltinTopicDataDataReader_TakeInstance(::DDS::ParticipantBuiltinTopi
                                                    ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                    ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                                    ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -234,6 +243,7 @@ ParticipantBuiltinTopicDataDataReader_TakeInstanceWithCondition(::DDS::Participa
                                                                 void *&receivedData, void *&receivedInfo,
                                                                 ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                                 ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -261,6 +271,7 @@ ParticipantBuiltinTopicDataDataReader_ReadNextInstance(::DDS::ParticipantBuiltin
                                                        ::DDS::SampleStateMask sampleStates,
                                                        ::DDS::ViewStateMask viewStates,
                                                        ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -287,6 +298,7 @@ ParticipantBuiltinTopicDataDataReader_ReadNextInstanceWithCondition(::DDS::Parti
                                                                     ::DDS::InstanceHandle_t handle,
                                                                     CORBA::Long maxSamples,
                                                                     ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -313,6 +325,7 @@ ParticipantBuiltinTopicDataDataReader_TakeNextInstance(::DDS::ParticipantBuiltin
                                                        ::DDS::SampleStateMask sampleStates,
                                                        ::DDS::ViewStateMask viewStates,
                                                        ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -339,6 +352,7 @@ ParticipantBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(::DDS::Parti
                                                                     ::DDS::InstanceHandle_t handle,
                                                                     CORBA::Long maxSamples,
                                                                     ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -360,6 +374,7 @@ ParticipantBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(::DDS::Parti
 
 int ParticipantBuiltinTopicDataDataReader_GetKeyValue(::DDS::ParticipantBuiltinTopicDataDataReader_ptr dr,
                                                       ParticipantBuiltinTopicDataWrapper &data, int handle) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ParticipantBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->get_key_value(nativeData, handle);
 
@@ -33,7 +33,8 @@ void ParticipantService_AddDiscovery(::OpenDDS::DCPS::Discovery *discovery) {
 }
 
 char *ParticipantService_GetDefaultDiscovery() {
-  return CORBA::string_dup(TheServiceParticipant->get_default_discovery().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(TheServiceParticipant->get_default_discovery().c_str());
 }
 
 void ParticipantService_SetDefaultDiscovery(char *defaultDiscovery) {
@@ -50,4 +51,12 @@ void ParticipantService_SetRepoDomain(int domain, char *repo, bool attach_partic
 
 bool ParticipantService_GetIsShutdown() {
   return TheServiceParticipant->is_shut_down();
-}
\ No newline at end of file
+}
+
+TimeValueWrapper ParticipantService_GetPendingTimeout() {
+  return TheServiceParticipant->pending_timeout();
+}
+
+void ParticipantService_SetPendingTimeout(TimeValueWrapper value) {
+  TheServiceParticipant->pending_timeout(value);
+}
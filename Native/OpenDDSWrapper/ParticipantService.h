@@ -20,6 +20,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Utils.h"
+#include "TimeValueWrapper.h"
 
 #include <dds/DCPS/Service_Participant.h>
 
@@ -45,4 +46,10 @@ EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t ParticipantService_Shutdown();
 
 EXTERN_METHOD_EXPORT
-bool ParticipantService_GetIsShutdown();
\ No newline at end of file
+bool ParticipantService_GetIsShutdown();
+
+EXTERN_METHOD_EXPORT
+TimeValueWrapper ParticipantService_GetPendingTimeout();
+
+EXTERN_METHOD_EXPORT
+void ParticipantService_SetPendingTimeout(TimeValueWrapper value);
@@ -26,6 +26,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 int PublicationBuiltinTopicDataDataReader_ReadNextSample(::DDS::PublicationBuiltinTopicDataDataReader_ptr dr,
                                                          PublicationBuiltinTopicDataWrapper &data,
                                                          ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->read_next_sample(nativeData, *sampleInfo);
 
@@ -39,6 +40,7 @@ int PublicationBuiltinTopicDataDataReader_ReadNextSample(::DDS::PublicationBuilt
 int PublicationBuiltinTopicDataDataReader_TakeNextSample(::DDS::PublicationBuiltinTopicDataDataReader_ptr dr,
                                                          PublicationBuiltinTopicDataWrapper &data,
                                                          ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->take_next_sample(nativeData, *sampleInfo);
   if (ret == ::DDS::RETCODE_OK) {
@@ -53,6 +55,7 @@ PublicationBuiltinTopicDataDataReader_Read(::DDS::PublicationBuiltinTopicDataDat
                                            void *&receivedInfo, CORBA::Long maxSamples,
                                            ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                            ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -77,6 +80,7 @@ PublicationBuiltinTopicDataDataReader_Read(::DDS::PublicationBuiltinTopicDataDat
 PublicationBuiltinTopicDataDataReader_ReadWithCondition(::DDS::PublicationBuiltinTopicDataDataReader_ptr dr,
                                                         void *&receivedData, void *&receivedInfo,
                                                         CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -102,6 +106,7 @@ PublicationBuiltinTopicDataDataReader_Take(::DDS::PublicationBuiltinTopicDataDat
                                            void *&receivedInfo, CORBA::Long maxSamples,
                                            ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                            ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take(received_data, info_seq, maxSamples, sampleStates, viewStates, instanceStates);
@@ -125,6 +130,7 @@ PublicationBuiltinTopicDataDataReader_Take(::DDS::PublicationBuiltinTopicDataDat
 PublicationBuiltinTopicDataDataReader_TakeWithCondition(::DDS::PublicationBuiltinTopicDataDataReader_ptr dr,
                                                         void *&receivedData, void *&receivedInfo,
                                                         CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -158,6 +164,7 @@ PublicationBuiltinTopicDataDataReader_ReadInstance(::DDS::PublicationBuiltinTopi
                                                    ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                    ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                                    ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -183,6 +190,7 @@ PublicationBuiltinTopicDataDataReader_ReadInstanceWithCondition(::DDS::Publicati
                                                                 void *&receivedData, void *&receivedInfo,
                                                                 ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                                 ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -209,6 +217,7 @@ PublicationBuiltinTopicDataDataReader_TakeInstance(::DDS::PublicationBuiltinTopi
                                                    ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                    ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                                    ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -234,6 +243,7 @@ PublicationBuiltinTopicDataDataReader_TakeInstanceWithCondition(::DDS::Publicati
                                                                 void *&receivedData, void *&receivedInfo,
                                                                 ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                                 ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -261,6 +271,7 @@ PublicationBuiltinTopicDataDataReader_ReadNextInstance(::DDS::PublicationBuiltin
                                                        ::DDS::SampleStateMask sampleStates,
                                                        ::DDS::ViewStateMask viewStates,
                                                        ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -287,6 +298,7 @@ PublicationBuiltinTopicDataDataReader_ReadNextInstanceWithCondition(::DDS::Publi
                                                                     ::DDS::InstanceHandle_t handle,
                                                                     CORBA::Long maxSamples,
                                                                     ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -313,6 +325,7 @@ PublicationBuiltinTopicDataDataReader_TakeNextInstance(::DDS::PublicationBuiltin
                                                        ::DDS::SampleStateMask sampleStates,
                                                        ::DDS::ViewStateMask viewStates,
                                                        ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -339,6 +352,7 @@ PublicationBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(::DDS::Publi
                                                                     ::DDS::InstanceHandle_t handle,
                                                                     CORBA::Long maxSamples,
                                                                     ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -360,6 +374,7 @@ PublicationBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(::DDS::Publi
 
 int PublicationBuiltinTopicDataDataReader_GetKeyValue(::DDS::PublicationBuiltinTopicDataDataReader_ptr dr,
                                                       PublicationBuiltinTopicDataWrapper &data, int handle) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublicationBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->get_key_value(nativeData, handle);
 
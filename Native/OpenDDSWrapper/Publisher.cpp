@@ -31,7 +31,21 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
   return pub->create_datawriter(topic, qos, a_listener, mask);
 }
 
+::DDS::DataWriter_ptr Publisher_CreateDataWriterWithProfile(::DDS::Publisher_ptr pub,
+                                                            ::DDS::Topic_ptr topic,
+                                                            OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile,
+                                                            OpenDDSharp::OpenDDS::DDS::DataWriterListenerImpl_ptr a_listener,
+                                                            ::DDS::StatusMask mask) {
+  std::shared_ptr<const ::DDS::DataWriterQos> qos = profile->datawriter_qos();
+  if (!qos) {
+    return pub->create_datawriter(topic, DATAWRITER_QOS_DEFAULT, a_listener, mask);
+  }
+
+  return pub->create_datawriter(topic, *qos, a_listener, mask);
+}
+
 ::DDS::ReturnCode_t Publisher_GetDefaultDataWriterQos(::DDS::Publisher_ptr pub, DataWriterQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DataWriterQos qos_native;
   ::DDS::ReturnCode_t ret = pub->get_default_datawriter_qos(qos_native);
 
@@ -47,6 +61,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 }
 
 ::DDS::ReturnCode_t Publisher_GetQos(::DDS::Publisher_ptr pub, PublisherQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::PublisherQos qos_native;
   ::DDS::ReturnCode_t ret = pub->get_qos(qos_native);
 
@@ -21,6 +21,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Utils.h"
 #include "QosPolicies.h"
+#include "QosProfile.h"
 #include "PublisherListenerImpl.h"
 #include "DataWriterListenerImpl.h"
 
@@ -36,6 +37,13 @@ EXTERN_METHOD_EXPORT
                                                  OpenDDSharp::OpenDDS::DDS::DataWriterListenerImpl_ptr a_listener,
                                                  ::DDS::StatusMask mask);
 
+EXTERN_METHOD_EXPORT
+::DDS::DataWriter_ptr Publisher_CreateDataWriterWithProfile(::DDS::Publisher_ptr pub,
+                                                            ::DDS::Topic_ptr topic,
+                                                            OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile,
+                                                            OpenDDSharp::OpenDDS::DDS::DataWriterListenerImpl_ptr a_listener,
+                                                            ::DDS::StatusMask mask);
+
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t Publisher_GetQos(::DDS::Publisher_ptr pub, PublisherQosWrapper &qos_wrapper);
 
@@ -0,0 +1,175 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "QosProfile.h"
+
+std::shared_ptr<const ::DDS::TopicQos> OpenDDSharp::OpenDDS::DDS::QosProfile::topic_qos() {
+  ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+  return _topic_qos;
+}
+
+::DDS::ReturnCode_t OpenDDSharp::OpenDDS::DDS::QosProfile::topic_qos(const ::DDS::TopicQos &qos) {
+  if (!::OpenDDS::DCPS::Qos_Helper::valid(qos)) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  if (!::OpenDDS::DCPS::Qos_Helper::consistent(qos)) {
+    return ::DDS::RETCODE_INCONSISTENT_POLICY;
+  }
+
+  std::shared_ptr<const ::DDS::TopicQos> snapshot = std::make_shared<const ::DDS::TopicQos>(qos);
+
+  ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+  _topic_qos.swap(snapshot);
+
+  return ::DDS::RETCODE_OK;
+}
+
+std::shared_ptr<const ::DDS::DataWriterQos> OpenDDSharp::OpenDDS::DDS::QosProfile::datawriter_qos() {
+  ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+  return _datawriter_qos;
+}
+
+::DDS::ReturnCode_t OpenDDSharp::OpenDDS::DDS::QosProfile::datawriter_qos(const ::DDS::DataWriterQos &qos) {
+  if (!::OpenDDS::DCPS::Qos_Helper::valid(qos)) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  if (!::OpenDDS::DCPS::Qos_Helper::consistent(qos)) {
+    return ::DDS::RETCODE_INCONSISTENT_POLICY;
+  }
+
+  std::shared_ptr<const ::DDS::DataWriterQos> snapshot = std::make_shared<const ::DDS::DataWriterQos>(qos);
+
+  ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+  _datawriter_qos.swap(snapshot);
+
+  return ::DDS::RETCODE_OK;
+}
+
+std::shared_ptr<const ::DDS::DataReaderQos> OpenDDSharp::OpenDDS::DDS::QosProfile::datareader_qos() {
+  ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+  return _datareader_qos;
+}
+
+::DDS::ReturnCode_t OpenDDSharp::OpenDDS::DDS::QosProfile::datareader_qos(const ::DDS::DataReaderQos &qos) {
+  if (!::OpenDDS::DCPS::Qos_Helper::valid(qos)) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  if (!::OpenDDS::DCPS::Qos_Helper::consistent(qos)) {
+    return ::DDS::RETCODE_INCONSISTENT_POLICY;
+  }
+
+  std::shared_ptr<const ::DDS::DataReaderQos> snapshot = std::make_shared<const ::DDS::DataReaderQos>(qos);
+
+  ACE_Guard<ACE_Thread_Mutex> guard(_lock);
+  _datareader_qos.swap(snapshot);
+
+  return ::DDS::RETCODE_OK;
+}
+
+OpenDDSharp::OpenDDS::DDS::QosProfile_ptr QosProfile_New() {
+  return new OpenDDSharp::OpenDDS::DDS::QosProfile();
+}
+
+void QosProfile_Delete(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile) {
+  delete profile;
+}
+
+::DDS::ReturnCode_t QosProfile_GetTopicQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, TopicQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  std::shared_ptr<const ::DDS::TopicQos> qos = profile->topic_qos();
+  if (!qos) {
+    return ::DDS::RETCODE_NO_DATA;
+  }
+
+  qos_wrapper = *qos;
+
+  return ::DDS::RETCODE_OK;
+}
+
+::DDS::ReturnCode_t QosProfile_SetTopicQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, TopicQosWrapper qos_wrapper) {
+  return profile->topic_qos(qos_wrapper);
+}
+
+::DDS::ReturnCode_t QosProfile_GetDataWriterQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataWriterQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  std::shared_ptr<const ::DDS::DataWriterQos> qos = profile->datawriter_qos();
+  if (!qos) {
+    return ::DDS::RETCODE_NO_DATA;
+  }
+
+  qos_wrapper = *qos;
+
+  return ::DDS::RETCODE_OK;
+}
+
+::DDS::ReturnCode_t QosProfile_SetDataWriterQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataWriterQosWrapper qos_wrapper) {
+  return profile->datawriter_qos(qos_wrapper);
+}
+
+::DDS::ReturnCode_t QosProfile_GetDataReaderQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataReaderQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  std::shared_ptr<const ::DDS::DataReaderQos> qos = profile->datareader_qos();
+  if (!qos) {
+    return ::DDS::RETCODE_NO_DATA;
+  }
+
+  qos_wrapper = *qos;
+
+  return ::DDS::RETCODE_OK;
+}
+
+::DDS::ReturnCode_t QosProfile_SetDataReaderQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataReaderQosWrapper qos_wrapper) {
+  return profile->datareader_qos(qos_wrapper);
+}
+
+::DDS::ReturnCode_t QosProfile_CopyFromTopic(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, ::DDS::Topic_ptr topic) {
+  ::DDS::TopicQos qos_native;
+  ::DDS::ReturnCode_t ret = topic->get_qos(qos_native);
+
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = profile->topic_qos(qos_native);
+  }
+
+  return ret;
+}
+
+::DDS::ReturnCode_t QosProfile_CopyFromDataWriter(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, ::DDS::DataWriter_ptr dw) {
+  ::DDS::DataWriterQos qos_native;
+  ::DDS::ReturnCode_t ret = dw->get_qos(qos_native);
+
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = profile->datawriter_qos(qos_native);
+  }
+
+  return ret;
+}
+
+::DDS::ReturnCode_t QosProfile_CopyFromDataReader(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, ::DDS::DataReader_ptr dr) {
+  ::DDS::DataReaderQos qos_native;
+  ::DDS::ReturnCode_t ret = dr->get_qos(qos_native);
+
+  if (ret == ::DDS::RETCODE_OK) {
+    ret = profile->datareader_qos(qos_native);
+  }
+
+  return ret;
+}
@@ -0,0 +1,92 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include "Utils.h"
+#include "QosPolicies.h"
+
+#include <memory>
+#include <dds/DCPS/Qos_Helper.h>
+
+namespace OpenDDSharp {
+    namespace OpenDDS {
+        namespace DDS {
+
+            // Holds the QoS policies converted once from the wrapper structs. Each policy set is kept as an
+            // immutable snapshot and the setters replace it (copy-on-write), so the entity creation only takes a reference.
+            class QosProfile {
+            private:
+                ACE_Thread_Mutex _lock;
+                std::shared_ptr<const ::DDS::TopicQos> _topic_qos;
+                std::shared_ptr<const ::DDS::DataWriterQos> _datawriter_qos;
+                std::shared_ptr<const ::DDS::DataReaderQos> _datareader_qos;
+
+            public:
+                std::shared_ptr<const ::DDS::TopicQos> topic_qos();
+
+                ::DDS::ReturnCode_t topic_qos(const ::DDS::TopicQos &qos);
+
+                std::shared_ptr<const ::DDS::DataWriterQos> datawriter_qos();
+
+                ::DDS::ReturnCode_t datawriter_qos(const ::DDS::DataWriterQos &qos);
+
+                std::shared_ptr<const ::DDS::DataReaderQos> datareader_qos();
+
+                ::DDS::ReturnCode_t datareader_qos(const ::DDS::DataReaderQos &qos);
+            };
+
+            typedef OpenDDSharp::OpenDDS::DDS::QosProfile *QosProfile_ptr;
+
+        };
+    };
+};
+
+EXTERN_METHOD_EXPORT
+OpenDDSharp::OpenDDS::DDS::QosProfile_ptr QosProfile_New();
+
+EXTERN_METHOD_EXPORT
+void QosProfile_Delete(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_GetTopicQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, TopicQosWrapper &qos_wrapper);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_SetTopicQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, TopicQosWrapper qos_wrapper);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_GetDataWriterQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataWriterQosWrapper &qos_wrapper);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_SetDataWriterQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataWriterQosWrapper qos_wrapper);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_GetDataReaderQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataReaderQosWrapper &qos_wrapper);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_SetDataReaderQos(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, DataReaderQosWrapper qos_wrapper);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_CopyFromTopic(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, ::DDS::Topic_ptr topic);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_CopyFromDataWriter(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, ::DDS::DataWriter_ptr dw);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t QosProfile_CopyFromDataReader(OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile, ::DDS::DataReader_ptr dr);
@@ -28,6 +28,7 @@ char *QueryCondition_GetQueryExpresion(::DDS::QueryCondition_ptr ptr) {
 }
 
 ::DDS::ReturnCode_t QueryCondition_GetQueryParameters(::DDS::QueryCondition_ptr ptr, void *&seq) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::StringSeq parameters;
 
   ::DDS::ReturnCode_t ret = ptr->get_query_parameters(parameters);
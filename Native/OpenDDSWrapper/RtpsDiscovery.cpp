@@ -92,12 +92,13 @@ void RtpsDiscovery_SetTtl(::OpenDDS::RTPS::RtpsDiscovery *d, CORBA::Octet value)
 }
 
 char *RtpsDiscovery_GetSedpLocalAddress(::OpenDDS::RTPS::RtpsDiscovery *d) {
+  ALLOC_ENTRY_SCOPE(__func__);
   const std::string addr_str = ::OpenDDS::DCPS::LogAddr(d->sedp_local_address()).str();
   if (addr_str.empty()) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
 
-  return CORBA::string_dup(addr_str.c_str());
+  return ALLOC_STRING_DUP(addr_str.c_str());
 }
 
 void RtpsDiscovery_SetSedpLocalAddress(::OpenDDS::RTPS::RtpsDiscovery *d, char *value) {
@@ -106,12 +107,13 @@ void RtpsDiscovery_SetSedpLocalAddress(::OpenDDS::RTPS::RtpsDiscovery *d, char *
 }
 
 char *RtpsDiscovery_GetSpdpLocalAddress(::OpenDDS::RTPS::RtpsDiscovery *d) {
+  ALLOC_ENTRY_SCOPE(__func__);
   const std::string addr_str = ::OpenDDS::DCPS::LogAddr(d->spdp_local_address()).str();
   if (addr_str.empty()) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
 
-  return CORBA::string_dup(addr_str.c_str());
+  return ALLOC_STRING_DUP(addr_str.c_str());
 }
 
 void RtpsDiscovery_SetSpdpLocalAddress(::OpenDDS::RTPS::RtpsDiscovery *d, char *value) {
@@ -128,7 +130,8 @@ void RtpsDiscovery_SetSedpMulticast(::OpenDDS::RTPS::RtpsDiscovery *d, CORBA::Bo
 }
 
 char *RtpsDiscovery_GetMulticastInterface(::OpenDDS::RTPS::RtpsDiscovery *d) {
-  return CORBA::string_dup(d->multicast_interface().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(d->multicast_interface().c_str());
 }
 
 void RtpsDiscovery_SetMulticastInterface(::OpenDDS::RTPS::RtpsDiscovery *d, char *value) {
@@ -136,12 +139,13 @@ void RtpsDiscovery_SetMulticastInterface(::OpenDDS::RTPS::RtpsDiscovery *d, char
 }
 
 char *RtpsDiscovery_GetDefaultMulticastGroup(::OpenDDS::RTPS::RtpsDiscovery *d, int domain_id) {
+  ALLOC_ENTRY_SCOPE(__func__);
   const std::string addr_str = ::OpenDDS::DCPS::LogAddr(d->default_multicast_group(domain_id)).str();
   if (addr_str.empty()) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
 
-  return CORBA::string_dup(addr_str.c_str());
+  return ALLOC_STRING_DUP(addr_str.c_str());
 }
 
 void RtpsDiscovery_SetDefaultMulticastGroup(::OpenDDS::RTPS::RtpsDiscovery *d, char *value) {
@@ -150,6 +154,7 @@ void RtpsDiscovery_SetDefaultMulticastGroup(::OpenDDS::RTPS::RtpsDiscovery *d, c
 }
 
 void *RtpsDiscovery_GetSpdpSendAddrs(::OpenDDS::RTPS::RtpsDiscovery *d) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::OpenDDS::DCPS::NetworkAddressSet addrs = d->spdp_send_addrs();
 
   size_t size = addrs.size();
@@ -168,9 +173,71 @@ void *RtpsDiscovery_GetSpdpSendAddrs(::OpenDDS::RTPS::RtpsDiscovery *d) {
 }
 
 char *RtpsDiscovery_GetGuidInterface(::OpenDDS::RTPS::RtpsDiscovery *d) {
-  return CORBA::string_dup(d->guid_interface().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(d->guid_interface().c_str());
 }
 
 void RtpsDiscovery_SetGuidInterface(::OpenDDS::RTPS::RtpsDiscovery *d, char *value) {
   d->guid_interface(value);
-}
\ No newline at end of file
+}
+
+void RtpsDiscovery_AddSpdpSendAddrs(::OpenDDS::RTPS::RtpsDiscovery *d, void *addrs) {
+  TAO::unbounded_basic_string_sequence<char> seq;
+  ptr_to_unbounded_basic_string_sequence(addrs, seq);
+
+  // Addresses already configured are kept, the set removes the duplicated ones.
+  ::OpenDDS::DCPS::NetworkAddressSet send_addrs = d->config()->spdp_send_addrs();
+  for (CORBA::ULong i = 0; i < seq.length(); i++) {
+    ACE_INET_Addr addr;
+    if (addr.set(seq[i]) != 0) {
+      ACE_ERROR((LM_WARNING, ACE_TEXT("(%P|%t) WARNING: RtpsDiscovery_AddSpdpSendAddrs: cannot parse address %C\n"), seq[i].in()));
+      continue;
+    }
+
+    send_addrs.insert(::OpenDDS::DCPS::NetworkAddress(addr));
+  }
+
+  d->config()->spdp_send_addrs(send_addrs);
+}
+
+void *RtpsDiscovery_GetParticipantLocators(::DDS::DomainParticipant_ptr dp) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  TAO::unbounded_basic_string_sequence<char> seq;
+
+#ifndef DDS_HAS_MINIMUM_BIT
+  ::DDS::Subscriber_var bit_subscriber = dp->get_builtin_subscriber();
+  if (!CORBA::is_nil(bit_subscriber.in())) {
+    ::DDS::DataReader_var reader = bit_subscriber->lookup_datareader(::OpenDDS::DCPS::BUILT_IN_PARTICIPANT_LOCATION_TOPIC);
+    ::OpenDDS::DCPS::ParticipantLocationBuiltinTopicDataDataReader_var location_reader =
+      ::OpenDDS::DCPS::ParticipantLocationBuiltinTopicDataDataReader::_narrow(reader.in());
+
+    if (!CORBA::is_nil(location_reader.in())) {
+      ::OpenDDS::DCPS::ParticipantLocationBuiltinTopicDataSeq data;
+      ::DDS::SampleInfoSeq infos;
+      // Read without taking so the application can still consume the location samples.
+      if (location_reader->read(data, infos, ::DDS::LENGTH_UNLIMITED, ::DDS::ANY_SAMPLE_STATE, ::DDS::ANY_VIEW_STATE, ::DDS::ALIVE_INSTANCE_STATE) == ::DDS::RETCODE_OK) {
+        std::set<std::string> locators;
+        for (CORBA::ULong i = 0; i < data.length(); i++) {
+          if (infos[i].valid_data && (data[i].location & ::OpenDDS::DCPS::LOCATION_LOCAL) && data[i].local_addr.in()[0] != '\0') {
+            locators.insert(data[i].local_addr.in());
+          }
+        }
+        location_reader->return_loan(data, infos);
+
+        seq.length(static_cast<CORBA::ULong>(locators.size()));
+        CORBA::ULong i = 0;
+        for (const std::string &locator : locators) {
+          seq[i++] = locator.c_str();
+        }
+      }
+    }
+  }
+#else
+  ACE_UNUSED_ARG(dp);
+#endif
+
+  void *ptr;
+  unbounded_basic_string_sequence_to_ptr(seq, ptr);
+
+  return ptr;
+}
@@ -26,6 +26,9 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include <dds/DCPS/RTPS/RtpsDiscovery.h>
 #include <dds/DCPS/transport/rtps_udp/RtpsUdp.h>
 #include <dds/DCPS/LogAddr.h>
+#include <dds/DCPS/BuiltInTopicUtils.h>
+#include <dds/OpenddsDcpsExtTypeSupportImpl.h>
+#include <set>
 #include <string>
 
 EXTERN_METHOD_EXPORT
@@ -120,3 +123,9 @@ char *RtpsDiscovery_GetGuidInterface(::OpenDDS::RTPS::RtpsDiscovery *d);
 
 EXTERN_METHOD_EXPORT
 void RtpsDiscovery_SetGuidInterface(::OpenDDS::RTPS::RtpsDiscovery *d, char *value);
+
+EXTERN_METHOD_EXPORT
+void RtpsDiscovery_AddSpdpSendAddrs(::OpenDDS::RTPS::RtpsDiscovery *d, void *addrs);
+
+EXTERN_METHOD_EXPORT
+void *RtpsDiscovery_GetParticipantLocators(::DDS::DomainParticipant_ptr dp);
@@ -77,12 +77,13 @@ void RtpsUdpInst_SetTtl(::OpenDDS::DCPS::RtpsUdpInst *ri, CORBA::Octet value) {
 }
 
 char *RtpsUdpInst_GetMulticastGroupAddress(::OpenDDS::DCPS::RtpsUdpInst *ri, int domain_id) {
+  ALLOC_ENTRY_SCOPE(__func__);
   const std::string addr_str = ::OpenDDS::DCPS::LogAddr(ri->multicast_group_address(domain_id)).str();
   if (addr_str.empty()) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
 
-  return CORBA::string_dup(addr_str.c_str());
+  return ALLOC_STRING_DUP(addr_str.c_str());
 }
 
 void RtpsUdpInst_SetMulticastGroupAddress(::OpenDDS::DCPS::RtpsUdpInst *ri, char *value) {
@@ -91,7 +92,8 @@ void RtpsUdpInst_SetMulticastGroupAddress(::OpenDDS::DCPS::RtpsUdpInst *ri, char
 }
 
 char *RtpsUdpInst_GetMulticastInterface(::OpenDDS::DCPS::RtpsUdpInst *ri) {
-  return CORBA::string_dup(ri->multicast_interface().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(ri->multicast_interface().c_str());
 }
 
 void RtpsUdpInst_SetMulticastInterface(::OpenDDS::DCPS::RtpsUdpInst *ri, char *value) {
@@ -99,11 +101,12 @@ void RtpsUdpInst_SetMulticastInterface(::OpenDDS::DCPS::RtpsUdpInst *ri, char *v
 }
 
 char *RtpsUdpInst_GetLocalAddress(::OpenDDS::DCPS::RtpsUdpInst *ri) {
+  ALLOC_ENTRY_SCOPE(__func__);
   const std::string addr_str = ::OpenDDS::DCPS::LogAddr(ri->local_address()).str();
   if (addr_str.empty()) {
-    return CORBA::string_dup("");
+    return ALLOC_STRING_DUP("");
   }
-  return CORBA::string_dup(addr_str.c_str());
+  return ALLOC_STRING_DUP(addr_str.c_str());
 }
 
 void RtpsUdpInst_SetLocalAddress(::OpenDDS::DCPS::RtpsUdpInst *ri, char *value) {
@@ -133,4 +136,44 @@ TimeValueWrapper RtpsUdpInst_GetReceiveAddressDuration(::OpenDDS::DCPS::RtpsUdpI
 
 void RtpsUdpInst_SetReceiveAddressDuration(::OpenDDS::DCPS::RtpsUdpInst *ri, TimeValueWrapper value) {
   ri->receive_address_duration(value);
-}
\ No newline at end of file
+}
+
+size_t RtpsUdpInst_GetMaxMessageSize(::OpenDDS::DCPS::RtpsUdpInst *ri) {
+  return ri->max_message_size();
+}
+
+void RtpsUdpInst_SetMaxMessageSize(::OpenDDS::DCPS::RtpsUdpInst *ri, size_t value) {
+  ri->max_message_size(value);
+}
+
+size_t RtpsUdpInst_GetAnticipatedFragments(::OpenDDS::DCPS::RtpsUdpInst *ri) {
+  return ri->anticipated_fragments();
+}
+
+void RtpsUdpInst_SetAnticipatedFragments(::OpenDDS::DCPS::RtpsUdpInst *ri, size_t value) {
+  ri->anticipated_fragments(value);
+}
+
+CORBA::Boolean RtpsUdpInst_GetResponsiveMode(::OpenDDS::DCPS::RtpsUdpInst *ri) {
+  return ri->responsive_mode();
+}
+
+void RtpsUdpInst_SetResponsiveMode(::OpenDDS::DCPS::RtpsUdpInst *ri, CORBA::Boolean value) {
+  ri->responsive_mode(value);
+}
+
+TimeValueWrapper RtpsUdpInst_GetSendDelay(::OpenDDS::DCPS::RtpsUdpInst *ri) {
+  return ri->send_delay();
+}
+
+void RtpsUdpInst_SetSendDelay(::OpenDDS::DCPS::RtpsUdpInst *ri, TimeValueWrapper value) {
+  ri->send_delay(value);
+}
+
+CORBA::Boolean RtpsUdpInst_GetCountMessages(::OpenDDS::DCPS::RtpsUdpInst *ri) {
+  return ri->count_messages();
+}
+
+void RtpsUdpInst_SetCountMessages(::OpenDDS::DCPS::RtpsUdpInst *ri, CORBA::Boolean value) {
+  ri->count_messages(value);
+}
@@ -102,3 +102,33 @@ TimeValueWrapper RtpsUdpInst_GetReceiveAddressDuration(::OpenDDS::DCPS::RtpsUdpI
 
 EXTERN_METHOD_EXPORT
 void RtpsUdpInst_SetReceiveAddressDuration(::OpenDDS::DCPS::RtpsUdpInst *ri, TimeValueWrapper value);
+
+EXTERN_METHOD_EXPORT
+size_t RtpsUdpInst_GetMaxMessageSize(::OpenDDS::DCPS::RtpsUdpInst *ri);
+
+EXTERN_METHOD_EXPORT
+void RtpsUdpInst_SetMaxMessageSize(::OpenDDS::DCPS::RtpsUdpInst *ri, size_t value);
+
+EXTERN_METHOD_EXPORT
+size_t RtpsUdpInst_GetAnticipatedFragments(::OpenDDS::DCPS::RtpsUdpInst *ri);
+
+EXTERN_METHOD_EXPORT
+void RtpsUdpInst_SetAnticipatedFragments(::OpenDDS::DCPS::RtpsUdpInst *ri, size_t value);
+
+EXTERN_METHOD_EXPORT
+CORBA::Boolean RtpsUdpInst_GetResponsiveMode(::OpenDDS::DCPS::RtpsUdpInst *ri);
+
+EXTERN_METHOD_EXPORT
+void RtpsUdpInst_SetResponsiveMode(::OpenDDS::DCPS::RtpsUdpInst *ri, CORBA::Boolean value);
+
+EXTERN_METHOD_EXPORT
+TimeValueWrapper RtpsUdpInst_GetSendDelay(::OpenDDS::DCPS::RtpsUdpInst *ri);
+
+EXTERN_METHOD_EXPORT
+void RtpsUdpInst_SetSendDelay(::OpenDDS::DCPS::RtpsUdpInst *ri, TimeValueWrapper value);
+
+EXTERN_METHOD_EXPORT
+CORBA::Boolean RtpsUdpInst_GetCountMessages(::OpenDDS::DCPS::RtpsUdpInst *ri);
+
+EXTERN_METHOD_EXPORT
+void RtpsUdpInst_SetCountMessages(::OpenDDS::DCPS::RtpsUdpInst *ri, CORBA::Boolean value);
@@ -49,9 +49,15 @@ void ShmemInst_SetDatalinkControlSize(::OpenDDS::DCPS::ShmemInst *si, size_t val
 }
 
 char *ShmemInst_GetHostName(::OpenDDS::DCPS::ShmemInst *si) {
-  return CORBA::string_dup(si->hostname().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(si->hostname().c_str());
+}
+
+void ShmemInst_SetHostName(::OpenDDS::DCPS::ShmemInst *si, const char *value) {
+  si->hostname(value);
 }
 
 char *ShmemInst_GetPoolName(::OpenDDS::DCPS::ShmemInst *si) {
-  return CORBA::string_dup(si->poolname().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(si->poolname().c_str());
 }
\ No newline at end of file
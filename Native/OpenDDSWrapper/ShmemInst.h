@@ -47,5 +47,8 @@ void ShmemInst_SetDatalinkControlSize(::OpenDDS::DCPS::ShmemInst *si, size_t val
 EXTERN_METHOD_EXPORT
 char *ShmemInst_GetHostName(::OpenDDS::DCPS::ShmemInst *si);
 
+EXTERN_METHOD_EXPORT
+void ShmemInst_SetHostName(::OpenDDS::DCPS::ShmemInst *si, const char *value);
+
 EXTERN_METHOD_EXPORT
 char *ShmemInst_GetPoolName(::OpenDDS::DCPS::ShmemInst *si);
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "StaticDiscovery.h"
+
+::OpenDDS::DCPS::Discovery *StaticDiscovery_NarrowBase(::OpenDDS::DCPS::StaticDiscovery *d) {
+  return static_cast< ::OpenDDS::DCPS::Discovery *>(d);
+}
+
+::OpenDDS::DCPS::StaticDiscovery *StaticDiscovery_GetInstance() {
+  return ::OpenDDS::DCPS::StaticDiscovery::instance().in();
+}
+
+ACE_Configuration_Heap *StaticDiscovery_NewConfiguration() {
+  ACE_Configuration_Heap *cf = new ACE_Configuration_Heap();
+  if (cf->open() != 0) {
+    delete cf;
+    return nullptr;
+  }
+
+  return cf;
+}
+
+void StaticDiscovery_DeleteConfiguration(ACE_Configuration_Heap *cf) {
+  delete cf;
+}
+
+::DDS::ReturnCode_t StaticDiscovery_SetConfigurationValue(ACE_Configuration_Heap *cf, const char *section, const char *key, const char *value) {
+  if (cf == nullptr || section == nullptr || key == nullptr || value == nullptr) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  // Sections like "endpoint/MyWriter" are created in the same way the ini importer does.
+  ACE_Configuration_Section_Key section_key;
+  if (cf->expand_path(cf->root_section(), ACE_TEXT_CHAR_TO_TCHAR(section), section_key, 1) != 0) {
+    return ::DDS::RETCODE_ERROR;
+  }
+
+  if (cf->set_string_value(section_key, ACE_TEXT_CHAR_TO_TCHAR(key), ACE_TEXT_CHAR_TO_TCHAR(value)) != 0) {
+    return ::DDS::RETCODE_ERROR;
+  }
+
+  return ::DDS::RETCODE_OK;
+}
+
+::DDS::ReturnCode_t StaticDiscovery_ImportConfiguration(ACE_Configuration_Heap *cf, const char *file_name) {
+  if (cf == nullptr || file_name == nullptr) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  ACE_Ini_ImpExp import(*cf);
+  if (import.import_config(ACE_TEXT_CHAR_TO_TCHAR(file_name)) != 0) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) ERROR: StaticDiscovery_ImportConfiguration: cannot import %C\n"), file_name));
+    return ::DDS::RETCODE_ERROR;
+  }
+
+  return ::DDS::RETCODE_OK;
+}
+
+::DDS::ReturnCode_t StaticDiscovery_LoadConfiguration(ACE_Configuration_Heap *cf) {
+  if (cf == nullptr) {
+    return ::DDS::RETCODE_BAD_PARAMETER;
+  }
+
+  // The service participant loads the [topic], [datawriterqos], [datareaderqos], [publisherqos],
+  // [subscriberqos] and [endpoint] sections into the static discovery registry, together with the
+  // [config] and [transport] sections that provide the endpoints locators.
+  if (TheServiceParticipant->load_configuration(*cf, ACE_TEXT("")) != 0) {
+    return ::DDS::RETCODE_ERROR;
+  }
+
+  return ::DDS::RETCODE_OK;
+}
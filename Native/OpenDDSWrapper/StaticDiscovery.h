@@ -0,0 +1,48 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include "Utils.h"
+
+#include <dds/DCPS/StaticDiscovery.h>
+#include <dds/DCPS/Service_Participant.h>
+#include <ace/Configuration.h>
+#include <ace/Configuration_Import_Export.h>
+
+EXTERN_METHOD_EXPORT
+::OpenDDS::DCPS::Discovery *StaticDiscovery_NarrowBase(::OpenDDS::DCPS::StaticDiscovery *d);
+
+EXTERN_METHOD_EXPORT
+::OpenDDS::DCPS::StaticDiscovery *StaticDiscovery_GetInstance();
+
+EXTERN_METHOD_EXPORT
+ACE_Configuration_Heap *StaticDiscovery_NewConfiguration();
+
+EXTERN_METHOD_EXPORT
+void StaticDiscovery_DeleteConfiguration(ACE_Configuration_Heap *cf);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t StaticDiscovery_SetConfigurationValue(ACE_Configuration_Heap *cf, const char *section, const char *key, const char *value);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t StaticDiscovery_ImportConfiguration(ACE_Configuration_Heap *cf, const char *file_name);
+
+EXTERN_METHOD_EXPORT
+::DDS::ReturnCode_t StaticDiscovery_LoadConfiguration(ACE_Configuration_Heap *cf);
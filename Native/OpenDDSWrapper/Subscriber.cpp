@@ -31,7 +31,21 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
   return sub->create_datareader(topicDescription, qos, a_listener, mask);
 }
 
+::DDS::DataReader_ptr Subscriber_CreateDataReaderWithProfile(::DDS::Subscriber_ptr sub,
+                                                             ::DDS::TopicDescription_ptr topicDescription,
+                                                             OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile,
+                                                             OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr a_listener,
+                                                             ::DDS::StatusMask mask) {
+  std::shared_ptr<const ::DDS::DataReaderQos> qos = profile->datareader_qos();
+  if (!qos) {
+    return sub->create_datareader(topicDescription, DATAREADER_QOS_DEFAULT, a_listener, mask);
+  }
+
+  return sub->create_datareader(topicDescription, *qos, a_listener, mask);
+}
+
 ::DDS::ReturnCode_t Subscriber_GetDefaultDataReaderQos(::DDS::Subscriber_ptr sub, DataReaderQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DataReaderQos qos_native;
   ::DDS::ReturnCode_t ret = sub->get_default_datareader_qos(qos_native);
 
@@ -47,6 +61,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 }
 
 ::DDS::ReturnCode_t Subscriber_GetQos(::DDS::Subscriber_ptr sub, SubscriberQosWrapper &qos_wrapper) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriberQos qos_native;
   ::DDS::ReturnCode_t ret = sub->get_qos(qos_native);
 
@@ -97,6 +112,7 @@ Subscriber_SetListener(::DDS::Subscriber_ptr sub, OpenDDSharp::OpenDDS::DDS::Sub
 
 ::DDS::ReturnCode_t Subscriber_GetDataReaders(::DDS::Subscriber_ptr sub, void *&lst, ::DDS::SampleStateMask sampleState,
                                               ::DDS::ViewStateMask viewState, ::DDS::InstanceStateMask instanceState) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::DataReaderSeq seq;
   ::DDS::ReturnCode_t ret = sub->get_datareaders(seq, sampleState, viewState, instanceState);
   if (ret == ::DDS::RETCODE_OK) {
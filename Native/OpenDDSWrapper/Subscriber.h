@@ -21,6 +21,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Utils.h"
 #include "QosPolicies.h"
+#include "QosProfile.h"
 #include "SubscriberListenerImpl.h"
 #include "DataReaderListenerImpl.h"
 #include "marshal.h"
@@ -41,6 +42,13 @@ EXTERN_METHOD_EXPORT
                                                   OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr a_listener,
                                                   ::DDS::StatusMask mask);
 
+EXTERN_METHOD_EXPORT
+::DDS::DataReader_ptr Subscriber_CreateDataReaderWithProfile(::DDS::Subscriber_ptr sub,
+                                                             ::DDS::TopicDescription_ptr topicDescription,
+                                                             OpenDDSharp::OpenDDS::DDS::QosProfile_ptr profile,
+                                                             OpenDDSharp::OpenDDS::DDS::DataReaderListenerImpl_ptr a_listener,
+                                                             ::DDS::StatusMask mask);
+
 EXTERN_METHOD_EXPORT
 ::DDS::ReturnCode_t Subscriber_GetDefaultDataReaderQos(::DDS::Subscriber_ptr sub, DataReaderQosWrapper &qos_wrapper);
 
@@ -27,6 +27,7 @@ SubscriptionBuiltinTopicDataDataReader_Narrow(DDS::DataReader_ptr dr) {
 int SubscriptionBuiltinTopicDataDataReader_ReadNextSample(::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr,
                                                           SubscriptionBuiltinTopicDataWrapper &data,
                                                           ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->read_next_sample(nativeData, *sampleInfo);
 
@@ -40,6 +41,7 @@ int SubscriptionBuiltinTopicDataDataReader_ReadNextSample(::DDS::SubscriptionBui
 int SubscriptionBuiltinTopicDataDataReader_TakeNextSample(::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr,
                                                           SubscriptionBuiltinTopicDataWrapper &data,
                                                           ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->take_next_sample(nativeData, *sampleInfo);
   if (ret == ::DDS::RETCODE_OK) {
@@ -54,6 +56,7 @@ SubscriptionBuiltinTopicDataDataReader_Read(::DDS::SubscriptionBuiltinTopicDataD
                                             void *&receivedInfo, CORBA::Long maxSamples,
                                             ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                             ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -78,6 +81,7 @@ SubscriptionBuiltinTopicDataDataReader_Read(::DDS::SubscriptionBuiltinTopicDataD
 SubscriptionBuiltinTopicDataDataReader_ReadWithCondition(::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr,
                                                          void *&receivedData, void *&receivedInfo,
                                                          CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -103,6 +107,7 @@ SubscriptionBuiltinTopicDataDataReader_Take(::DDS::SubscriptionBuiltinTopicDataD
                                             void *&receivedInfo, CORBA::Long maxSamples,
                                             ::DDS::SampleStateMask sampleStates, ::DDS::ViewStateMask viewStates,
                                             ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take(received_data, info_seq, maxSamples, sampleStates, viewStates, instanceStates);
@@ -126,6 +131,7 @@ SubscriptionBuiltinTopicDataDataReader_Take(::DDS::SubscriptionBuiltinTopicDataD
 SubscriptionBuiltinTopicDataDataReader_TakeWithCondition(::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr,
                                                          void *&receivedData, void *&receivedInfo,
                                                          CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -160,6 +166,7 @@ SubscriptionBuiltinTopicDataDataReader_ReadInstance(::DDS::SubscriptionBuiltinTo
                                                     ::DDS::SampleStateMask sampleStates,
                                                     ::DDS::ViewStateMask viewStates,
                                                     ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -185,6 +192,7 @@ SubscriptionBuiltinTopicDataDataReader_ReadInstanceWithCondition(::DDS::Subscrip
                                                                  void *&receivedData, void *&receivedInfo,
                                                                  ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                                  ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -212,6 +220,7 @@ SubscriptionBuiltinTopicDataDataReader_TakeInstance(::DDS::SubscriptionBuiltinTo
                                                     ::DDS::SampleStateMask sampleStates,
                                                     ::DDS::ViewStateMask viewStates,
                                                     ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -237,6 +246,7 @@ SubscriptionBuiltinTopicDataDataReader_TakeInstanceWithCondition(::DDS::Subscrip
                                                                  void *&receivedData, void *&receivedInfo,
                                                                  ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                                  ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -264,6 +274,7 @@ SubscriptionBuiltinTopicDataDataReader_ReadNextInstance(::DDS::SubscriptionBuilt
                                                         ::DDS::SampleStateMask sampleStates,
                                                         ::DDS::ViewStateMask viewStates,
                                                         ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -287,6 +298,7 @@ SubscriptionBuiltinTopicDataDataReader_ReadNextInstance(::DDS::SubscriptionBuilt
 ::DDS::ReturnCode_t SubscriptionBuiltinTopicDataDataReader_ReadNextInstanceWithCondition(
     ::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr, void *&receivedData, void *&receivedInfo,
     ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -313,6 +325,7 @@ SubscriptionBuiltinTopicDataDataReader_TakeNextInstance(::DDS::SubscriptionBuilt
                                                         ::DDS::SampleStateMask sampleStates,
                                                         ::DDS::ViewStateMask viewStates,
                                                         ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -336,6 +349,7 @@ SubscriptionBuiltinTopicDataDataReader_TakeNextInstance(::DDS::SubscriptionBuilt
 ::DDS::ReturnCode_t SubscriptionBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(
     ::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr, void *&receivedData, void *&receivedInfo,
     ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples, ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -357,6 +371,7 @@ SubscriptionBuiltinTopicDataDataReader_TakeNextInstance(::DDS::SubscriptionBuilt
 
 int SubscriptionBuiltinTopicDataDataReader_GetKeyValue(::DDS::SubscriptionBuiltinTopicDataDataReader_ptr dr,
                                                        SubscriptionBuiltinTopicDataWrapper &data, int handle) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::SubscriptionBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->get_key_value(nativeData, handle);
 
@@ -81,7 +81,8 @@ void TcpInst_SetPassiveReconnectDuration(::OpenDDS::DCPS::TcpInst *ti, CORBA::Lo
 }
 
 char *TcpInst_GetPublicAddress(::OpenDDS::DCPS::TcpInst *ti) {
-  return CORBA::string_dup(ti->pub_address_str().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(ti->pub_address_str().c_str());
 }
 
 void TcpInst_SetPublicAddress(::OpenDDS::DCPS::TcpInst *ti, char *value) {
@@ -89,7 +90,8 @@ void TcpInst_SetPublicAddress(::OpenDDS::DCPS::TcpInst *ti, char *value) {
 }
 
 char *TcpInst_GetLocalAddress(::OpenDDS::DCPS::TcpInst *ti) {
-  return CORBA::string_dup(ti->local_address().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(ti->local_address().c_str());
 }
 
 void TcpInst_SetLocalAddress(::OpenDDS::DCPS::TcpInst *ti, char *value) {
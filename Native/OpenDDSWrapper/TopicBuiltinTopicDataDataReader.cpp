@@ -25,6 +25,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 int TopicBuiltinTopicDataDataReader_ReadNextSample(::DDS::TopicBuiltinTopicDataDataReader_ptr dr,
                                                    TopicBuiltinTopicDataWrapper &data, ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->read_next_sample(nativeData, *sampleInfo);
 
@@ -37,6 +38,7 @@ int TopicBuiltinTopicDataDataReader_ReadNextSample(::DDS::TopicBuiltinTopicDataD
 
 int TopicBuiltinTopicDataDataReader_TakeNextSample(::DDS::TopicBuiltinTopicDataDataReader_ptr dr,
                                                    TopicBuiltinTopicDataWrapper &data, ::DDS::SampleInfo *sampleInfo) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->take_next_sample(nativeData, *sampleInfo);
   if (ret == ::DDS::RETCODE_OK) {
@@ -50,6 +52,7 @@ int TopicBuiltinTopicDataDataReader_TakeNextSample(::DDS::TopicBuiltinTopicDataD
 TopicBuiltinTopicDataDataReader_Read(::DDS::TopicBuiltinTopicDataDataReader_ptr dr, void *&receivedData,
                                      void *&receivedInfo, CORBA::Long maxSamples, ::DDS::SampleStateMask sampleStates,
                                      ::DDS::ViewStateMask viewStates, ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -74,6 +77,7 @@ TopicBuiltinTopicDataDataReader_Read(::DDS::TopicBuiltinTopicDataDataReader_ptr
 TopicBuiltinTopicDataDataReader_ReadWithCondition(::DDS::TopicBuiltinTopicDataDataReader_ptr dr, void *&receivedData,
                                                   void *&receivedInfo, CORBA::Long maxSamples,
                                                   ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -98,6 +102,7 @@ TopicBuiltinTopicDataDataReader_ReadWithCondition(::DDS::TopicBuiltinTopicDataDa
 TopicBuiltinTopicDataDataReader_Take(::DDS::TopicBuiltinTopicDataDataReader_ptr dr, void *&receivedData,
                                      void *&receivedInfo, CORBA::Long maxSamples, ::DDS::SampleStateMask sampleStates,
                                      ::DDS::ViewStateMask viewStates, ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take(received_data, info_seq, maxSamples, sampleStates, viewStates, instanceStates);
@@ -121,6 +126,7 @@ TopicBuiltinTopicDataDataReader_Take(::DDS::TopicBuiltinTopicDataDataReader_ptr
 TopicBuiltinTopicDataDataReader_TakeWithCondition(::DDS::TopicBuiltinTopicDataDataReader_ptr dr, void *&receivedData,
                                                   void *&receivedInfo, CORBA::Long maxSamples,
                                                   ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -153,6 +159,7 @@ TopicBuiltinTopicDataDataReader_ReadInstance(::DDS::TopicBuiltinTopicDataDataRea
                                              void *&receivedInfo, ::DDS::InstanceHandle_t handle,
                                              CORBA::Long maxSamples, ::DDS::SampleStateMask sampleStates,
                                              ::DDS::ViewStateMask viewStates, ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -178,6 +185,7 @@ TopicBuiltinTopicDataDataReader_ReadInstanceWithCondition(::DDS::TopicBuiltinTop
                                                           void *&receivedData, void *&receivedInfo,
                                                           ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                           ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -203,6 +211,7 @@ TopicBuiltinTopicDataDataReader_TakeInstance(::DDS::TopicBuiltinTopicDataDataRea
                                              void *&receivedInfo, ::DDS::InstanceHandle_t handle,
                                              CORBA::Long maxSamples, ::DDS::SampleStateMask sampleStates,
                                              ::DDS::ViewStateMask viewStates, ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_instance(received_data, info_seq, maxSamples, handle, sampleStates, viewStates,
@@ -228,6 +237,7 @@ TopicBuiltinTopicDataDataReader_TakeInstanceWithCondition(::DDS::TopicBuiltinTop
                                                           void *&receivedData, void *&receivedInfo,
                                                           ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                           ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
 
@@ -254,6 +264,7 @@ TopicBuiltinTopicDataDataReader_ReadNextInstance(::DDS::TopicBuiltinTopicDataDat
                                                  CORBA::Long maxSamples, ::DDS::SampleStateMask sampleStates,
                                                  ::DDS::ViewStateMask viewStates,
                                                  ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -279,6 +290,7 @@ TopicBuiltinTopicDataDataReader_ReadNextInstanceWithCondition(::DDS::TopicBuilti
                                                               void *&receivedData, void *&receivedInfo,
                                                               ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                               ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->read_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -304,6 +316,7 @@ TopicBuiltinTopicDataDataReader_TakeNextInstance(::DDS::TopicBuiltinTopicDataDat
                                                  CORBA::Long maxSamples, ::DDS::SampleStateMask sampleStates,
                                                  ::DDS::ViewStateMask viewStates,
                                                  ::DDS::InstanceStateMask instanceStates) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance(received_data, info_seq, maxSamples, handle, sampleStates,
@@ -329,6 +342,7 @@ TopicBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(::DDS::TopicBuilti
                                                               void *&receivedData, void *&receivedInfo,
                                                               ::DDS::InstanceHandle_t handle, CORBA::Long maxSamples,
                                                               ::DDS::ReadCondition_ptr condition) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicDataSeq received_data;
   ::DDS::SampleInfoSeq info_seq;
   ::DDS::ReturnCode_t ret = dr->take_next_instance_w_condition(received_data, info_seq, maxSamples, handle, condition);
@@ -350,6 +364,7 @@ TopicBuiltinTopicDataDataReader_TakeNextInstanceWithCondition(::DDS::TopicBuilti
 
 int TopicBuiltinTopicDataDataReader_GetKeyValue(::DDS::TopicBuiltinTopicDataDataReader_ptr dr,
                                                 TopicBuiltinTopicDataWrapper &data, int handle) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::TopicBuiltinTopicData nativeData;
   ::DDS::ReturnCode_t ret = dr->get_key_value(nativeData, handle);
 
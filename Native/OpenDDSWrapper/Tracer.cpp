@@ -0,0 +1,156 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "Tracer.h"
+
+#include "ace/OS_NS_unistd.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+
+namespace {
+  trace_state &tracer_state() {
+    static trace_state *state = []() {
+      trace_state *s = new trace_state();
+      trace_events::attach(s);
+      return s;
+    }();
+
+    return *state;
+  }
+
+  // Serializes Flush and Clear, the producers never take it.
+  std::mutex &tracer_lock() {
+    static std::mutex lock;
+    return lock;
+  }
+
+  void copy_ring(const trace_ring *ring, std::vector<trace_event> &events) {
+    const ACE_UINT64 head = ring->head.load(std::memory_order_acquire);
+    const ACE_UINT64 oldest = head > TRACE_EVENTS_RING_CAPACITY ? head - TRACE_EVENTS_RING_CAPACITY : 0;
+    const ACE_UINT64 first = (std::max)(oldest, ring->cleared.load(std::memory_order_acquire));
+    if (first >= head) {
+      return;
+    }
+
+    std::vector<trace_event> copy;
+    copy.reserve(static_cast<size_t>(head - first));
+    for (ACE_UINT64 i = first; i < head; ++i) {
+      const trace_event *e = ring->slot(i);
+      if (!e) {
+        return;
+      }
+      copy.push_back(*e);
+    }
+
+    // Skip the slots the owner thread may have overwritten during the copy, the
+    // slot of last_head included because it may be half written.
+    const ACE_UINT64 last_head = ring->head.load(std::memory_order_acquire);
+    const ACE_UINT64 valid = last_head + 1 > TRACE_EVENTS_RING_CAPACITY ? last_head + 1 - TRACE_EVENTS_RING_CAPACITY : 0;
+    const size_t skip = valid > first ? static_cast<size_t>((std::min)(valid - first, head - first)) : 0;
+
+    events.insert(events.end(), copy.begin() + skip, copy.end());
+  }
+}
+
+void *Tracer_GetState() {
+  return &tracer_state();
+}
+
+void Tracer_SetEnabled(CORBA::Boolean enabled) {
+  tracer_state().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+CORBA::Boolean Tracer_GetEnabled() {
+  return tracer_state().enabled.load(std::memory_order_relaxed);
+}
+
+void Tracer_SetTriggerThreshold(ACE_UINT64 threshold) {
+  tracer_state().trigger_threshold.store(threshold, std::memory_order_relaxed);
+}
+
+ACE_UINT64 Tracer_GetTriggerThreshold() {
+  return tracer_state().trigger_threshold.load(std::memory_order_relaxed);
+}
+
+CORBA::Boolean Tracer_GetTriggered() {
+  return tracer_state().triggered.load(std::memory_order_relaxed);
+}
+
+void Tracer_Clear() {
+  std::lock_guard<std::mutex> guard(tracer_lock());
+  trace_state &state = tracer_state();
+  const ACE_UINT32 count = std::min<ACE_UINT32>(state.ring_count.load(std::memory_order_acquire), TRACE_EVENTS_MAX_RINGS);
+  for (ACE_UINT32 i = 0; i < count; ++i) {
+    trace_ring *ring = state.rings[i].load(std::memory_order_acquire);
+    if (ring) {
+      ring->cleared.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+  }
+
+  state.triggered.store(false, std::memory_order_relaxed);
+}
+
+int Tracer_Flush(const char *path) {
+  trace_state &state = tracer_state();
+
+  std::vector<trace_event> events;
+  std::unique_lock<std::mutex> guard(tracer_lock());
+  const ACE_UINT32 count = std::min<ACE_UINT32>(state.ring_count.load(std::memory_order_acquire), TRACE_EVENTS_MAX_RINGS);
+  for (ACE_UINT32 i = 0; i < count; ++i) {
+    trace_ring *ring = state.rings[i].load(std::memory_order_acquire);
+    if (ring) {
+      copy_ring(ring, events);
+    }
+  }
+  guard.unlock();
+
+  std::sort(events.begin(), events.end(), [](const trace_event &a, const trace_event &b) {
+    return a.start < b.start;
+  });
+
+  std::ofstream file(path, std::ios::out | std::ios::trunc);
+  if (!file) {
+    return -1;
+  }
+
+  // Chrome trace event format, loadable in Perfetto UI and chrome://tracing.
+  const long pid = static_cast<long>(ACE_OS::getpid());
+  file << std::fixed << std::setprecision(3);
+  file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  for (size_t i = 0; i < events.size(); ++i) {
+    const trace_event &e = events[i];
+    file << (i == 0 ? "\n" : ",\n")
+         << "{\"name\":\"" << e.name << "\",\"cat\":\"" << e.category << "\",\"ph\":\"X\""
+         << ",\"ts\":" << (static_cast<double>(e.start) / 1000.0)
+         << ",\"dur\":" << (static_cast<double>(e.duration) / 1000.0)
+         << ",\"pid\":" << pid << ",\"tid\":" << e.thread_id;
+    if (e.arg != TRACE_EVENTS_NO_ARG) {
+      file << ",\"args\":{\"value\":" << e.arg << "}";
+    }
+    file << "}";
+  }
+  file << "\n]}\n";
+  file.close();
+
+  return file ? static_cast<int>(events.size()) : -1;
+}
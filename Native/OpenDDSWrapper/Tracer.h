@@ -0,0 +1,47 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#pragma once
+
+#include "Utils.h"
+#include "../trace_events.h"
+
+EXTERN_METHOD_EXPORT
+void *Tracer_GetState();
+
+EXTERN_METHOD_EXPORT
+void Tracer_SetEnabled(CORBA::Boolean enabled);
+
+EXTERN_METHOD_EXPORT
+CORBA::Boolean Tracer_GetEnabled();
+
+EXTERN_METHOD_EXPORT
+void Tracer_SetTriggerThreshold(ACE_UINT64 threshold);
+
+EXTERN_METHOD_EXPORT
+ACE_UINT64 Tracer_GetTriggerThreshold();
+
+EXTERN_METHOD_EXPORT
+CORBA::Boolean Tracer_GetTriggered();
+
+EXTERN_METHOD_EXPORT
+void Tracer_Clear();
+
+EXTERN_METHOD_EXPORT
+int Tracer_Flush(const char *path);
@@ -47,10 +47,12 @@ void TransportConfig_SetPassiveConnectDuration(::OpenDDS::DCPS::TransportConfig
 }
 
 char *TransportConfig_GetName(::OpenDDS::DCPS::TransportConfig *cfg) {
-  return CORBA::string_dup(cfg->name().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(cfg->name().c_str());
 }
 
 void *TransportConfig_GetTransports(::OpenDDS::DCPS::TransportConfig *cfg) {
+  ALLOC_ENTRY_SCOPE(__func__);
   CORBA::ULongLong size = cfg->instances_.size();
   TAO::unbounded_value_sequence<::OpenDDS::DCPS::TransportInst *> seq(static_cast<CORBA::ULong>(size));
 
@@ -18,13 +18,16 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #include "TransportInst.h"
+#include "marshal.h"
 
 char *TransportInst_GetTransportType(::OpenDDS::DCPS::TransportInst *ti) {
-  return CORBA::string_dup(ti->transport_type_.c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(ti->transport_type_.c_str());
 }
 
 char *TransportInst_GetName(::OpenDDS::DCPS::TransportInst *ti) {
-  return CORBA::string_dup(ti->name().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  return ALLOC_STRING_DUP(ti->name().c_str());
 }
 
 CORBA::ULong TransportInst_GetMaxPacketSize(::OpenDDS::DCPS::TransportInst *ti) {
@@ -73,4 +76,68 @@ size_t TransportInst_GetDatalinkControlChunks(::OpenDDS::DCPS::TransportInst *ti
 
 void TransportInst_SetDatalinkControlChunks(::OpenDDS::DCPS::TransportInst *ti, size_t value) {
   ti->datalink_control_chunks(value);
-}
\ No newline at end of file
+}
+
+void TransportInst_GetStatistics(::OpenDDS::DCPS::TransportInst *ti, void *&message_counts, void *&writer_resend_counts, void *&reader_nack_counts) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  // The counters are kept by the transport implementation itself, we only
+  // flatten the per-link statistics in a single snapshot here.
+  ::OpenDDS::DCPS::TransportStatisticsSequence stats;
+  ti->append_transport_statistics(stats);
+
+  CORBA::ULong message_total = 0;
+  CORBA::ULong resend_total = 0;
+  CORBA::ULong nack_total = 0;
+  for (CORBA::ULong i = 0; i < stats.length(); ++i) {
+    message_total += stats[i].message_count.length();
+    resend_total += stats[i].writer_resend_count.length();
+    nack_total += stats[i].reader_nack_count.length();
+  }
+
+  TAO::unbounded_value_sequence<TransportMessageCountWrapper> messages(message_total);
+  TAO::unbounded_value_sequence<TransportGuidCountWrapper> resends(resend_total);
+  TAO::unbounded_value_sequence<TransportGuidCountWrapper> nacks(nack_total);
+  messages.length(message_total);
+  resends.length(resend_total);
+  nacks.length(nack_total);
+
+  CORBA::ULong m = 0;
+  CORBA::ULong r = 0;
+  CORBA::ULong n = 0;
+  for (CORBA::ULong i = 0; i < stats.length(); ++i) {
+    const ::OpenDDS::DCPS::TransportStatistics &ts = stats[i];
+
+    for (CORBA::ULong j = 0; j < ts.message_count.length(); ++j) {
+      const ::OpenDDS::DCPS::MessageCount &mc = ts.message_count[j];
+
+      TransportMessageCountWrapper &w = messages[m++];
+      w.locator_kind = mc.locator.kind;
+      w.locator_port = mc.locator.port;
+      ACE_OS::memcpy(w.locator_address, mc.locator.address, sizeof w.locator_address);
+      w.kind = static_cast<CORBA::Long>(mc.kind);
+      w.relay = mc.relay;
+      w.send_count = mc.send_count;
+      w.send_bytes = mc.send_bytes;
+      w.send_fail_count = mc.send_fail_count;
+      w.send_fail_bytes = mc.send_fail_bytes;
+      w.recv_count = mc.recv_count;
+      w.recv_bytes = mc.recv_bytes;
+    }
+
+    for (CORBA::ULong j = 0; j < ts.writer_resend_count.length(); ++j) {
+      TransportGuidCountWrapper &w = resends[r++];
+      ACE_OS::memcpy(w.guid, &ts.writer_resend_count[j].guid, sizeof w.guid);
+      w.count = ts.writer_resend_count[j].count;
+    }
+
+    for (CORBA::ULong j = 0; j < ts.reader_nack_count.length(); ++j) {
+      TransportGuidCountWrapper &w = nacks[n++];
+      ACE_OS::memcpy(w.guid, &ts.reader_nack_count[j].guid, sizeof w.guid);
+      w.count = ts.reader_nack_count[j].count;
+    }
+  }
+
+  unbounded_sequence_to_ptr(messages, message_counts);
+  unbounded_sequence_to_ptr(resends, writer_resend_counts);
+  unbounded_sequence_to_ptr(nacks, reader_nack_counts);
+}
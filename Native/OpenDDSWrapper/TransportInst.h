@@ -22,6 +22,28 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include "Utils.h"
 #include <dds/DCPS/transport/framework/TransportInst.h>
 #include <dds/DCPS/transport/framework/TransportInst_rch.h>
+#include <dds/OpenddsDcpsExtC.h>
+
+#pragma pack(push, 1)
+EXTERN_STRUCT_EXPORT TransportMessageCountWrapper {
+  CORBA::Long locator_kind;
+  CORBA::ULong locator_port;
+  CORBA::Octet locator_address[16];
+  CORBA::Long kind;
+  CORBA::Boolean relay;
+  CORBA::ULong send_count;
+  CORBA::ULong send_bytes;
+  CORBA::ULong send_fail_count;
+  CORBA::ULong send_fail_bytes;
+  CORBA::ULong recv_count;
+  CORBA::ULong recv_bytes;
+};
+
+EXTERN_STRUCT_EXPORT TransportGuidCountWrapper {
+  CORBA::Octet guid[16];
+  CORBA::ULong count;
+};
+#pragma pack(pop)
 
 EXTERN_METHOD_EXPORT
 char *TransportInst_GetTransportType(::OpenDDS::DCPS::TransportInst *ti);
@@ -63,4 +85,7 @@ EXTERN_METHOD_EXPORT
 size_t TransportInst_GetDatalinkControlChunks(::OpenDDS::DCPS::TransportInst *ti);
 
 EXTERN_METHOD_EXPORT
-void TransportInst_SetDatalinkControlChunks(::OpenDDS::DCPS::TransportInst *ti, size_t value);
\ No newline at end of file
+void TransportInst_SetDatalinkControlChunks(::OpenDDS::DCPS::TransportInst *ti, size_t value);
+
+EXTERN_METHOD_EXPORT
+void TransportInst_GetStatistics(::OpenDDS::DCPS::TransportInst *ti, void *&message_counts, void *&writer_resend_counts, void *&reader_nack_counts);
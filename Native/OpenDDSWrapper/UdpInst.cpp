@@ -49,9 +49,10 @@ void UdpInst_SetRcvBufferSize(::OpenDDS::DCPS::UdpInst *ui, CORBA::Int32 value)
 }
 
 char *UdpInst_GetLocalAddress(::OpenDDS::DCPS::UdpInst *ui) {
-  const char* addr_str = CORBA::string_dup(ui->local_address().c_str());
+  ALLOC_ENTRY_SCOPE(__func__);
+  const char* addr_str = ALLOC_STRING_DUP(ui->local_address().c_str());
 
-  return CORBA::string_dup(addr_str);
+  return ALLOC_STRING_DUP(addr_str);
 }
 
 void UdpInst_SetLocalAddress(::OpenDDS::DCPS::UdpInst *ui, char *value) {
@@ -20,6 +20,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include "dds/DdsDcpsDomainC.h"
+#include "../alloc_accounting.h"
 
 #ifndef EXTERN_METHOD_EXPORT
   #ifdef _WIN32
@@ -18,14 +18,21 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #include "WaitSet.h"
+#include "Tracer.h"
+#include "../usdt_probes.h"
 
 ::DDS::WaitSet_ptr WaitSet_New() {
   return new ::DDS::WaitSet();
 }
 
 ::DDS::ReturnCode_t WaitSet_Wait(::DDS::WaitSet_ptr ws, void *&sequence, ::DDS::Duration_t duration) {
+  ALLOC_ENTRY_SCOPE(__func__);
+  TRACE_EVENT_SCOPE_NAMED(trace, "WaitSet_Wait", TRACE_EVENTS_WAIT_CATEGORY);
+  USDT_PROBE1(waitset_wait_start, ws);
   ::DDS::ConditionSeq seq;
   ::DDS::ReturnCode_t ret = ws->wait(seq, duration);
+  USDT_PROBE3(waitset_wait_done, ws, ret, seq.length());
+  TRACE_EVENT_ARG(trace, seq.length());
 
   if (ret == ::DDS::RETCODE_OK) {
     CORBA::ULong length = seq.length();
@@ -49,6 +56,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 }
 
 ::DDS::ReturnCode_t WaitSet_GetConditions(::DDS::WaitSet_ptr ws, void *&sequence) {
+  ALLOC_ENTRY_SCOPE(__func__);
   ::DDS::ConditionSeq seq;
   ::DDS::ReturnCode_t ret = ws->get_conditions(seq);
 
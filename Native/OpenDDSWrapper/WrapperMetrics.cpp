@@ -0,0 +1,39 @@
+/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+#include "WrapperMetrics.h"
+
+namespace {
+  wrapper_metrics_hooks &wrapper_metrics_state() {
+    static wrapper_metrics_hooks *state = new wrapper_metrics_hooks();
+    return *state;
+  }
+}
+
+void *WrapperMetrics_GetState() {
+  return &wrapper_metrics_state();
+}
+
+void WrapperMetrics_Release(void *entity) {
+  wrapper_metrics_hooks &hooks = wrapper_metrics_state();
+  std::lock_guard<std::mutex> guard(hooks.lock);
+  for (wrapper_metrics_release_hook release : hooks.release) {
+    release(entity);
+  }
+}
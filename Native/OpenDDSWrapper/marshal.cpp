@@ -20,14 +20,17 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include "marshal.h"
 
 void release_native_ptr(void *ptr) {
+  ALLOC_RELEASE(ptr);
   ACE_OS::free(ptr);
 }
 
 void release_basic_string_ptr(char *ptr) {
+  ALLOC_RELEASE(ptr);
   CORBA::string_free(ptr);
 }
 
 void release_wide_string_ptr(wchar_t *ptr) {
+  ALLOC_RELEASE(ptr);
   CORBA::wstring_free(ptr);
 }
 
@@ -45,14 +48,17 @@ void release_basic_string_sequence_ptr(void *&ptr) {
   const size_t structs_offset = sizeof length;
   const size_t struct_size = sizeof(char *);
   char **pointers = new char *[length];
+  ALLOC_TEMPORARY(length * sizeof(char *));
   for (ACE_UINT32 i = 0; i < length; i++) {
     ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
+    ALLOC_RELEASE(pointers[i]);
     CORBA::string_free(pointers[i]);
   }
 
   delete[] pointers;
 
+  ALLOC_RELEASE(ptr);
   ACE_OS::free(ptr);
 }
 
@@ -70,13 +76,16 @@ void release_wide_string_sequence_ptr(void *&ptr) {
   const size_t structs_offset = sizeof length;
   const size_t struct_size = sizeof(wchar_t *);
   wchar_t **pointers = new wchar_t *[length];
+  ALLOC_TEMPORARY(length * sizeof(wchar_t *));
   for (ACE_UINT32 i = 0; i < length; i++) {
     ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
+    ALLOC_RELEASE(pointers[i]);
     CORBA::wstring_free(pointers[i]);
   }
 
   delete[] pointers;
 
+  ALLOC_RELEASE(ptr);
   ACE_OS::free(ptr);
 }
\ No newline at end of file
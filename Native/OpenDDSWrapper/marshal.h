@@ -24,6 +24,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 #include "ace/Basic_Types.h"
 #include "tao/Unbounded_Value_Sequence_T.h"
 #include "tao/Unbounded_Basic_String_Sequence_T.h"
+#include "../alloc_accounting.h"
 
 template<typename T>
 static void unbounded_sequence_to_ptr(TAO::unbounded_value_sequence<T> sequence, void *&ptr) {
@@ -31,6 +32,7 @@ static void unbounded_sequence_to_ptr(TAO::unbounded_value_sequence<T> sequence,
   const size_t struct_size = sizeof(T);
   const size_t buffer_size = (length * struct_size) + sizeof length;
   char *bytes = new char[buffer_size];
+  ALLOC_TEMPORARY(buffer_size);
   ACE_OS::memcpy(bytes, &length, sizeof length);
 
   for (ACE_UINT32 i = 0; i < length; i++) {
@@ -39,6 +41,7 @@ static void unbounded_sequence_to_ptr(TAO::unbounded_value_sequence<T> sequence,
 
   // Alloc memory for the pointer
   ptr = ACE_OS::malloc(buffer_size);
+  ALLOC_RECORD(ptr, buffer_size);
 
   // Copy the bytes in the pointer
   ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -73,15 +76,17 @@ static void unbounded_basic_string_sequence_to_ptr(TAO::unbounded_basic_string_s
   const size_t struct_size = sizeof(char *);
   const size_t buffer_size = (length * struct_size) + sizeof length;
   char *bytes = new char[buffer_size];
+  ALLOC_TEMPORARY(buffer_size);
   ACE_OS::memcpy(bytes, &length, sizeof length);
 
   for (ACE_UINT32 i = 0; i < length; i++) {
-    char *str = CORBA::string_dup(sequence[i]);
+    char *str = ALLOC_STRING_DUP(sequence[i]);
     ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &str, struct_size);
   }
 
   // Alloc memory for the poninter
   ptr = ACE_OS::malloc(buffer_size);
+  ALLOC_RECORD(ptr, buffer_size);
   // Copy the bytes in the pointer
   ACE_OS::memcpy(ptr, bytes, buffer_size);
 
@@ -104,10 +109,12 @@ static void ptr_to_unbounded_basic_string_sequence(void *ptr, TAO::unbounded_bas
   const size_t structs_offset = sizeof length;
   const size_t struct_size = sizeof(char *);
   char **pointers = new char *[length];
+  ALLOC_TEMPORARY(length * sizeof(char *));
   for (ACE_UINT32 i = 0; i < length; i++) {
     ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
     sequence[i] = CORBA::string_dup(pointers[i]);
+    ALLOC_TEMPORARY_STRING(pointers[i]);
   }
 
   delete[] pointers;
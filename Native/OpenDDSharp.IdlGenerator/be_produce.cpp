@@ -207,7 +207,13 @@ namespace {
                 << "#endif\n\n"
                 << "#ifndef EXTERN_STRUCT_EXPORT\n"
                 << "    #define EXTERN_STRUCT_EXPORT extern \"C\" struct\n"
-                << "#endif\n\n";
+                << "#endif\n\n"
+                << "#include \"wrapper_metrics.h\"\n"
+                << "#include \"latency_histogram.h\"\n"
+                << "#include \"trace_events.h\"\n"
+                << "#include \"usdt_probes.h\"\n"
+                << "#include \"alloc_accounting.h\"\n"
+                << "#include \"lifecycle_trace.h\"\n\n";
           }
           break;
         case BE_GlobalData::STREAM_CPP:
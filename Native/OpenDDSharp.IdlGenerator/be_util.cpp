@@ -154,3 +154,15 @@ be_util::dds_root() {
   }
   return value;
 }
+
+std::string
+be_util::template_dir() {
+  const char *value = ACE_OS::getenv("OPENDDSHARP_TEMPLATE_DIR");
+  if (value && value[0]) {
+    return value;
+  }
+
+  std::string dir = dds_root();
+  dir.append("/dds/idl");
+  return dir;
+}
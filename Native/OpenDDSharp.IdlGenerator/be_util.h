@@ -36,6 +36,10 @@ namespace be_util {
 
     /// Get DDS_ROOT. It is a fatal error if it wasn't set.
     const char *dds_root();
+
+    /// Get the directory of the code templates, OPENDDSHARP_TEMPLATE_DIR if it
+    /// is set, otherwise $DDS_ROOT/dds/idl.
+    std::string template_dir();
 };
 
 #endif // if !defined
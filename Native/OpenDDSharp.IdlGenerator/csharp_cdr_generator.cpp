@@ -30,8 +30,8 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 namespace {
     std::string read_template(const char *prefix) {
-      std::string path = be_util::dds_root();
-      path.append("/dds/idl/");
+      std::string path = be_util::template_dir();
+      path.append("/");
       path.append(prefix);
       path.append("Template.txt");
       std::ifstream ifs(path.c_str());
@@ -19,6 +19,7 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 #include "cwrapper_generator.h"
 #include "be_extern.h"
+#include "be_util.h"
 
 #include "utl_identifier.h"
 
@@ -32,13 +33,8 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 
 namespace {
     std::string read_template(const char *prefix) {
-      const char *dds_root = ACE_OS::getenv("DDS_ROOT");
-      if (!dds_root) {
-        ACE_ERROR((LM_ERROR, "The environment variable DDS_ROOT must be set.\n"));
-        BE_abort();
-      }
-      std::string path = dds_root;
-      path.append("/dds/idl/");
+      std::string path = be_util::template_dir();
+      path.append("/");
       path.append(prefix);
       path.append("Template.txt");
       std::ifstream ifs(path.c_str());
@@ -0,0 +1,164 @@
+#ifndef _ALLOC_ACCOUNTING_H_
+#define _ALLOC_ACCOUNTING_H_
+
+#include "ace/Basic_Types.h"
+#include "ace/OS_NS_string.h"
+#include "tao/CORBA_String.h"
+
+// Allocation accounting of the wrapper entry points. Compiled out unless
+// OPENDDSHARP_ALLOC_ACCOUNTING is defined, in that case every buffer and string
+// allocated by the marshaling helpers is attributed to the outermost exported
+// method running on the calling thread.
+// The registry lives in OpenDDSWrapper, the generated libraries forward their
+// allocations to it through the hooks received on attach, so a buffer released
+// by ReleaseNativePointer is matched with the entry point that allocated it.
+
+#ifndef EXTERN_STRUCT_EXPORT
+    #define EXTERN_STRUCT_EXPORT extern "C" struct
+#endif
+
+#define ALLOC_ACCOUNTING_ENTRY_POINT_LENGTH 128
+
+#pragma pack(push, 1)
+EXTERN_STRUCT_EXPORT AllocSiteWrapper {
+  char entry_point[ALLOC_ACCOUNTING_ENTRY_POINT_LENGTH];
+  ACE_UINT64 allocations;
+  ACE_UINT64 bytes;
+  ACE_UINT64 releases;
+  ACE_UINT64 live_allocations;
+  ACE_UINT64 live_bytes;
+};
+#pragma pack(pop)
+
+struct alloc_site;
+
+// A null pointer is a temporary buffer, released before the entry point returns.
+// A null site is an allocation made outside of any entry point.
+struct alloc_hooks {
+  void (*allocated)(alloc_site *site, const void *ptr, size_t size);
+  void (*released)(const void *ptr);
+};
+
+#ifdef OPENDDSHARP_ALLOC_ACCOUNTING
+
+#include <atomic>
+
+// Counters of one entry point, a static instance is defined by ALLOC_ENTRY_SCOPE
+// in every exported method. The registry enlists the site on its first
+// allocation and updates the counters without taking any lock.
+struct alloc_site {
+  constexpr explicit alloc_site(const char *name)
+    : entry_point(name) {
+  }
+
+  const char *const entry_point;
+  std::atomic<bool> enlisted{false};
+  std::atomic<ACE_UINT64> allocations{0};
+  std::atomic<ACE_UINT64> bytes{0};
+  std::atomic<ACE_UINT64> releases{0};
+  std::atomic<ACE_UINT64> live_allocations{0};
+  std::atomic<ACE_UINT64> live_bytes{0};
+};
+
+class alloc_accounting {
+
+public:
+    static std::atomic<const alloc_hooks *> &hooks() {
+      static std::atomic<const alloc_hooks *> h{nullptr};
+      return h;
+    }
+
+    static void attach(const alloc_hooks *h) {
+      hooks().store(h, std::memory_order_release);
+    }
+
+    static alloc_site *&current_site() {
+      thread_local alloc_site *site = nullptr;
+      return site;
+    }
+
+    // Nested exported calls (e.g. a QoS getter used by another entry point)
+    // are accounted to the outermost one.
+    class entry_scope {
+
+    public:
+        explicit entry_scope(alloc_site &site)
+          : outer_(current_site() == nullptr) {
+          if (outer_) {
+            current_site() = &site;
+          }
+        }
+
+        ~entry_scope() {
+          if (outer_) {
+            current_site() = nullptr;
+          }
+        }
+
+    private:
+        const bool outer_;
+    };
+
+    static void allocated(const void *ptr, size_t size) {
+      const alloc_hooks *h = hooks().load(std::memory_order_acquire);
+      if (h) {
+        h->allocated(current_site(), ptr, size);
+      }
+    }
+
+    static void released(const void *ptr) {
+      const alloc_hooks *h = hooks().load(std::memory_order_acquire);
+      if (h && ptr) {
+        h->released(ptr);
+      }
+    }
+
+    static size_t string_size(const char *str) {
+      return (str ? ACE_OS::strlen(str) : 0) + 1;
+    }
+
+    static size_t string_size(const wchar_t *str) {
+      return ((str ? ACE_OS::strlen(str) : 0) + 1) * sizeof(wchar_t);
+    }
+
+    static char *string_dup(const char *str) {
+      char *dup = CORBA::string_dup(str);
+      allocated(dup, string_size(str));
+      return dup;
+    }
+
+    static wchar_t *wstring_dup(const wchar_t *str) {
+      wchar_t *dup = CORBA::wstring_dup(str);
+      allocated(dup, string_size(str));
+      return dup;
+    }
+};
+
+#define ALLOC_CONCAT_IMPL(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_IMPL(a, b)
+
+#define ALLOC_ENTRY_SCOPE(NAME) \
+  static alloc_site ALLOC_CONCAT(alloc_site_, __LINE__)(NAME); \
+  alloc_accounting::entry_scope ALLOC_CONCAT(alloc_scope_, __LINE__)(ALLOC_CONCAT(alloc_site_, __LINE__))
+#define ALLOC_RECORD(PTR, SIZE) alloc_accounting::allocated(PTR, SIZE)
+#define ALLOC_TEMPORARY(SIZE) alloc_accounting::allocated(nullptr, SIZE)
+#define ALLOC_TEMPORARY_STRING(STR) alloc_accounting::allocated(nullptr, alloc_accounting::string_size(STR))
+#define ALLOC_RELEASE(PTR) alloc_accounting::released(PTR)
+#define ALLOC_STRING_DUP(STR) alloc_accounting::string_dup(STR)
+#define ALLOC_WSTRING_DUP(STR) alloc_accounting::wstring_dup(STR)
+#define ALLOC_ATTACH(HOOKS) alloc_accounting::attach(HOOKS)
+
+#else
+
+#define ALLOC_ENTRY_SCOPE(NAME)
+#define ALLOC_RECORD(PTR, SIZE)
+#define ALLOC_TEMPORARY(SIZE)
+#define ALLOC_TEMPORARY_STRING(STR)
+#define ALLOC_RELEASE(PTR)
+#define ALLOC_STRING_DUP(STR) CORBA::string_dup(STR)
+#define ALLOC_WSTRING_DUP(STR) CORBA::wstring_dup(STR)
+#define ALLOC_ATTACH(HOOKS)
+
+#endif
+
+#endif
@@ -0,0 +1,402 @@
+#ifndef _LATENCY_HISTOGRAM_H_
+#define _LATENCY_HISTOGRAM_H_
+
+#include "ace/Basic_Types.h"
+#include "ace/OS_NS_stdlib.h"
+#include "ace/OS_NS_string.h"
+#include "dds/DdsDcpsSubscriptionC.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifndef EXTERN_STRUCT_EXPORT
+    #define EXTERN_STRUCT_EXPORT extern "C" struct
+#endif
+
+// Log-linear (HDR style) layout: values below 2^SUB_BUCKET_BITS have their own
+// bucket, above that every power of two is split in 2^(SUB_BUCKET_BITS - 1)
+// buckets, so the relative error stays below 1.6% up to 2^(MAX_SHIFT + SUB_BUCKET_BITS) ns (~36 minutes).
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS 7
+#define LATENCY_HISTOGRAM_MAX_SHIFT 34
+#define LATENCY_HISTOGRAM_SUB_BUCKETS (1 << LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+#define LATENCY_HISTOGRAM_HALF_SUB_BUCKETS (LATENCY_HISTOGRAM_SUB_BUCKETS / 2)
+#define LATENCY_HISTOGRAM_BUCKETS (LATENCY_HISTOGRAM_SUB_BUCKETS + (LATENCY_HISTOGRAM_MAX_SHIFT * LATENCY_HISTOGRAM_HALF_SUB_BUCKETS))
+
+#pragma pack(push, 1)
+// Header of the snapshot, followed by bucket_count 8 bytes counters.
+EXTERN_STRUCT_EXPORT LatencyHistogramWrapper {
+  ACE_UINT64 count;
+  ACE_UINT64 min;
+  ACE_UINT64 max;
+  ACE_UINT64 sum;
+  ACE_UINT32 sub_bucket_bits;
+  ACE_UINT32 bucket_count;
+};
+#pragma pack(pop)
+
+struct latency_histogram_registry;
+
+class latency_histogram {
+
+public:
+    latency_histogram() {
+      reset();
+    }
+
+    static int highest_bit(ACE_UINT64 value) {
+#if defined(_MSC_VER) && defined(_M_X64)
+      unsigned long index;
+      _BitScanReverse64(&index, value);
+      return static_cast<int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+      return 63 - __builtin_clzll(value);
+#else
+      int bit = 0;
+      while (value >>= 1) {
+        ++bit;
+      }
+      return bit;
+#endif
+    }
+
+    static size_t index_of(ACE_UINT64 value) {
+      if (value < LATENCY_HISTOGRAM_SUB_BUCKETS) {
+        return static_cast<size_t>(value);
+      }
+
+      const int shift = highest_bit(value) - (LATENCY_HISTOGRAM_SUB_BUCKET_BITS - 1);
+      if (shift > LATENCY_HISTOGRAM_MAX_SHIFT) {
+        return LATENCY_HISTOGRAM_BUCKETS - 1;
+      }
+
+      return LATENCY_HISTOGRAM_SUB_BUCKETS + ((shift - 1) * LATENCY_HISTOGRAM_HALF_SUB_BUCKETS)
+             + static_cast<size_t>((value >> shift) - LATENCY_HISTOGRAM_HALF_SUB_BUCKETS);
+    }
+
+    void record(ACE_UINT64 value) {
+      buckets_[index_of(value)].fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      sum_.fetch_add(value, std::memory_order_relaxed);
+
+      ACE_UINT64 current = min_.load(std::memory_order_relaxed);
+      while (value < current && !min_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      }
+
+      current = max_.load(std::memory_order_relaxed);
+      while (value > current && !max_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      }
+    }
+
+    // Upper bound of the values counted in the bucket.
+    static ACE_UINT64 upper_bound(size_t index) {
+      if (index < LATENCY_HISTOGRAM_SUB_BUCKETS) {
+        return static_cast<ACE_UINT64>(index);
+      }
+
+      const size_t shift = ((index - LATENCY_HISTOGRAM_SUB_BUCKETS) / LATENCY_HISTOGRAM_HALF_SUB_BUCKETS) + 1;
+      const ACE_UINT64 sub_bucket = ((index - LATENCY_HISTOGRAM_SUB_BUCKETS) % LATENCY_HISTOGRAM_HALF_SUB_BUCKETS) + LATENCY_HISTOGRAM_HALF_SUB_BUCKETS;
+      return ((sub_bucket + 1) << shift) - 1;
+    }
+
+    // Upper bound estimation of the given percentile (0 to 100), capped by the maximum recorded value.
+    ACE_UINT64 value_at_percentile(double percentile) const {
+      const ACE_UINT64 total = count();
+      if (total == 0) {
+        return 0;
+      }
+
+      percentile = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+      ACE_UINT64 target = static_cast<ACE_UINT64>(std::ceil(static_cast<double>(total) * percentile / 100.0));
+      target = target == 0 ? 1 : target;
+
+      ACE_UINT64 accumulated = 0;
+      for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS; ++i) {
+        accumulated += buckets_[i].load(std::memory_order_relaxed);
+        if (accumulated >= target) {
+          return (std::min)(upper_bound(i), maximum());
+        }
+      }
+
+      return maximum();
+    }
+
+    ACE_UINT64 count() const {
+      return count_.load(std::memory_order_relaxed);
+    }
+
+    ACE_UINT64 sum() const {
+      return sum_.load(std::memory_order_relaxed);
+    }
+
+    ACE_UINT64 minimum() const {
+      return count() > 0 ? min_.load(std::memory_order_relaxed) : 0;
+    }
+
+    ACE_UINT64 maximum() const {
+      return max_.load(std::memory_order_relaxed);
+    }
+
+    void reset() {
+      count_.store(0, std::memory_order_relaxed);
+      sum_.store(0, std::memory_order_relaxed);
+      min_.store(~static_cast<ACE_UINT64>(0), std::memory_order_relaxed);
+      max_.store(0, std::memory_order_relaxed);
+      for (auto &b : buckets_) {
+        b.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    void snapshot(void *&ptr) const {
+      LatencyHistogramWrapper header;
+      header.count = count_.load(std::memory_order_relaxed);
+      header.min = header.count > 0 ? min_.load(std::memory_order_relaxed) : 0;
+      header.max = max_.load(std::memory_order_relaxed);
+      header.sum = sum_.load(std::memory_order_relaxed);
+      header.sub_bucket_bits = LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+      header.bucket_count = LATENCY_HISTOGRAM_BUCKETS;
+
+      const size_t size = sizeof header + (LATENCY_HISTOGRAM_BUCKETS * sizeof(ACE_UINT64));
+      char *bytes = static_cast<char *>(ACE_OS::malloc(size));
+      ACE_OS::memcpy(bytes, &header, sizeof header);
+
+      ACE_UINT64 *counts = reinterpret_cast<ACE_UINT64 *>(bytes + sizeof header);
+      for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS; ++i) {
+        const ACE_UINT64 value = buckets_[i].load(std::memory_order_relaxed);
+        ACE_OS::memcpy(&counts[i], &value, sizeof value);
+      }
+
+      ptr = bytes;
+    }
+
+    // Latency between the source timestamp and now, both in the DDS (system) clock.
+    static ACE_UINT64 latency(const ::DDS::Time_t &source_timestamp) {
+      const ACE_INT64 now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+      const ACE_INT64 source = static_cast<ACE_INT64>(source_timestamp.sec) * 1000000000 + source_timestamp.nanosec;
+
+      return now > source ? static_cast<ACE_UINT64>(now - source) : 0;
+    }
+
+    static std::atomic<latency_histogram_registry *> &state() {
+      static std::atomic<latency_histogram_registry *> s{nullptr};
+      return s;
+    }
+
+    static void attach(latency_histogram_registry *s) {
+      state().store(s, std::memory_order_release);
+    }
+
+    // The typed readers are converted to DDS::DataReader first, so the generated
+    // code and the wrapper look up the same key.
+    static const void *key(::DDS::DataReader_ptr reader) {
+      return reader;
+    }
+
+    class handle;
+
+    // Lock-free lookup used by every read and take, the histogram stays alive
+    // while the returned handle is in scope.
+    static handle find(::DDS::DataReader_ptr reader);
+
+    // Returns false when the maximum number of readers with a histogram has been reached.
+    static bool enable(::DDS::DataReader_ptr reader, bool enabled);
+
+    // Called once the reader has been deleted, so a reader created later at the
+    // same address does not inherit the histogram.
+    static void release(latency_histogram_registry *s, ::DDS::DataReader_ptr reader);
+
+    // Only the samples not seen before are recorded, a read followed by a take
+    // of the same sample counts once.
+    static void record(::DDS::DataReader_ptr reader, const ::DDS::SampleInfo &info);
+
+    static void record(::DDS::DataReader_ptr reader, const ::DDS::SampleInfoSeq &infos);
+
+private:
+    std::atomic<ACE_UINT64> count_;
+    std::atomic<ACE_UINT64> sum_;
+    std::atomic<ACE_UINT64> min_;
+    std::atomic<ACE_UINT64> max_;
+    std::atomic<ACE_UINT64> buckets_[LATENCY_HISTOGRAM_BUCKETS];
+};
+
+#define LATENCY_HISTOGRAM_MAX_READERS 256
+
+struct latency_histogram_slot {
+  // Reader of the histogram, null when the slot is free.
+  std::atomic<const void *> reader{nullptr};
+  std::atomic<latency_histogram *> histogram{nullptr};
+  // Threads currently using the histogram, the release waits for them before
+  // freeing it.
+  std::atomic<ACE_UINT32> users{0};
+};
+
+// Readers with an enabled histogram. Owned by OpenDDSWrapper and shared with
+// the generated libraries through an attach call, so deleting a reader
+// releases its histogram whichever library recorded it. The read and take
+// paths only scan the used slots with atomic loads, the lock serializes
+// enable and release.
+struct latency_histogram_registry {
+  std::mutex lock;
+  // Only scanned when at least one reader has the histogram enabled,
+  // otherwise recording is a single atomic load.
+  std::atomic<ACE_UINT32> enabled_readers{0};
+  // High water mark of the used slots, bounds the lookups.
+  std::atomic<ACE_UINT32> slot_count{0};
+  latency_histogram_slot slots[LATENCY_HISTOGRAM_MAX_READERS];
+};
+
+class latency_histogram::handle {
+
+public:
+    handle()
+      : slot_(nullptr),
+        histogram_(nullptr) {
+    }
+
+    handle(latency_histogram_slot *slot, latency_histogram *histogram)
+      : slot_(slot),
+        histogram_(histogram) {
+    }
+
+    handle(handle &&other) noexcept
+      : slot_(other.slot_),
+        histogram_(other.histogram_) {
+      other.slot_ = nullptr;
+      other.histogram_ = nullptr;
+    }
+
+    handle(const handle &) = delete;
+    handle &operator=(const handle &) = delete;
+    handle &operator=(handle &&) = delete;
+
+    ~handle() {
+      if (slot_) {
+        slot_->users.fetch_sub(1, std::memory_order_release);
+      }
+    }
+
+    explicit operator bool() const {
+      return histogram_ != nullptr;
+    }
+
+    latency_histogram *operator->() const {
+      return histogram_;
+    }
+
+private:
+    latency_histogram_slot *slot_;
+    latency_histogram *histogram_;
+};
+
+inline latency_histogram::handle latency_histogram::find(::DDS::DataReader_ptr reader) {
+  latency_histogram_registry *s = state().load(std::memory_order_acquire);
+  if (!s || s->enabled_readers.load(std::memory_order_acquire) == 0) {
+    return handle();
+  }
+
+  const void *k = key(reader);
+  const ACE_UINT32 count = s->slot_count.load(std::memory_order_acquire);
+  for (ACE_UINT32 i = 0; i < count && i < LATENCY_HISTOGRAM_MAX_READERS; ++i) {
+    latency_histogram_slot &slot = s->slots[i];
+    if (slot.reader.load(std::memory_order_relaxed) != k) {
+      continue;
+    }
+
+    // Announce the use before checking the slot again, so a concurrent
+    // release either sees the user or is seen here.
+    slot.users.fetch_add(1, std::memory_order_seq_cst);
+    if (slot.reader.load(std::memory_order_seq_cst) == k) {
+      return handle(&slot, slot.histogram.load(std::memory_order_acquire));
+    }
+    slot.users.fetch_sub(1, std::memory_order_release);
+  }
+
+  return handle();
+}
+
+inline bool latency_histogram::enable(::DDS::DataReader_ptr reader, bool enabled) {
+  latency_histogram_registry *s = state().load(std::memory_order_acquire);
+  if (!s) {
+    return false;
+  }
+
+  if (!enabled) {
+    release(s, reader);
+    return true;
+  }
+
+  const void *k = key(reader);
+  std::lock_guard<std::mutex> guard(s->lock);
+  const ACE_UINT32 count = s->slot_count.load(std::memory_order_relaxed);
+  for (ACE_UINT32 i = 0; i < count; ++i) {
+    if (s->slots[i].reader.load(std::memory_order_relaxed) == k) {
+      return true;
+    }
+  }
+
+  for (ACE_UINT32 i = 0; i < LATENCY_HISTOGRAM_MAX_READERS; ++i) {
+    latency_histogram_slot &slot = s->slots[i];
+    if (slot.reader.load(std::memory_order_relaxed) == nullptr) {
+      slot.histogram.store(new latency_histogram(), std::memory_order_relaxed);
+      slot.reader.store(k, std::memory_order_seq_cst);
+      if (i + 1 > count) {
+        s->slot_count.store(i + 1, std::memory_order_release);
+      }
+      s->enabled_readers.fetch_add(1, std::memory_order_release);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+inline void latency_histogram::release(latency_histogram_registry *s, ::DDS::DataReader_ptr reader) {
+  const void *k = key(reader);
+  std::lock_guard<std::mutex> guard(s->lock);
+  const ACE_UINT32 count = s->slot_count.load(std::memory_order_relaxed);
+  for (ACE_UINT32 i = 0; i < count; ++i) {
+    latency_histogram_slot &slot = s->slots[i];
+    if (slot.reader.load(std::memory_order_relaxed) != k) {
+      continue;
+    }
+
+    slot.reader.store(nullptr, std::memory_order_seq_cst);
+    while (slot.users.load(std::memory_order_seq_cst) != 0) {
+      std::this_thread::yield();
+    }
+
+    delete slot.histogram.exchange(nullptr, std::memory_order_acq_rel);
+    s->enabled_readers.fetch_sub(1, std::memory_order_release);
+    return;
+  }
+}
+
+inline void latency_histogram::record(::DDS::DataReader_ptr reader, const ::DDS::SampleInfo &info) {
+  handle h = find(reader);
+  if (h && info.valid_data && info.sample_state == ::DDS::NOT_READ_SAMPLE_STATE) {
+    h->record(latency(info.source_timestamp));
+  }
+}
+
+inline void latency_histogram::record(::DDS::DataReader_ptr reader, const ::DDS::SampleInfoSeq &infos) {
+  handle h = find(reader);
+  if (!h) {
+    return;
+  }
+
+  for (CORBA::ULong i = 0; i < infos.length(); ++i) {
+    if (infos[i].valid_data && infos[i].sample_state == ::DDS::NOT_READ_SAMPLE_STATE) {
+      h->record(latency(infos[i].source_timestamp));
+    }
+  }
+}
+
+#endif
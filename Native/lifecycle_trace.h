@@ -0,0 +1,287 @@
+#ifndef _LIFECYCLE_TRACE_H_
+#define _LIFECYCLE_TRACE_H_
+
+#include "ace/Basic_Types.h"
+#include "dds/DdsDcpsSubscriptionC.h"
+#include "latency_histogram.h"
+
+#include <atomic>
+#include <chrono>
+
+// Aggregated breakdown of the latency of the samples received by a reader.
+// The stages are stamped in different modules: the listener dispatch in
+// OpenDDSWrapper and the first read or take in the generated type support
+// libraries, so the counters live in the lifecycle_state owned by
+// OpenDDSWrapper and shared through attach, like the trace_events rings.
+// Nothing is stamped by the writer and the samples are not correlated one by
+// one: each stage only keeps the count, sum, minimum and maximum of the
+// intervals it observed, so the stages are not required to add up.
+#define LIFECYCLE_TRACE_MAX_READERS 256
+
+#ifndef EXTERN_STRUCT_EXPORT
+    #define EXTERN_STRUCT_EXPORT extern "C" struct
+#endif
+
+enum LifecycleTraceStage {
+  // Source timestamp to the insertion in the reader cache, as measured by the
+  // OpenDDS reader latency statistics. OpenDDS aggregates it per publication
+  // over every sample received since the statistics were enabled or reset,
+  // so it does not cover the same samples as the other stages.
+  LIFECYCLE_STAGE_TRANSPORT,
+  // Entry of on_data_available to the entry of the managed callback.
+  LIFECYCLE_STAGE_DISPATCH,
+  // Oldest pending on_data_available, or managed callback entry, to the
+  // first read or take that follows.
+  LIFECYCLE_STAGE_CACHE_DWELL,
+  // Source timestamp to the first read or take of each sample.
+  LIFECYCLE_STAGE_END_TO_END,
+  LIFECYCLE_STAGE_COUNT
+};
+
+#pragma pack(push, 1)
+// All values in nanoseconds.
+EXTERN_STRUCT_EXPORT LifecycleStageWrapper {
+  ACE_UINT64 count;
+  ACE_UINT64 sum;
+  ACE_UINT64 min;
+  ACE_UINT64 max;
+};
+#pragma pack(pop)
+
+struct lifecycle_stage {
+  std::atomic<ACE_UINT64> count;
+  std::atomic<ACE_UINT64> sum;
+  std::atomic<ACE_UINT64> min;
+  std::atomic<ACE_UINT64> max;
+};
+
+struct lifecycle_slot {
+  // Traced reader, null when the slot is free. Instance handles are only
+  // unique within a participant, so the slots are keyed by the reader itself
+  // and released when the reader is deleted.
+  std::atomic<const void *> reader;
+  // Steady clock stamps of the oldest on_data_available not consumed by a
+  // read or take and of the running managed callback, zero when there is none.
+  std::atomic<ACE_UINT64> notification;
+  std::atomic<ACE_UINT64> managed_entry;
+  // Whether the OpenDDS reader statistics were already enabled before the
+  // trace turned them on, restored when the trace is disabled.
+  std::atomic<bool> statistics_enabled;
+  lifecycle_stage stages[LIFECYCLE_STAGE_COUNT];
+};
+
+struct lifecycle_state {
+  std::atomic<ACE_UINT32> enabled_readers;
+  // High water mark of the used slots, bounds the lookups.
+  std::atomic<ACE_UINT32> slot_count;
+  lifecycle_slot slots[LIFECYCLE_TRACE_MAX_READERS];
+};
+
+class lifecycle_trace {
+
+public:
+    static std::atomic<lifecycle_state *> &state() {
+      static std::atomic<lifecycle_state *> s{nullptr};
+      return s;
+    }
+
+    static void attach(lifecycle_state *s) {
+      state().store(s, std::memory_order_release);
+    }
+
+    // The only cost paid by every read, take and listener call when no reader is traced.
+    static lifecycle_state *active() {
+      lifecycle_state *s = state().load(std::memory_order_acquire);
+      return s && s->enabled_readers.load(std::memory_order_relaxed) > 0 ? s : nullptr;
+    }
+
+    static ACE_UINT64 now() {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // The typed readers are converted to DDS::DataReader first, so the generated
+    // code and the listener look up the same key.
+    static const void *key(::DDS::DataReader_ptr reader) {
+      return reader;
+    }
+
+    static lifecycle_slot *find(lifecycle_state *s, ::DDS::DataReader_ptr reader) {
+      const void *k = key(reader);
+      const ACE_UINT32 count = s->slot_count.load(std::memory_order_acquire);
+      for (ACE_UINT32 i = 0; i < count && i < LIFECYCLE_TRACE_MAX_READERS; ++i) {
+        if (s->slots[i].reader.load(std::memory_order_relaxed) == k) {
+          return &s->slots[i];
+        }
+      }
+      return nullptr;
+    }
+
+    static lifecycle_slot *find(::DDS::DataReader_ptr reader) {
+      lifecycle_state *s = active();
+      return s ? find(s, reader) : nullptr;
+    }
+
+    static bool enable(lifecycle_state *s, ::DDS::DataReader_ptr reader, bool enabled) {
+      lifecycle_slot *slot = find(s, reader);
+      if (!enabled) {
+        release(s, slot, key(reader));
+        return true;
+      }
+
+      if (slot) {
+        return true;
+      }
+
+      for (ACE_UINT32 i = 0; i < LIFECYCLE_TRACE_MAX_READERS; ++i) {
+        const void *expected = nullptr;
+        if (s->slots[i].reader.load(std::memory_order_relaxed) == nullptr) {
+          reset(s->slots[i]);
+          if (s->slots[i].reader.compare_exchange_strong(expected, key(reader), std::memory_order_acq_rel)) {
+            ACE_UINT32 count = s->slot_count.load(std::memory_order_relaxed);
+            while (count < i + 1 && !s->slot_count.compare_exchange_weak(count, i + 1, std::memory_order_release)) {
+            }
+            s->enabled_readers.fetch_add(1, std::memory_order_relaxed);
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    // Called once the reader has been deleted, so a reader created later at the
+    // same address does not inherit the slot.
+    static void release(lifecycle_state *s, ::DDS::DataReader_ptr reader) {
+      release(s, find(s, reader), key(reader));
+    }
+
+    static void reset(lifecycle_slot &slot) {
+      slot.notification.store(0, std::memory_order_relaxed);
+      slot.managed_entry.store(0, std::memory_order_relaxed);
+      for (auto &stage : slot.stages) {
+        stage.count.store(0, std::memory_order_relaxed);
+        stage.sum.store(0, std::memory_order_relaxed);
+        stage.min.store(~static_cast<ACE_UINT64>(0), std::memory_order_relaxed);
+        stage.max.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    static void record(lifecycle_slot &slot, LifecycleTraceStage stage, ACE_UINT64 value) {
+      lifecycle_stage &s = slot.stages[stage];
+      s.count.fetch_add(1, std::memory_order_relaxed);
+      s.sum.fetch_add(value, std::memory_order_relaxed);
+
+      ACE_UINT64 current = s.min.load(std::memory_order_relaxed);
+      while (value < current && !s.min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      }
+
+      current = s.max.load(std::memory_order_relaxed);
+      while (value > current && !s.max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      }
+    }
+
+    static void snapshot(const lifecycle_slot &slot, LifecycleStageWrapper *stages) {
+      for (int i = 0; i < LIFECYCLE_STAGE_COUNT; ++i) {
+        stages[i].count = slot.stages[i].count.load(std::memory_order_relaxed);
+        stages[i].sum = slot.stages[i].sum.load(std::memory_order_relaxed);
+        stages[i].min = stages[i].count > 0 ? slot.stages[i].min.load(std::memory_order_relaxed) : 0;
+        stages[i].max = slot.stages[i].max.load(std::memory_order_relaxed);
+      }
+    }
+
+    // Called on entry to on_data_available, which OpenDDS dispatches after the
+    // sample has been inserted in the reader cache. Only the oldest pending
+    // notification is kept.
+    static void notification(lifecycle_slot *slot) {
+      if (slot) {
+        ACE_UINT64 expected = 0;
+        slot->notification.compare_exchange_strong(expected, now(), std::memory_order_relaxed);
+      }
+    }
+
+    static void managed_entry(lifecycle_slot *slot) {
+      const ACE_UINT64 entry = now();
+      slot->managed_entry.store(entry, std::memory_order_relaxed);
+
+      const ACE_UINT64 notified = slot->notification.load(std::memory_order_relaxed);
+      if (notified != 0 && entry > notified) {
+        record(*slot, LIFECYCLE_STAGE_DISPATCH, entry - notified);
+      }
+    }
+
+    static void managed_exit(lifecycle_slot *slot) {
+      slot->managed_entry.store(0, std::memory_order_relaxed);
+    }
+
+    // Only the samples not seen before are recorded, a read followed by a take
+    // of the same sample counts once.
+    static void take(::DDS::DataReader_ptr reader, const ::DDS::SampleInfo &info) {
+      lifecycle_slot *slot = find(reader);
+      if (slot && info.valid_data && info.sample_state == ::DDS::NOT_READ_SAMPLE_STATE) {
+        dwell(*slot);
+        record(*slot, LIFECYCLE_STAGE_END_TO_END, latency_histogram::latency(info.source_timestamp));
+      }
+    }
+
+    static void take(::DDS::DataReader_ptr reader, const ::DDS::SampleInfoSeq &infos) {
+      lifecycle_slot *slot = find(reader);
+      if (!slot) {
+        return;
+      }
+
+      bool first = true;
+      for (CORBA::ULong i = 0; i < infos.length(); ++i) {
+        if (infos[i].valid_data && infos[i].sample_state == ::DDS::NOT_READ_SAMPLE_STATE) {
+          if (first) {
+            dwell(*slot);
+            first = false;
+          }
+          record(*slot, LIFECYCLE_STAGE_END_TO_END, latency_histogram::latency(infos[i].source_timestamp));
+        }
+      }
+    }
+
+    // Managed scope of the listener callback, stamps the entry and clears it on exit.
+    class managed_scope {
+
+    public:
+        explicit managed_scope(lifecycle_slot *slot)
+          : slot_(slot) {
+          if (slot_) {
+            managed_entry(slot_);
+          }
+        }
+
+        ~managed_scope() {
+          if (slot_) {
+            managed_exit(slot_);
+          }
+        }
+
+    private:
+        lifecycle_slot *const slot_;
+    };
+
+private:
+    static void release(lifecycle_state *s, lifecycle_slot *slot, const void *reader) {
+      if (slot && slot->reader.compare_exchange_strong(reader, nullptr, std::memory_order_acq_rel)) {
+        s->enabled_readers.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+
+    // The cache dwell is accounted once per read or take call: from the
+    // callback entry when called from the listener, otherwise from the oldest
+    // notification pending since the previous call.
+    static void dwell(lifecycle_slot &slot) {
+      const ACE_UINT64 taken = now();
+      const ACE_UINT64 notified = slot.notification.exchange(0, std::memory_order_relaxed);
+      const ACE_UINT64 entry = slot.managed_entry.load(std::memory_order_relaxed);
+      const ACE_UINT64 start = entry > notified ? entry : notified;
+      if (start != 0 && taken > start) {
+        record(slot, LIFECYCLE_STAGE_CACHE_DWELL, taken - start);
+      }
+    }
+};
+
+#endif
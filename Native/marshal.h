@@ -5,6 +5,7 @@
 #include "tao/Unbounded_Value_Sequence_T.h"
 #include "dds/DCPS/Serializer.h"
 #include "dds/DdsDcpsCoreC.h"
+#include "alloc_accounting.h"
 
 class marshal {
 
@@ -36,6 +37,7 @@ public:
       const size_t struct_size = sizeof(T);
       const size_t buffer_size = (length * struct_size) + sizeof length;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
       ACE_OS::memcpy(bytes, &length, sizeof length);
 
       for (ACE_UINT32 i = 0; i < length; i++) {
@@ -44,6 +46,7 @@ public:
 
       // Alloc memory for the pointer
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -68,10 +71,12 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(char *);
       char **pointers = new char *[length];
+      ALLOC_TEMPORARY(length * sizeof(char *));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
         sequence[i] = CORBA::string_dup(pointers[i]);
+        ALLOC_TEMPORARY_STRING(pointers[i]);
       }
 
       delete[] pointers;
@@ -93,10 +98,12 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(wchar_t *);
       wchar_t **pointers = new wchar_t *[length];
+      ALLOC_TEMPORARY(length * sizeof(wchar_t *));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
         sequence[i] = CORBA::wstring_dup(pointers[i]);
+        ALLOC_TEMPORARY_STRING(pointers[i]);
       }
 
       delete[] pointers;
@@ -108,15 +115,17 @@ public:
       const size_t struct_size = sizeof(char *);
       const size_t buffer_size = (length * struct_size) + sizeof length;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
       ACE_OS::memcpy(bytes, &length, sizeof length);
 
       for (ACE_UINT32 i = 0; i < length; i++) {
-        char *str = CORBA::string_dup(sequence[i]);
+        char *str = ALLOC_STRING_DUP(sequence[i]);
         ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &str, struct_size);
       }
 
       // Alloc memory for the poninter
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -131,15 +140,17 @@ public:
       const size_t struct_size = sizeof(wchar_t *);
       const size_t buffer_size = (length * struct_size) + sizeof length;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
       ACE_OS::memcpy(bytes, &length, sizeof length);
 
       for (ACE_UINT32 i = 0; i < length; i++) {
-        wchar_t *str = CORBA::wstring_dup(sequence[i]);
+        wchar_t *str = ALLOC_WSTRING_DUP(sequence[i]);
         ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &str, struct_size);
       }
 
       // Alloc memory for the poninter
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -162,14 +173,17 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(char *);
       char **pointers = new char *[length];
+      ALLOC_TEMPORARY(length * sizeof(char *));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
+        ALLOC_RELEASE(pointers[i]);
         CORBA::string_free(pointers[i]);
       }
 
       delete[] pointers;
 
+      ALLOC_RELEASE(ptr);
       ACE_OS::free(ptr);
     }
 
@@ -187,14 +201,17 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(wchar_t *);
       wchar_t **pointers = new wchar_t *[length];
+      ALLOC_TEMPORARY(length * sizeof(wchar_t *));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
+        ALLOC_RELEASE(pointers[i]);
         CORBA::wstring_free(pointers[i]);
       }
 
       delete[] pointers;
 
+      ALLOC_RELEASE(ptr);
       ACE_OS::free(ptr);
     }
 
@@ -213,6 +230,7 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(T);
       T *structures = new T[length];
+      ALLOC_TEMPORARY(length * sizeof(T));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&structures[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
@@ -221,6 +239,7 @@ public:
 
       delete[] structures;
 
+      ALLOC_RELEASE(ptr);
       ACE_OS::free(ptr);
     }
 
@@ -233,10 +252,12 @@ public:
 
       const size_t struct_size = sizeof(char *);
       char **pointers = new char *[length];
+      ALLOC_TEMPORARY(length * sizeof(char *));
       for (ACE_INT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[i * struct_size], struct_size);
 
         arr[i] = CORBA::string_dup(pointers[i]);
+        ALLOC_TEMPORARY_STRING(pointers[i]);
       }
 
       delete[] pointers;
@@ -251,10 +272,12 @@ public:
 
       const size_t struct_size = sizeof(wchar_t *);
       wchar_t **pointers = new wchar_t *[length];
+      ALLOC_TEMPORARY(length * sizeof(wchar_t *));
       for (ACE_INT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[i * struct_size], struct_size);
 
         arr[i] = CORBA::wstring_dup(pointers[i]);
+        ALLOC_TEMPORARY_STRING(pointers[i]);
       }
 
       delete[] pointers;
@@ -264,14 +287,16 @@ public:
       const size_t struct_size = sizeof(char *);
       const size_t buffer_size = length * struct_size;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
 
       for (ACE_INT32 i = 0; i < length; i++) {
-        char *str = CORBA::string_dup(arr[i]);
+        char *str = ALLOC_STRING_DUP(arr[i]);
         ACE_OS::memcpy(&bytes[i * struct_size], &str, struct_size);
       }
 
       // Alloc memory for the poninter
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -284,14 +309,16 @@ public:
       const size_t struct_size = sizeof(wchar_t *);
       const size_t buffer_size = length * struct_size;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
 
       for (ACE_INT32 i = 0; i < length; i++) {
-        wchar_t *str = CORBA::wstring_dup(arr[i]);
+        wchar_t *str = ALLOC_WSTRING_DUP(arr[i]);
         ACE_OS::memcpy(&bytes[i * struct_size], &str, struct_size);
       }
 
       // Alloc memory for the poninter
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -309,14 +336,17 @@ public:
 
       const size_t struct_size = sizeof(char *);
       char **pointers = new char *[length];
+      ALLOC_TEMPORARY(length * sizeof(char *));
       for (ACE_INT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[i * struct_size], struct_size);
 
+        ALLOC_RELEASE(pointers[i]);
         CORBA::string_free(pointers[i]);
       }
 
       delete[] pointers;
 
+      ALLOC_RELEASE(ptr);
       free(ptr);
     }
 
@@ -329,14 +359,17 @@ public:
 
       const size_t struct_size = sizeof(wchar_t *);
       wchar_t **pointers = new wchar_t *[length];
+      ALLOC_TEMPORARY(length * sizeof(wchar_t *));
       for (ACE_INT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[i * struct_size], struct_size);
 
+        ALLOC_RELEASE(pointers[i]);
         CORBA::wstring_free(pointers[i]);
       }
 
       delete[] pointers;
 
+      ALLOC_RELEASE(ptr);
       free(ptr);
     }
 
@@ -367,6 +400,7 @@ public:
       const size_t struct_size = sizeof(T);
       const size_t buffer_size = (length * struct_size) + sizeof length;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
       ACE_OS::memcpy(bytes, &length, sizeof length);
 
       for (ACE_UINT32 i = 0; i < length; i++) {
@@ -375,6 +409,7 @@ public:
 
       // Alloc memory for the pointer
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -400,10 +435,12 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(char *);
       char **pointers = new char *[length];
+      ALLOC_TEMPORARY(length * sizeof(char *));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
         sequence[i] = CORBA::string_dup(pointers[i]);
+        ALLOC_TEMPORARY_STRING(pointers[i]);
       }
 
       delete[] pointers;
@@ -426,10 +463,12 @@ public:
       const size_t structs_offset = sizeof length;
       const size_t struct_size = sizeof(wchar_t *);
       wchar_t **pointers = new wchar_t *[length];
+      ALLOC_TEMPORARY(length * sizeof(wchar_t *));
       for (ACE_UINT32 i = 0; i < length; i++) {
         ACE_OS::memcpy(&pointers[i], &bytes[(i * struct_size) + structs_offset], struct_size);
 
         sequence[i] = CORBA::wstring_dup(pointers[i]);
+        ALLOC_TEMPORARY_STRING(pointers[i]);
       }
 
       delete[] pointers;
@@ -442,15 +481,17 @@ public:
       const size_t struct_size = sizeof(char *);
       const size_t buffer_size = (length * struct_size) + sizeof length;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
       ACE_OS::memcpy(bytes, &length, sizeof length);
 
       for (ACE_UINT32 i = 0; i < length; i++) {
-        char *str = CORBA::string_dup(sequence[i]);
+        char *str = ALLOC_STRING_DUP(sequence[i]);
         ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &str, struct_size);
       }
 
       // Alloc memory for the poninter
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -466,15 +507,17 @@ public:
       const size_t struct_size = sizeof(wchar_t *);
       const size_t buffer_size = (length * struct_size) + sizeof length;
       char *bytes = new char[buffer_size];
+      ALLOC_TEMPORARY(buffer_size);
       ACE_OS::memcpy(bytes, &length, sizeof length);
 
       for (ACE_UINT32 i = 0; i < length; i++) {
-        wchar_t *str = CORBA::wstring_dup(sequence[i]);
+        wchar_t *str = ALLOC_WSTRING_DUP(sequence[i]);
         ACE_OS::memcpy(&bytes[(i * struct_size) + sizeof length], &str, struct_size);
       }
 
       // Alloc memory for the poninter
       ptr = ACE_OS::malloc(buffer_size);
+      ALLOC_RECORD(ptr, buffer_size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, bytes, buffer_size);
@@ -502,6 +545,7 @@ public:
 
       // Alloc memory for the pointer
       void *ptr = ACE_OS::malloc(size);
+      ALLOC_RECORD(ptr, size);
 
       // Copy the bytes in the pointer
       ACE_OS::memcpy(ptr, &wchar, size);
@@ -605,6 +649,7 @@ public:
       }
 
       data = (char*)malloc(xcdr_size);
+      ALLOC_RECORD(data, xcdr_size);
       memcpy(data, mb.base(), xcdr_size);
       size = xcdr_size;
     }
@@ -695,6 +740,7 @@ public:
       }
 
       data = (char*)malloc(xcdr_size);
+      ALLOC_RECORD(data, xcdr_size);
       memcpy(data, mb.base(), xcdr_size);
       size = xcdr_size;
     }
@@ -0,0 +1,232 @@
+#ifndef _TRACE_EVENTS_H_
+#define _TRACE_EVENTS_H_
+
+#include "ace/Basic_Types.h"
+#include "ace/OS_NS_Thread.h"
+#include "ace/OS_NS_string.h"
+
+#include <atomic>
+#include <chrono>
+#include <new>
+
+// Flight recorder of the native hot path. Every thread writes complete
+// events (name, start, duration and an optional size) to its own ring, the
+// rings are shared by OpenDDSWrapper and the generated type support
+// libraries through the trace_state owned by OpenDDSWrapper, which writes
+// them to a Chrome/Perfetto trace file on demand.
+#define TRACE_EVENTS_MAX_RINGS 256
+#define TRACE_EVENTS_RING_CAPACITY 8192
+// The events of a ring are allocated by chunks on first use, a thread that
+// only records a few events doesn't pay for the whole capacity.
+#define TRACE_EVENTS_CHUNK_CAPACITY 512
+#define TRACE_EVENTS_RING_CHUNKS (TRACE_EVENTS_RING_CAPACITY / TRACE_EVENTS_CHUNK_CAPACITY)
+#define TRACE_EVENTS_NO_ARG (~static_cast<ACE_UINT64>(0))
+// Category of the spans that block waiting for something else (i.e. WaitSet_Wait),
+// their duration is not a latency spike so they never fire the trigger.
+#define TRACE_EVENTS_WAIT_CATEGORY "wait"
+
+struct trace_event {
+  const char *name;
+  const char *category;
+  ACE_UINT64 thread_id;
+  ACE_UINT64 start;
+  ACE_UINT64 duration;
+  ACE_UINT64 arg;
+};
+
+// Single producer ring, only written by the thread that owns it. The reader
+// drops the events that could have been overwritten while it was copying.
+// Clearing only moves the cleared mark, the producer's head is never reset
+// under its feet.
+struct trace_ring {
+  std::atomic<bool> owned;
+  std::atomic<ACE_UINT64> head;
+  std::atomic<ACE_UINT64> cleared;
+  std::atomic<trace_event *> chunks[TRACE_EVENTS_RING_CHUNKS];
+
+  // Slot of the given event index, null if the producer never got there.
+  const trace_event *slot(ACE_UINT64 index) const {
+    const ACE_UINT64 position = index % TRACE_EVENTS_RING_CAPACITY;
+    const trace_event *chunk = chunks[position / TRACE_EVENTS_CHUNK_CAPACITY].load(std::memory_order_acquire);
+    return chunk ? &chunk[position % TRACE_EVENTS_CHUNK_CAPACITY] : nullptr;
+  }
+};
+
+struct trace_state {
+  std::atomic<bool> enabled;
+  std::atomic<bool> triggered;
+  // Duration in nanoseconds that freezes the rings, zero to never trigger.
+  std::atomic<ACE_UINT64> trigger_threshold;
+  std::atomic<ACE_UINT32> ring_count;
+  std::atomic<trace_ring *> rings[TRACE_EVENTS_MAX_RINGS];
+};
+
+class trace_events {
+
+public:
+    static std::atomic<trace_state *> &state() {
+      static std::atomic<trace_state *> s{nullptr};
+      return s;
+    }
+
+    static void attach(trace_state *s) {
+      state().store(s, std::memory_order_release);
+    }
+
+    // The only cost paid by every traced call when tracing is disabled.
+    static trace_state *active() {
+      trace_state *s = state().load(std::memory_order_acquire);
+      return s && s->enabled.load(std::memory_order_relaxed) ? s : nullptr;
+    }
+
+    static ACE_UINT64 now() {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void record(trace_state *s, const char *name, const char *category, ACE_UINT64 start, ACE_UINT64 duration, ACE_UINT64 arg) {
+      trace_ring *ring = local_ring(s);
+      if (!ring) {
+        return;
+      }
+
+      const ACE_UINT64 head = ring->head.load(std::memory_order_relaxed);
+      const ACE_UINT64 position = head % TRACE_EVENTS_RING_CAPACITY;
+      std::atomic<trace_event *> &chunk_ptr = ring->chunks[position / TRACE_EVENTS_CHUNK_CAPACITY];
+      trace_event *chunk = chunk_ptr.load(std::memory_order_relaxed);
+      if (!chunk) {
+        chunk = new (std::nothrow) trace_event[TRACE_EVENTS_CHUNK_CAPACITY];
+        if (!chunk) {
+          return;
+        }
+        chunk_ptr.store(chunk, std::memory_order_release);
+      }
+
+      trace_event &e = chunk[position % TRACE_EVENTS_CHUNK_CAPACITY];
+      e.name = name;
+      e.category = category;
+      e.thread_id = thread_id();
+      e.start = start;
+      e.duration = duration;
+      e.arg = arg;
+      ring->head.store(head + 1, std::memory_order_release);
+
+      // The first event over the threshold stops the recording, so the rings
+      // keep what happened just before the spike until they are flushed.
+      const ACE_UINT64 threshold = s->trigger_threshold.load(std::memory_order_relaxed);
+      if (threshold > 0 && duration >= threshold && !blocking_wait(category) && !s->triggered.exchange(true)) {
+        s->enabled.store(false, std::memory_order_relaxed);
+      }
+    }
+
+    class scope {
+
+    public:
+        scope(const char *name, const char *category)
+          : state_(trace_events::active()), name_(name), category_(category), start_(state_ ? now() : 0) {
+        }
+
+        ~scope() {
+          stop();
+        }
+
+        bool recording() const {
+          return state_ != nullptr;
+        }
+
+        void arg(ACE_UINT64 value) {
+          arg_ = value;
+        }
+
+        void stop() {
+          if (state_) {
+            record(state_, name_, category_, start_, now() - start_, arg_);
+            state_ = nullptr;
+          }
+        }
+
+    private:
+        trace_state *state_;
+        const char *name_;
+        const char *category_;
+        const ACE_UINT64 start_;
+        ACE_UINT64 arg_ = TRACE_EVENTS_NO_ARG;
+    };
+
+private:
+    static bool blocking_wait(const char *category) {
+      return ACE_OS::strcmp(category, TRACE_EVENTS_WAIT_CATEGORY) == 0;
+    }
+
+    static ACE_UINT64 thread_id() {
+      thread_local const ACE_UINT64 id = (ACE_UINT64) ACE_OS::thr_self();
+      return id;
+    }
+
+    // Gives the ring back when the thread exits, short lived threads (i.e. the
+    // listener dispatch) reuse the rings instead of allocating new ones.
+    struct ring_holder {
+      trace_ring *ring = nullptr;
+      trace_state *owner = nullptr;
+
+      ~ring_holder() {
+        if (ring) {
+          ring->owned.store(false, std::memory_order_release);
+        }
+      }
+    };
+
+    static trace_ring *local_ring(trace_state *s) {
+      thread_local ring_holder holder;
+      if (holder.owner != s) {
+        if (holder.ring) {
+          holder.ring->owned.store(false, std::memory_order_release);
+        }
+        holder.ring = acquire_ring(s);
+        holder.owner = s;
+      }
+      return holder.ring;
+    }
+
+    static trace_ring *acquire_ring(trace_state *s) {
+      const ACE_UINT32 count = s->ring_count.load(std::memory_order_acquire);
+      for (ACE_UINT32 i = 0; i < count && i < TRACE_EVENTS_MAX_RINGS; ++i) {
+        trace_ring *ring = s->rings[i].load(std::memory_order_acquire);
+        bool expected = false;
+        if (ring && ring->owned.compare_exchange_strong(expected, true)) {
+          return ring;
+        }
+      }
+
+      const ACE_UINT32 index = s->ring_count.fetch_add(1);
+      if (index >= TRACE_EVENTS_MAX_RINGS) {
+        return nullptr;
+      }
+
+      trace_ring *ring = new (std::nothrow) trace_ring();
+      if (ring) {
+        ring->owned.store(true, std::memory_order_relaxed);
+        ring->head.store(0, std::memory_order_relaxed);
+        ring->cleared.store(0, std::memory_order_relaxed);
+      }
+      s->rings[index].store(ring, std::memory_order_release);
+      return ring;
+    }
+};
+
+#define TRACE_EVENTS_CONCAT_IMPL(a, b) a##b
+#define TRACE_EVENTS_CONCAT(a, b) TRACE_EVENTS_CONCAT_IMPL(a, b)
+
+#define TRACE_EVENT_SCOPE(NAME, CATEGORY) \
+  trace_events::scope TRACE_EVENTS_CONCAT(trace_scope_, __LINE__)(NAME, CATEGORY)
+#define TRACE_EVENT_SCOPE_NAMED(VAR, NAME, CATEGORY) trace_events::scope VAR(NAME, CATEGORY)
+// The value is only evaluated when the tracer is recording.
+#define TRACE_EVENT_ARG(VAR, VALUE) \
+  do { \
+    if (VAR.recording()) { \
+      VAR.arg(VALUE); \
+    } \
+  } while (0)
+#define TRACE_EVENT_STOP(VAR) VAR.stop()
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef _USDT_PROBES_H_
+#define _USDT_PROBES_H_
+
+// Linux USDT (systemtap sys/sdt.h) probes of the native hot path, usable from
+// bpftrace or perf with the "openddsharp" provider, i.e.:
+//   bpftrace -e 'usdt:./libOpenDDSWrapper.so:openddsharp:waitset_wait_done { @[arg2] = count(); }'
+// Every probe has a semaphore, the arguments that are not free (i.e. the
+// topic names) are only computed while a tracer is attached. On other
+// platforms, or when sys/sdt.h is not available, the probes compile to nothing.
+#if defined(__linux__) && defined(__has_include) && !defined(OPENDDSHARP_NO_USDT)
+#if __has_include(<sys/sdt.h>)
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#define OPENDDSHARP_HAS_USDT
+#endif
+#endif
+
+#ifdef OPENDDSHARP_HAS_USDT
+
+#include "dds/DdsDcpsPublicationC.h"
+#include "dds/DdsDcpsSubscriptionC.h"
+
+#define USDT_SEMAPHORE(NAME) \
+  inline volatile unsigned short openddsharp_##NAME##_semaphore __attribute__((unused, section(".probes"))) = 0
+
+USDT_SEMAPHORE(write_start);
+USDT_SEMAPHORE(write_done);
+USDT_SEMAPHORE(take_start);
+USDT_SEMAPHORE(take_done);
+USDT_SEMAPHORE(serialize_start);
+USDT_SEMAPHORE(serialize_done);
+USDT_SEMAPHORE(deserialize_start);
+USDT_SEMAPHORE(deserialize_done);
+USDT_SEMAPHORE(on_data_available_start);
+USDT_SEMAPHORE(on_data_available_done);
+USDT_SEMAPHORE(waitset_wait_start);
+USDT_SEMAPHORE(waitset_wait_done);
+
+#define USDT_PROBE_ENABLED(NAME) __builtin_expect(openddsharp_##NAME##_semaphore != 0, 0)
+#define USDT_PROBE1(NAME, A1) STAP_PROBE1(openddsharp, NAME, A1)
+#define USDT_PROBE2(NAME, A1, A2) STAP_PROBE2(openddsharp, NAME, A1, A2)
+#define USDT_PROBE3(NAME, A1, A2, A3) STAP_PROBE3(openddsharp, NAME, A1, A2, A3)
+#define USDT_PROBE4(NAME, A1, A2, A3, A4) STAP_PROBE4(openddsharp, NAME, A1, A2, A3, A4)
+
+class usdt_probes {
+
+public:
+    static CORBA::String_var topic_name(::DDS::DataWriter_ptr dw) {
+      ::DDS::Topic_var topic = dw->get_topic();
+      return topic.in() ? topic->get_name() : CORBA::string_dup("");
+    }
+
+    static CORBA::String_var topic_name(::DDS::DataReader_ptr dr) {
+      ::DDS::TopicDescription_var topic = dr->get_topicdescription();
+      return topic.in() ? topic->get_name() : CORBA::string_dup("");
+    }
+
+    // write_start(topic, entity, bytes) and write_done(topic, entity, bytes).
+    class writer_scope {
+
+    public:
+        explicit writer_scope(::DDS::DataWriter_ptr dw)
+          : dw_(dw), enabled_(USDT_PROBE_ENABLED(write_start) || USDT_PROBE_ENABLED(write_done)) {
+        }
+
+        ~writer_scope() {
+          if (enabled_) {
+            USDT_PROBE3(write_done, topic_.in(), dw_, bytes_);
+          }
+        }
+
+        bool enabled() const {
+          return enabled_;
+        }
+
+        void start(size_t bytes) {
+          topic_ = topic_name(dw_);
+          bytes_ = bytes;
+          USDT_PROBE3(write_start, topic_.in(), dw_, bytes_);
+        }
+
+    private:
+        ::DDS::DataWriter_ptr dw_;
+        const bool enabled_;
+        CORBA::String_var topic_;
+        size_t bytes_ = 0;
+    };
+
+    // take_start(topic, entity) and take_done(topic, entity, samples, bytes).
+    class reader_scope {
+
+    public:
+        explicit reader_scope(::DDS::DataReader_ptr dr)
+          : dr_(dr), enabled_(USDT_PROBE_ENABLED(take_start) || USDT_PROBE_ENABLED(take_done)) {
+        }
+
+        ~reader_scope() {
+          if (enabled_) {
+            USDT_PROBE4(take_done, topic_.in(), dr_, samples_, bytes_);
+          }
+        }
+
+        bool enabled() const {
+          return enabled_;
+        }
+
+        void start() {
+          topic_ = topic_name(dr_);
+          USDT_PROBE2(take_start, topic_.in(), dr_);
+        }
+
+        void result(size_t samples, size_t bytes) {
+          samples_ = samples;
+          bytes_ = bytes;
+        }
+
+    private:
+        ::DDS::DataReader_ptr dr_;
+        const bool enabled_;
+        CORBA::String_var topic_;
+        size_t samples_ = 0;
+        size_t bytes_ = 0;
+    };
+
+    // on_data_available_start(topic, entity) and on_data_available_done(topic, entity).
+    class listener_scope {
+
+    public:
+        explicit listener_scope(::DDS::DataReader_ptr dr)
+          : dr_(dr), enabled_(USDT_PROBE_ENABLED(on_data_available_start) || USDT_PROBE_ENABLED(on_data_available_done)) {
+          if (enabled_) {
+            topic_ = topic_name(dr_);
+            USDT_PROBE2(on_data_available_start, topic_.in(), dr_);
+          }
+        }
+
+        ~listener_scope() {
+          if (enabled_) {
+            USDT_PROBE2(on_data_available_done, topic_.in(), dr_);
+          }
+        }
+
+    private:
+        ::DDS::DataReader_ptr dr_;
+        const bool enabled_;
+        CORBA::String_var topic_;
+    };
+};
+
+#define USDT_LISTENER_SCOPE(DR) usdt_probes::listener_scope usdt_scope(DR)
+#define USDT_WRITER_SCOPE(DW, BYTES) \
+  usdt_probes::writer_scope usdt_scope(DW); \
+  if (usdt_scope.enabled()) usdt_scope.start(BYTES)
+#define USDT_READER_SCOPE(DR) \
+  usdt_probes::reader_scope usdt_scope(DR); \
+  if (usdt_scope.enabled()) usdt_scope.start()
+#define USDT_READER_RESULT(SAMPLES, BYTES) \
+  do { \
+    if (usdt_scope.enabled()) { \
+      usdt_scope.result(SAMPLES, BYTES); \
+    } \
+  } while (0)
+
+#else
+
+#define USDT_PROBE_ENABLED(NAME) false
+#define USDT_PROBE1(NAME, A1)
+#define USDT_PROBE2(NAME, A1, A2)
+#define USDT_PROBE3(NAME, A1, A2, A3)
+#define USDT_PROBE4(NAME, A1, A2, A3, A4)
+#define USDT_LISTENER_SCOPE(DR)
+#define USDT_WRITER_SCOPE(DW, BYTES)
+#define USDT_READER_SCOPE(DR)
+#define USDT_READER_RESULT(SAMPLES, BYTES)
+
+#endif
+
+#endif
@@ -0,0 +1,454 @@
+#ifndef _WRAPPER_METRICS_H_
+#define _WRAPPER_METRICS_H_
+
+#include "ace/Basic_Types.h"
+#include "dds/DdsDcpsPublicationC.h"
+#include "dds/DdsDcpsSubscriptionC.h"
+#include "marshal.h"
+
+#include <mutex>
+#include <vector>
+
+// Wrapper-level instrumentation of the generated type support methods.
+// Compiled out unless OPENDDSHARP_WRAPPER_METRICS is defined, in that case every
+// stage of a call (marshaling, memory copies and the OpenDDS call itself) is
+// timed with the CPU timestamp counter and accounted to the calling writer/reader.
+#ifdef OPENDDSHARP_WRAPPER_METRICS
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define OPENDDSHARP_METRICS_HAS_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define OPENDDSHARP_METRICS_HAS_TSC
+#endif
+
+#endif
+
+#ifndef EXTERN_STRUCT_EXPORT
+    #define EXTERN_STRUCT_EXPORT extern "C" struct
+#endif
+
+enum WrapperMetricsStage {
+  METRICS_STAGE_DESERIALIZE,
+  METRICS_STAGE_SERIALIZE,
+  METRICS_STAGE_JSON_DECODE,
+  METRICS_STAGE_JSON_ENCODE,
+  METRICS_STAGE_COPY,
+  METRICS_STAGE_DDS,
+  METRICS_STAGE_COUNT
+};
+
+#define METRICS_HISTOGRAM_BUCKETS 32
+
+#pragma pack(push, 1)
+// Bucket i of the histogram counts the calls that took [2^i, 2^(i+1)) ticks.
+EXTERN_STRUCT_EXPORT MetricsStageWrapper {
+  ACE_UINT64 count;
+  ACE_UINT64 bytes;
+  ACE_UINT64 ticks;
+  ACE_UINT64 histogram[METRICS_HISTOGRAM_BUCKETS];
+};
+
+EXTERN_STRUCT_EXPORT MetricsEntityWrapper {
+  void *entity;
+  MetricsStageWrapper stages[METRICS_STAGE_COUNT];
+};
+#pragma pack(pop)
+
+// Release hooks of the generated libraries, owned by the wrapper so it can
+// forget the metrics of the deleted writers and readers of every type.
+typedef void (*wrapper_metrics_release_hook)(const void *entity);
+
+struct wrapper_metrics_hooks {
+  std::mutex lock;
+  std::vector<wrapper_metrics_release_hook> release;
+};
+
+#ifdef OPENDDSHARP_WRAPPER_METRICS
+
+class wrapper_metrics {
+
+public:
+    static ACE_UINT64 now() {
+#ifdef OPENDDSHARP_METRICS_HAS_TSC
+      return __rdtsc();
+#else
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Counters are only written by their owner thread, relaxed loads and
+    // stores are enough to let the snapshot read them without locking.
+    // Reset never writes them, it moves the baseline instead, which is only
+    // touched under the thread lock by the snapshot and the reset.
+    struct stage_counters {
+      std::atomic<ACE_UINT64> count{0};
+      std::atomic<ACE_UINT64> bytes{0};
+      std::atomic<ACE_UINT64> ticks{0};
+      std::atomic<ACE_UINT64> histogram[METRICS_HISTOGRAM_BUCKETS]{};
+      MetricsStageWrapper base = {};
+
+      void record(ACE_UINT64 elapsed, size_t size) {
+        add(count, 1);
+        add(bytes, size);
+        add(ticks, elapsed);
+        add(histogram[bucket(elapsed)], 1);
+      }
+
+      void accumulate(MetricsStageWrapper &result) const {
+        result.count += count.load(std::memory_order_relaxed) - base.count;
+        result.bytes += bytes.load(std::memory_order_relaxed) - base.bytes;
+        result.ticks += ticks.load(std::memory_order_relaxed) - base.ticks;
+        for (int b = 0; b < METRICS_HISTOGRAM_BUCKETS; ++b) {
+          result.histogram[b] += histogram[b].load(std::memory_order_relaxed) - base.histogram[b];
+        }
+      }
+
+      void rebase() {
+        base.count = count.load(std::memory_order_relaxed);
+        base.bytes = bytes.load(std::memory_order_relaxed);
+        base.ticks = ticks.load(std::memory_order_relaxed);
+        for (int b = 0; b < METRICS_HISTOGRAM_BUCKETS; ++b) {
+          base.histogram[b] = histogram[b].load(std::memory_order_relaxed);
+        }
+      }
+
+      static void add(std::atomic<ACE_UINT64> &counter, ACE_UINT64 value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+      }
+
+      static size_t bucket(ACE_UINT64 elapsed) {
+        size_t b = 0;
+        while (elapsed > 1 && b < METRICS_HISTOGRAM_BUCKETS - 1) {
+          elapsed >>= 1;
+          ++b;
+        }
+        return b;
+      }
+    };
+
+    struct entity_counters {
+      stage_counters stages[METRICS_STAGE_COUNT];
+
+      void accumulate(MetricsEntityWrapper &result) const {
+        for (int s = 0; s < METRICS_STAGE_COUNT; ++s) {
+          stages[s].accumulate(result.stages[s]);
+        }
+      }
+    };
+
+    // Per-thread bucket set. The mutex protects the map structure and the
+    // baselines, it is taken by the owner when a new entity shows up and by
+    // the snapshot, the reset and the release of a deleted entity.
+    // The owner keeps its last entity cached, the cache is dropped when the
+    // registry generation changes, i.e. an entity has been released.
+    struct thread_counters {
+      std::mutex lock;
+      std::unordered_map<const void *, std::shared_ptr<entity_counters> > entities;
+      const void *last_entity = nullptr;
+      std::shared_ptr<entity_counters> last_counters;
+      ACE_UINT64 last_generation = 0;
+
+      entity_counters *get(const void *entity, ACE_UINT64 generation) {
+        if (entity == last_entity && generation == last_generation && last_counters) {
+          return last_counters.get();
+        }
+
+        std::lock_guard<std::mutex> guard(lock);
+        std::shared_ptr<entity_counters> &counters = entities[entity];
+        if (!counters) {
+          counters = std::make_shared<entity_counters>();
+        }
+
+        last_entity = entity;
+        last_counters = counters;
+        last_generation = generation;
+        return last_counters.get();
+      }
+    };
+
+    // One registry per topic type, the tag keeps the thread local storage apart.
+    template<typename Tag>
+    class registry {
+
+    public:
+        static registry &instance() {
+          static registry r;
+          return r;
+        }
+
+        static thread_counters &local() {
+          thread_local thread_handle handle(instance().attach());
+          return *handle.counters;
+        }
+
+        static const void *&current_entity() {
+          thread_local const void *entity = nullptr;
+          return entity;
+        }
+
+        void record(WrapperMetricsStage stage, ACE_UINT64 elapsed, size_t size) {
+          const ACE_UINT64 generation = generation_.load(std::memory_order_acquire);
+          local().get(current_entity(), generation)->stages[stage].record(elapsed, size);
+        }
+
+        void snapshot(std::vector<MetricsEntityWrapper> &result, double &ticks_per_microsecond) {
+          std::unordered_map<const void *, size_t> index;
+
+          std::lock_guard<std::mutex> guard(lock_);
+          for (auto &r : retired_) {
+            index.emplace(r.first, result.size());
+            result.push_back(r.second);
+          }
+
+          for (auto &t : threads_) {
+            std::lock_guard<std::mutex> thread_guard(t->lock);
+            for (auto &e : t->entities) {
+              e.second->accumulate(entry(result, index, e.first));
+            }
+          }
+
+          ticks_per_microsecond = calibration();
+        }
+
+        void reset() {
+          std::lock_guard<std::mutex> guard(lock_);
+          retired_.clear();
+          for (auto &t : threads_) {
+            std::lock_guard<std::mutex> thread_guard(t->lock);
+            for (auto &e : t->entities) {
+              for (auto &s : e.second->stages) {
+                s.rebase();
+              }
+            }
+          }
+        }
+
+        // Forgets a deleted entity, so a new one created at the same address starts from zero.
+        void release(const void *entity) {
+          std::lock_guard<std::mutex> guard(lock_);
+          retired_.erase(entity);
+          for (auto &t : threads_) {
+            std::lock_guard<std::mutex> thread_guard(t->lock);
+            t->entities.erase(entity);
+          }
+          generation_.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+    private:
+        // Detaches the counters of the thread when it exits.
+        struct thread_handle {
+          explicit thread_handle(std::shared_ptr<thread_counters> c)
+            : counters(std::move(c)) {
+          }
+
+          ~thread_handle() {
+            instance().detach(counters);
+          }
+
+          std::shared_ptr<thread_counters> counters;
+        };
+
+        registry()
+          : start_ticks_(now()), start_time_(std::chrono::steady_clock::now()) {
+        }
+
+        static MetricsEntityWrapper &entry(std::vector<MetricsEntityWrapper> &result,
+                                           std::unordered_map<const void *, size_t> &index,
+                                           const void *entity) {
+          auto it = index.find(entity);
+          if (it == index.end()) {
+            MetricsEntityWrapper w = {};
+            w.entity = const_cast<void *>(entity);
+            it = index.emplace(entity, result.size()).first;
+            result.push_back(w);
+          }
+
+          return result[it->second];
+        }
+
+        std::shared_ptr<thread_counters> attach() {
+          std::shared_ptr<thread_counters> counters = std::make_shared<thread_counters>();
+          std::lock_guard<std::mutex> guard(lock_);
+          threads_.push_back(counters);
+          return counters;
+        }
+
+        // The counts of an exited thread are merged into the retired totals,
+        // so they are not lost and the thread list does not grow forever.
+        void detach(const std::shared_ptr<thread_counters> &counters) {
+          std::lock_guard<std::mutex> guard(lock_);
+          {
+            std::lock_guard<std::mutex> thread_guard(counters->lock);
+            for (auto &e : counters->entities) {
+              auto it = retired_.find(e.first);
+              if (it == retired_.end()) {
+                MetricsEntityWrapper w = {};
+                w.entity = const_cast<void *>(e.first);
+                it = retired_.emplace(e.first, w).first;
+              }
+
+              e.second->accumulate(it->second);
+            }
+            counters->entities.clear();
+          }
+
+          auto it = std::find(threads_.begin(), threads_.end(), counters);
+          if (it != threads_.end()) {
+            *it = threads_.back();
+            threads_.pop_back();
+          }
+        }
+
+        double calibration() const {
+#ifdef OPENDDSHARP_METRICS_HAS_TSC
+          const double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time_).count();
+          if (elapsed <= 0.0) {
+            return 1.0;
+          }
+          return static_cast<double>(now() - start_ticks_) / elapsed;
+#else
+          return 1000.0;
+#endif
+        }
+
+        std::mutex lock_;
+        std::vector<std::shared_ptr<thread_counters> > threads_;
+        std::unordered_map<const void *, MetricsEntityWrapper> retired_;
+        std::atomic<ACE_UINT64> generation_{0};
+        const ACE_UINT64 start_ticks_;
+        const std::chrono::steady_clock::time_point start_time_;
+    };
+
+    template<typename Tag>
+    class entity_scope {
+
+    public:
+        // The typed entities are converted to their DDS base first, so the
+        // metrics are keyed by the same address the wrapper releases.
+        explicit entity_scope(::DDS::DataWriter_ptr writer)
+          : entity_scope(static_cast<const void *>(writer)) {
+        }
+
+        explicit entity_scope(::DDS::DataReader_ptr reader)
+          : entity_scope(static_cast<const void *>(reader)) {
+        }
+
+        explicit entity_scope(const void *entity)
+          : previous_(registry<Tag>::current_entity()) {
+          registry<Tag>::current_entity() = entity;
+        }
+
+        ~entity_scope() {
+          registry<Tag>::current_entity() = previous_;
+        }
+
+    private:
+        const void *previous_;
+    };
+
+    template<typename Tag>
+    class stage_timer {
+
+    public:
+        stage_timer(WrapperMetricsStage stage, size_t size)
+          : stage_(stage), size_(size), start_(now()) {
+        }
+
+        ~stage_timer() {
+          stop();
+        }
+
+        void size(size_t value) {
+          size_ = value;
+        }
+
+        void stop() {
+          if (running_) {
+            running_ = false;
+            registry<Tag>::instance().record(stage_, now() - start_, size_);
+          }
+        }
+
+    private:
+        const WrapperMetricsStage stage_;
+        size_t size_;
+        const ACE_UINT64 start_;
+        bool running_ = true;
+    };
+
+    template<typename Tag>
+    static void snapshot(void *&ptr, double &ticks_per_microsecond) {
+      std::vector<MetricsEntityWrapper> entities;
+      registry<Tag>::instance().snapshot(entities, ticks_per_microsecond);
+
+      TAO::unbounded_value_sequence<MetricsEntityWrapper> seq(static_cast<CORBA::ULong>(entities.size()));
+      seq.length(static_cast<CORBA::ULong>(entities.size()));
+      for (CORBA::ULong i = 0; i < seq.length(); ++i) {
+        seq[i] = entities[i];
+      }
+
+      marshal::unbounded_sequence_to_ptr(seq, ptr);
+    }
+
+    template<typename Tag>
+    static void reset() {
+      registry<Tag>::instance().reset();
+    }
+
+    template<typename Tag>
+    static void release(const void *entity) {
+      registry<Tag>::instance().release(entity);
+    }
+
+    template<typename Tag>
+    static void attach(wrapper_metrics_hooks *hooks) {
+      std::lock_guard<std::mutex> guard(hooks->lock);
+      if (std::find(hooks->release.begin(), hooks->release.end(), &release<Tag>) == hooks->release.end()) {
+        hooks->release.push_back(&release<Tag>);
+      }
+    }
+};
+
+#define METRICS_CONCAT_IMPL(a, b) a##b
+#define METRICS_CONCAT(a, b) METRICS_CONCAT_IMPL(a, b)
+
+#define METRICS_ENTITY_SCOPE(TAG, ENTITY) \
+  wrapper_metrics::entity_scope<TAG> METRICS_CONCAT(metrics_scope_, __LINE__)(ENTITY)
+#define METRICS_STAGE(TAG, STAGE, SIZE) \
+  wrapper_metrics::stage_timer<TAG> METRICS_CONCAT(metrics_stage_, __LINE__)(STAGE, SIZE)
+#define METRICS_STAGE_NAMED(NAME, TAG, STAGE, SIZE) \
+  wrapper_metrics::stage_timer<TAG> NAME(STAGE, SIZE)
+#define METRICS_STAGE_SIZE(NAME, SIZE) NAME.size(SIZE)
+#define METRICS_STAGE_STOP(NAME) NAME.stop()
+#define METRICS_SNAPSHOT(TAG, PTR, TICKS) wrapper_metrics::snapshot<TAG>(PTR, TICKS)
+#define METRICS_RESET(TAG) wrapper_metrics::reset<TAG>()
+#define METRICS_ATTACH(TAG, STATE) wrapper_metrics::attach<TAG>(static_cast<wrapper_metrics_hooks *>(STATE))
+
+#else
+
+#define METRICS_ENTITY_SCOPE(TAG, ENTITY)
+#define METRICS_STAGE(TAG, STAGE, SIZE)
+#define METRICS_STAGE_NAMED(NAME, TAG, STAGE, SIZE)
+#define METRICS_STAGE_SIZE(NAME, SIZE)
+#define METRICS_STAGE_STOP(NAME)
+#define METRICS_SNAPSHOT(TAG, PTR, TICKS) \
+  do { \
+    TAO::unbounded_value_sequence<MetricsEntityWrapper> empty_metrics; \
+    marshal::unbounded_sequence_to_ptr(empty_metrics, PTR); \
+    TICKS = 0.0; \
+  } while (0)
+#define METRICS_RESET(TAG)
+#define METRICS_ATTACH(TAG, STATE) (void)(STATE)
+
+#endif
+
+#endif
@@ -106,8 +106,26 @@ namespace OpenDDSharp.BuildTasks
             var cmakeOutput = Path.Combine(IntDir, "CMakeLists.txt");
             var marshalInput = Path.Combine(TemplatePath, "marshal.h");
             var marshalOutput = Path.Combine(IntDir, "marshal.h");
+            var metricsInput = Path.Combine(TemplatePath, "wrapper_metrics.h");
+            var metricsOutput = Path.Combine(IntDir, "wrapper_metrics.h");
+            var latencyInput = Path.Combine(TemplatePath, "latency_histogram.h");
+            var latencyOutput = Path.Combine(IntDir, "latency_histogram.h");
+            var tracerInput = Path.Combine(TemplatePath, "trace_events.h");
+            var tracerOutput = Path.Combine(IntDir, "trace_events.h");
+            var probesInput = Path.Combine(TemplatePath, "usdt_probes.h");
+            var probesOutput = Path.Combine(IntDir, "usdt_probes.h");
+            var allocInput = Path.Combine(TemplatePath, "alloc_accounting.h");
+            var allocOutput = Path.Combine(IntDir, "alloc_accounting.h");
+            var lifecycleInput = Path.Combine(TemplatePath, "lifecycle_trace.h");
+            var lifecycleOutput = Path.Combine(IntDir, "lifecycle_trace.h");
 
             File.Copy(marshalInput, marshalOutput, true);
+            File.Copy(metricsInput, metricsOutput, true);
+            File.Copy(latencyInput, latencyOutput, true);
+            File.Copy(tracerInput, tracerOutput, true);
+            File.Copy(probesInput, probesOutput, true);
+            File.Copy(allocInput, allocOutput, true);
+            File.Copy(lifecycleInput, lifecycleOutput, true);
 
             using StreamReader reader = new (cmakeInput);
             using StreamWriter writer = new (cmakeOutput);
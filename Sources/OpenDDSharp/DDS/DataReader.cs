@@ -80,6 +80,12 @@ public class DataReader : Entity
         _native = native;
         _conditions = new List<ReadCondition>();
     }
+
+    internal DataReader(IntPtr native, IntPtr entity) : base(entity)
+    {
+        _native = native;
+        _conditions = new List<ReadCondition>();
+    }
     #endregion
 
     #region Methods
@@ -254,6 +260,22 @@ public class DataReader : Entity
         return ret;
     }
 
+    /// <summary>
+    /// Sets the <see cref="DataReader" /> QoS policies using the <see cref="DataReaderQos" /> held by a <see cref="QosProfile" />.
+    /// </summary>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be set.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.
+    /// <see cref="ReturnCode.PreconditionNotMet" /> if the profile has no <see cref="DataReaderQos" /> set.</returns>
+    public ReturnCode SetQosWithProfile(QosProfile profile)
+    {
+        if (profile == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        return UnsafeNativeMethods.SetQosWithProfile(_native, profile.ToNative());
+    }
+
     /// <summary>
     /// Allows access to the attached <see cref="DataReaderListener" />.
     /// </summary>
@@ -471,6 +493,13 @@ public class DataReader : Entity
         _conditions.Clear();
     }
 
+    internal override void OnDeleted()
+    {
+        OpenDDS.DCPS.LifecycleTrace.Release(this);
+        OpenDDS.DCPS.LatencyHistogram.Release(this);
+        OpenDDS.DCPS.WrapperMetrics.Release(ToNative());
+    }
+
     private Subscriber GetSubscriber()
     {
         IntPtr ptrSubscriber = UnsafeNativeMethods.GetSubscriber64(_native);
@@ -553,6 +582,11 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataReader_SetQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode SetQos(IntPtr dr, [MarshalAs(UnmanagedType.Struct), In] DataReaderQosWrapper qos);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "DataReader_SetQosWithProfile")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode SetQosWithProfile(IntPtr dr, IntPtr profile);
+
     [SuppressUnmanagedCodeSecurity]
     [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "DataReader_SetListener")]
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
@@ -636,6 +670,10 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataReader_SetQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode SetQos(IntPtr dr, [MarshalAs(UnmanagedType.Struct), In] DataReaderQosWrapper qos);
 
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataReader_SetQosWithProfile", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode SetQosWithProfile(IntPtr dr, IntPtr profile);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataReader_SetListener", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode SetListener(IntPtr dr, IntPtr listener, uint mask);
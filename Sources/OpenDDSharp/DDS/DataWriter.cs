@@ -77,6 +77,11 @@ public class DataWriter : Entity
     {
         _native = native;
     }
+
+    internal DataWriter(IntPtr native, IntPtr entity) : base(entity)
+    {
+        _native = native;
+    }
     #endregion
 
     #region Methods
@@ -126,6 +131,22 @@ public class DataWriter : Entity
         return ret;
     }
 
+    /// <summary>
+    /// Sets the <see cref="DataWriter" /> QoS policies using the <see cref="DataWriterQos" /> held by a <see cref="QosProfile" />.
+    /// </summary>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be set.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.
+    /// <see cref="ReturnCode.PreconditionNotMet" /> if the profile has no <see cref="DataWriterQos" /> set.</returns>
+    public ReturnCode SetQosWithProfile(QosProfile profile)
+    {
+        if (profile == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        return UnsafeNativeMethods.SetQosWithProfile(_native, profile.ToNative());
+    }
+
     /// <summary>
     /// Allows access to the attached <see cref="DataWriterListener" />.
     /// </summary>
@@ -330,6 +351,11 @@ public class DataWriter : Entity
         return ret;
     }
 
+    internal override void OnDeleted()
+    {
+        OpenDDS.DCPS.WrapperMetrics.Release(ToNative());
+    }
+
     private Topic GetTopic()
     {
         var ptrTopic = UnsafeNativeMethods.GetTopic(_native);
@@ -415,6 +441,11 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataWriter_SetQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode SetQos(IntPtr dw, [MarshalAs(UnmanagedType.Struct), In] DataWriterQosWrapper qos);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "DataWriter_SetQosWithProfile")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode SetQosWithProfile(IntPtr dw, IntPtr profile);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataWriter_WaitForAcknowledgments", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode WaitForAcknowledgments(IntPtr dw, [MarshalAs(UnmanagedType.Struct), In] Duration duration);
@@ -476,6 +507,10 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataWriter_SetQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode SetQos(IntPtr dw, [MarshalAs(UnmanagedType.Struct), In] DataWriterQosWrapper qos);
 
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataWriter_SetQosWithProfile", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode SetQosWithProfile(IntPtr dw, IntPtr profile);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DataWriter_WaitForAcknowledgments", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode WaitForAcknowledgments(IntPtr dw, [MarshalAs(UnmanagedType.Struct), In] Duration duration);
@@ -585,6 +585,184 @@ public class DomainParticipant : Entity
         return t;
     }
 
+    /// <summary>
+    /// Creates a new <see cref="Topic" /> using the <see cref="TopicQos" /> policies held by a <see cref="QosProfile" />
+    /// and without listener attached.
+    /// </summary>
+    /// <remarks>
+    /// The policies are already stored in native memory by the <see cref="QosProfile" />, so they are not marshalled again.
+    /// If the profile has no <see cref="TopicQos" /> set, the default <see cref="TopicQos" /> of the <see cref="DomainParticipant" /> is used.
+    /// </remarks>
+    /// <param name="topicName">The name for the new topic.</param>
+    /// <param name="typeName">The name of the type which the new <see cref="Topic" /> will publish/receive.</param>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be used for creating the new <see cref="Topic" />.</param>
+    /// <returns>The newly created <see cref="Topic" /> on success, otherwise <see langword="null"/>.</returns>
+    public Topic CreateTopicWithProfile(string topicName, string typeName, QosProfile profile)
+    {
+        return CreateTopicWithProfile(topicName, typeName, profile, null, StatusMask.DefaultStatusMask);
+    }
+
+    /// <summary>
+    /// Creates a new <see cref="Topic" /> using the <see cref="TopicQos" /> policies held by a <see cref="QosProfile" />
+    /// and attaches to it the specified <see cref="TopicListener" />.
+    /// </summary>
+    /// <remarks>
+    /// The policies are already stored in native memory by the <see cref="QosProfile" />, so they are not marshalled again.
+    /// If the profile has no <see cref="TopicQos" /> set, the default <see cref="TopicQos" /> of the <see cref="DomainParticipant" /> is used.
+    /// </remarks>
+    /// <param name="topicName">The name for the new topic.</param>
+    /// <param name="typeName">The name of the type which the new <see cref="Topic" /> will publish/receive.</param>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be used for creating the new <see cref="Topic" />.</param>
+    /// <param name="listener">The <see cref="TopicListener" /> to be attached to the newly created <see cref="Topic" />.</param>
+    /// <param name="statusMask">The <see cref="StatusMask" /> of which status changes the listener should be notified.</param>
+    /// <returns>The newly created <see cref="Topic" /> on success, otherwise <see langword="null"/>.</returns>
+    public Topic CreateTopicWithProfile(string topicName, string typeName, QosProfile profile, TopicListener listener, StatusMask statusMask)
+    {
+        if (string.IsNullOrWhiteSpace(topicName))
+        {
+            return null;
+        }
+
+        if (string.IsNullOrWhiteSpace(typeName))
+        {
+            return null;
+        }
+
+        if (profile is null)
+        {
+            throw new ArgumentNullException(nameof(profile));
+        }
+
+        IntPtr nativeListener = IntPtr.Zero;
+        if (listener != null)
+        {
+            nativeListener = listener.ToNative();
+        }
+
+        IntPtr native = UnsafeNativeMethods.CreateTopicWithProfile(_native, topicName, typeName, profile.ToNative(), nativeListener, statusMask);
+
+        if (native.Equals(IntPtr.Zero))
+        {
+            return null;
+        }
+
+        var t = new Topic(native)
+        {
+            Listener = listener,
+        };
+
+        EntityManager.Instance.Add(t.ToNativeTopicDescription(), t);
+        ContainedEntities.Add(t);
+
+        return t;
+    }
+
+    /// <summary>
+    /// Creates a batch of <see cref="DataWriter" /> and <see cref="DataReader" /> entities, and their topics, with a single native call.
+    /// </summary>
+    /// <remarks>
+    /// <para>The types used by the endpoints must be registered before calling this operation. Each topic name is created once per batch
+    /// and shared by all the endpoints that use it. A later endpoint with the same topic name must use the same type name and
+    /// resolve to the same <see cref="TopicQos" />, otherwise it fails with <see cref="ReturnCode.PreconditionNotMet" />.</para>
+    /// <para>The endpoints are created under the <see cref="EntityFactoryQosPolicy" /> of the <paramref name="publisher"/> and
+    /// <paramref name="subscriber"/>. To issue the discovery announcements together instead of after each creation, set
+    /// <see cref="EntityFactoryQosPolicy.AutoenableCreatedEntities" /> to <see langword="false"/> on both of them and pass
+    /// <paramref name="enable"/> as <see langword="true"/>, the endpoints are then enabled after the whole batch has been created.</para>
+    /// </remarks>
+    /// <param name="publisher">The <see cref="Publisher" /> used to create the <see cref="EndpointKind.DataWriter" /> endpoints.</param>
+    /// <param name="subscriber">The <see cref="Subscriber" /> used to create the <see cref="EndpointKind.DataReader" /> endpoints.</param>
+    /// <param name="specs">The description of the endpoints to be created.</param>
+    /// <param name="results">The collection to be filled up with the result of each endpoint, in the same order as <paramref name="specs"/>.</param>
+    /// <param name="enable">Indicates whether the endpoints should be enabled after the batch is created.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.
+    /// <see cref="ReturnCode.PreconditionNotMet" /> if any of the endpoints did not match the topic already created in the batch,
+    /// <see cref="ReturnCode.Error" /> if any of the endpoints failed otherwise, check the individual results in both cases.</returns>
+    public ReturnCode CreateEndpoints(Publisher publisher, Subscriber subscriber, IList<EndpointSpec> specs, ICollection<EndpointResult> results, bool enable)
+    {
+        if (specs == null || results == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        results.Clear();
+
+        var specWrappers = new EndpointSpecWrapper[specs.Count];
+        for (var i = 0; i < specs.Count; i++)
+        {
+            if (specs[i] == null)
+            {
+                return ReturnCode.BadParameter;
+            }
+
+            specWrappers[i] = specs[i].ToNative();
+        }
+
+        var resultWrappers = new EndpointResultWrapper[specs.Count];
+        var pub = publisher?.ToNative() ?? IntPtr.Zero;
+        var sub = subscriber?.ToNative() ?? IntPtr.Zero;
+
+        var ret = UnsafeNativeMethods.CreateEndpoints(_native, pub, sub, specWrappers, specWrappers.Length, resultWrappers, enable);
+        if (ret == ReturnCode.BadParameter)
+        {
+            return ret;
+        }
+
+        for (var i = 0; i < specs.Count; i++)
+        {
+            var spec = specs[i];
+            var wrapper = resultWrappers[i];
+            var result = new EndpointResult
+            {
+                ReturnCode = wrapper.ReturnCode,
+            };
+
+            if (!wrapper.Topic.Equals(IntPtr.Zero))
+            {
+                if (EntityManager.Instance.Find(wrapper.TopicDescription) is not Topic topic)
+                {
+                    topic = new Topic(wrapper.Topic, wrapper.TopicEntity, wrapper.TopicDescription);
+
+                    EntityManager.Instance.Add(topic.ToNativeTopicDescription(), topic);
+                    ContainedEntities.Add(topic);
+                }
+
+                result.Topic = topic;
+            }
+
+            if (!wrapper.Endpoint.Equals(IntPtr.Zero))
+            {
+                if (spec.Kind == EndpointKind.DataReader)
+                {
+                    var dr = new DataReader(wrapper.Endpoint, wrapper.EndpointEntity)
+                    {
+                        Listener = spec.DataReaderListener,
+                    };
+
+                    EntityManager.Instance.Add(wrapper.EndpointEntity, dr);
+                    subscriber.ContainedEntities.Add(dr);
+
+                    result.DataReader = dr;
+                }
+                else
+                {
+                    var dw = new DataWriter(wrapper.Endpoint, wrapper.EndpointEntity)
+                    {
+                        Listener = spec.DataWriterListener,
+                    };
+
+                    EntityManager.Instance.Add(wrapper.EndpointEntity, dw);
+                    publisher.ContainedEntities.Add(dw);
+
+                    result.DataWriter = dw;
+                }
+            }
+
+            results.Add(result);
+        }
+
+        return ret;
+    }
+
     /// <summary>
     /// Gets the default value of the <see cref="Topic" /> QoS, that is, the QoS policies that will be used for newly created <see cref="Topic" />
     /// entities in the case where the QoS policies are defaulted in the CreateTopic operation.
@@ -852,6 +1030,98 @@ public class DomainParticipant : Entity
         return ret;
     }
 
+    /// <summary>
+    /// Deletes all the entities that were created by means of the "create" operations on the <see cref="DomainParticipant" />,
+    /// tearing down the publishers and subscribers concurrently.
+    /// </summary>
+    /// <remarks>
+    /// <para>The listeners of the participant, publishers, subscribers, data writers and data readers are detached first. If any of
+    /// them cannot be detached the operation fails without deleting anything. Otherwise they stay detached even if the deletion
+    /// fails. Then each <see cref="Publisher" /> and <see cref="Subscriber" /> deletes its own data writers and data readers on a
+    /// pool of threads, and finally the participant deletes the now empty publishers and subscribers and the topics.</para>
+    /// <para>The time the data writers wait for the pending samples on deletion is bounded by
+    /// <see cref="OpenDDS.DCPS.ParticipantService.PendingTimeout" />.</para>
+    /// </remarks>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode FastDeleteContainedEntities()
+    {
+        return FastDeleteContainedEntities(0, null);
+    }
+
+    /// <summary>
+    /// Deletes all the entities that were created by means of the "create" operations on the <see cref="DomainParticipant" />,
+    /// tearing down the publishers and subscribers concurrently.
+    /// </summary>
+    /// <remarks>
+    /// <para>The listeners of the participant, publishers, subscribers, data writers and data readers are detached first. If any of
+    /// them cannot be detached the operation fails without deleting anything. Otherwise they stay detached even if the deletion
+    /// fails. Then each <see cref="Publisher" /> and <see cref="Subscriber" /> deletes its own data writers and data readers on a
+    /// pool of threads, and finally the participant deletes the now empty publishers and subscribers and the topics.</para>
+    /// <para>The time the data writers wait for the pending samples on deletion is bounded by
+    /// <see cref="OpenDDS.DCPS.ParticipantService.PendingTimeout" />.</para>
+    /// </remarks>
+    /// <param name="maxThreads">The maximum number of threads used to delete the endpoints. Zero or negative uses the number of processors.</param>
+    /// <param name="timings">The <see cref="TeardownTimings" /> to be filled up with the time spent on each phase, or <see langword="null"/>.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode FastDeleteContainedEntities(int maxThreads, TeardownTimings timings)
+    {
+        var publishers = ContainedEntities.OfType<Publisher>().ToArray();
+        var subscribers = ContainedEntities.OfType<Subscriber>().ToArray();
+        var writers = publishers.SelectMany(p => p.ContainedEntities.OfType<DataWriter>()).ToArray();
+        var readers = subscribers.SelectMany(s => s.ContainedEntities.OfType<DataReader>()).ToArray();
+        var nativePublishers = publishers.Select(p => p.ToNative()).ToArray();
+        var nativeSubscribers = subscribers.Select(s => s.ToNative()).ToArray();
+        var nativeWriters = writers.Select(w => w.ToNative()).ToArray();
+        var nativeReaders = readers.Select(r => r.ToNative()).ToArray();
+
+        TeardownTimingsWrapper wrapper = default;
+        var ret = UnsafeNativeMethods.FastDeleteContainedEntities(_native, nativePublishers, nativePublishers.Length, nativeSubscribers, nativeSubscribers.Length,
+                                                                  nativeWriters, nativeWriters.Length, nativeReaders, nativeReaders.Length, maxThreads, ref wrapper, out var listenersDetached);
+
+        timings?.FromNative(wrapper);
+
+        // Nothing is deleted when a listener cannot be detached, the managed listeners are kept alive in that case.
+        if (!listenersDetached)
+        {
+            return ret;
+        }
+
+        // Every native listener has been detached, keep the managed side in sync even if the deletion fails.
+        Listener = null;
+        foreach (var publisher in publishers)
+        {
+            publisher.Listener = null;
+        }
+
+        foreach (var subscriber in subscribers)
+        {
+            subscriber.Listener = null;
+        }
+
+        foreach (var writer in writers)
+        {
+            writer.Listener = null;
+        }
+
+        foreach (var reader in readers)
+        {
+            reader.Listener = null;
+        }
+
+        if (ret == ReturnCode.Ok)
+        {
+            foreach (var e in ContainedEntities)
+            {
+                EntityManager.Instance.Remove(e.ToNative());
+                e.ClearContainedEntities();
+            }
+
+            ContainedEntities.Clear();
+        }
+
+        return ret;
+    }
+
     /// <summary>
     /// Instructs DDS to locally ignore a remote <see cref="DomainParticipant" />. From that point onwards the local <see cref="DomainParticipant" /> will behave as if the remote <see cref="DomainParticipant" /> did not exist.
     /// This means it will ignore any topic, publication, or subscription that originates on that <see cref="DomainParticipant" />.
@@ -1271,6 +1541,20 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_CreateTopic", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
     public static extern IntPtr CreateTopic(IntPtr dp, string topicName, string typeName, [MarshalAs(UnmanagedType.Struct), In] TopicQosWrapper qos, IntPtr a_listener, uint mask);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_CreateTopicWithProfile", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr CreateTopicWithProfile(IntPtr dp, string topicName, string typeName, IntPtr profile, IntPtr a_listener, uint mask);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_FastDeleteContainedEntities")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode FastDeleteContainedEntities(IntPtr dp, IntPtr[] pubs, int pubCount, IntPtr[] subs, int subCount, IntPtr[] writers, int writerCount, IntPtr[] readers, int readerCount, int maxThreads, ref TeardownTimingsWrapper timings, [MarshalAs(UnmanagedType.I1)] out bool listenersDetached);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_CreateEndpoints", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode CreateEndpoints(IntPtr dp, IntPtr pub, IntPtr sub, [In] EndpointSpecWrapper[] specs, int count, [In, Out] EndpointResultWrapper[] results, [MarshalAs(UnmanagedType.I1)] bool enable);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_GetQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode GetQos(IntPtr dp, [MarshalAs(UnmanagedType.Struct), In, Out] ref DomainParticipantQosWrapper qos);
@@ -1437,6 +1721,18 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_CreateTopic", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
     public static extern IntPtr CreateTopic(IntPtr dp, string topicName, string typeName, [MarshalAs(UnmanagedType.Struct), In] TopicQosWrapper qos, IntPtr a_listener, uint mask);
 
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_CreateTopicWithProfile", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
+    public static extern IntPtr CreateTopicWithProfile(IntPtr dp, string topicName, string typeName, IntPtr profile, IntPtr a_listener, uint mask);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_FastDeleteContainedEntities", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode FastDeleteContainedEntities(IntPtr dp, IntPtr[] pubs, int pubCount, IntPtr[] subs, int subCount, IntPtr[] writers, int writerCount, IntPtr[] readers, int readerCount, int maxThreads, ref TeardownTimingsWrapper timings, [MarshalAs(UnmanagedType.I1)] out bool listenersDetached);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_CreateEndpoints", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode CreateEndpoints(IntPtr dp, IntPtr pub, IntPtr sub, [In] EndpointSpecWrapper[] specs, int count, [In, Out] EndpointResultWrapper[] results, [MarshalAs(UnmanagedType.I1)] bool enable);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "DomainParticipant_GetQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode GetQos(IntPtr dp, [MarshalAs(UnmanagedType.Struct), In, Out] ref DomainParticipantQosWrapper qos);
@@ -0,0 +1,64 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Runtime.InteropServices;
+
+namespace OpenDDSharp.DDS;
+
+/// <summary>
+/// The result of the creation of one of the endpoints described by an <see cref="EndpointSpec" />.
+/// </summary>
+public sealed class EndpointResult
+{
+    #region Properties
+    /// <summary>
+    /// Gets the <see cref="Topic" /> of the endpoint, or <see langword="null"/> if it could not be created.
+    /// </summary>
+    public Topic Topic { get; internal set; }
+
+    /// <summary>
+    /// Gets the created <see cref="DDS.DataWriter" /> when the kind is <see cref="EndpointKind.DataWriter" />.
+    /// </summary>
+    public DataWriter DataWriter { get; internal set; }
+
+    /// <summary>
+    /// Gets the created <see cref="DDS.DataReader" /> when the kind is <see cref="EndpointKind.DataReader" />.
+    /// </summary>
+    public DataReader DataReader { get; internal set; }
+
+    /// <summary>
+    /// Gets the <see cref="DDS.ReturnCode" /> of the creation (and enabling, if requested) of the endpoint.
+    /// </summary>
+    public ReturnCode ReturnCode { get; internal set; }
+    #endregion
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct EndpointResultWrapper
+{
+    #region Fields
+    public IntPtr Topic;
+    public IntPtr TopicEntity;
+    public IntPtr TopicDescription;
+    public IntPtr Endpoint;
+    public IntPtr EndpointEntity;
+    public ReturnCode ReturnCode;
+    #endregion
+}
@@ -0,0 +1,108 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Runtime.InteropServices;
+
+namespace OpenDDSharp.DDS;
+
+/// <summary>
+/// Describes one of the endpoints to be created with <see cref="DomainParticipant.CreateEndpoints" />.
+/// </summary>
+public sealed class EndpointSpec
+{
+    #region Properties
+    /// <summary>
+    /// Gets or sets the name of the <see cref="Topic" /> of the endpoint. The topic is created if it has not been created before in the same batch.
+    /// </summary>
+    public string TopicName { get; set; }
+
+    /// <summary>
+    /// Gets or sets the registered type name of the <see cref="Topic" />.
+    /// </summary>
+    public string TypeName { get; set; }
+
+    /// <summary>
+    /// Gets or sets the kind of endpoint to be created.
+    /// </summary>
+    public EndpointKind Kind { get; set; }
+
+    /// <summary>
+    /// Gets or sets the <see cref="QosProfile" /> used to create the topic and the endpoint.
+    /// If <see langword="null"/>, the default QoS policies are used.
+    /// </summary>
+    public QosProfile Profile { get; set; }
+
+    /// <summary>
+    /// Gets or sets the <see cref="DataWriterListener" /> attached to the endpoint when the kind is <see cref="EndpointKind.DataWriter" />.
+    /// </summary>
+    public DataWriterListener DataWriterListener { get; set; }
+
+    /// <summary>
+    /// Gets or sets the <see cref="DataReaderListener" /> attached to the endpoint when the kind is <see cref="EndpointKind.DataReader" />.
+    /// </summary>
+    public DataReaderListener DataReaderListener { get; set; }
+
+    /// <summary>
+    /// Gets or sets the <see cref="StatusMask" /> of which status changes the listener should be notified.
+    /// </summary>
+    public StatusMask StatusMask { get; set; } = StatusMask.DefaultStatusMask;
+    #endregion
+
+    #region Methods
+    internal EndpointSpecWrapper ToNative()
+    {
+        var listener = IntPtr.Zero;
+        if (Kind == EndpointKind.DataReader && DataReaderListener != null)
+        {
+            listener = DataReaderListener.ToNative();
+        }
+        else if (Kind == EndpointKind.DataWriter && DataWriterListener != null)
+        {
+            listener = DataWriterListener.ToNative();
+        }
+
+        return new EndpointSpecWrapper
+        {
+            TopicName = TopicName,
+            TypeName = TypeName,
+            IsReader = Kind == EndpointKind.DataReader,
+            Profile = Profile?.ToNative() ?? IntPtr.Zero,
+            Listener = listener,
+            Mask = StatusMask,
+        };
+    }
+    #endregion
+}
+
+[StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
+internal struct EndpointSpecWrapper
+{
+    #region Fields
+    [MarshalAs(UnmanagedType.LPStr)]
+    public string TopicName;
+    [MarshalAs(UnmanagedType.LPStr)]
+    public string TypeName;
+    [MarshalAs(UnmanagedType.I1)]
+    public bool IsReader;
+    public IntPtr Profile;
+    public IntPtr Listener;
+    public uint Mask;
+    #endregion
+}
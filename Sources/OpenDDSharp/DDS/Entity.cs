@@ -120,11 +120,17 @@ public abstract class Entity
         {
             EntityManager.Instance.Remove(e.ToNative());
             e.ClearContainedEntities();
+            e.OnDeleted();
         }
 
         ContainedEntities.Clear();
     }
 
+    // Called once the native entity has been deleted, its native pointer must not be dereferenced anymore.
+    internal virtual void OnDeleted()
+    {
+    }
+
     private StatusCondition GetStatusCondition()
     {
         IntPtr ptr = UnsafeNativeMethods.GetStatusCondition(_native);
@@ -199,6 +199,71 @@ public class Publisher : Entity
         return dw;
     }
 
+    /// <summary>
+    /// Creates a new <see cref="DataWriter" /> using the <see cref="DataWriterQos" /> policies held by a <see cref="QosProfile" />
+    /// and without listener attached.
+    /// </summary>
+    /// <remarks>
+    /// The policies are already stored in native memory by the <see cref="QosProfile" />, so they are not marshalled again.
+    /// If the profile has no <see cref="DataWriterQos" /> set, the default <see cref="DataWriterQos" /> of the <see cref="Publisher" /> is used.
+    /// </remarks>
+    /// <param name="topic">The <see cref="Topic" /> that the <see cref="DataWriter" /> will be associated with.</param>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be used for creating the new <see cref="DataWriter" />.</param>
+    /// <returns>The newly created <see cref="DataWriter" /> on success, otherwise <see langword="null"/>.</returns>
+    public DataWriter CreateDataWriterWithProfile(Topic topic, QosProfile profile)
+    {
+        return CreateDataWriterWithProfile(topic, profile, null, StatusMask.DefaultStatusMask);
+    }
+
+    /// <summary>
+    /// Creates a new <see cref="DataWriter" /> using the <see cref="DataWriterQos" /> policies held by a <see cref="QosProfile" />
+    /// and attaches to it the specified <see cref="DataWriterListener" />.
+    /// </summary>
+    /// <remarks>
+    /// The policies are already stored in native memory by the <see cref="QosProfile" />, so they are not marshalled again.
+    /// If the profile has no <see cref="DataWriterQos" /> set, the default <see cref="DataWriterQos" /> of the <see cref="Publisher" /> is used.
+    /// </remarks>
+    /// <param name="topic">The <see cref="Topic" /> that the <see cref="DataWriter" /> will be associated with.</param>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be used for creating the new <see cref="DataWriter" />.</param>
+    /// <param name="listener">The <see cref="DataWriterListener" /> to be attached to the newly created <see cref="DataWriter" />.</param>
+    /// <param name="statusMask">The <see cref="StatusMask" /> of which status changes the listener should be notified.</param>
+    /// <returns>The newly created <see cref="DataWriter" /> on success, otherwise <see langword="null"/>.</returns>
+    public DataWriter CreateDataWriterWithProfile(Topic topic, QosProfile profile, DataWriterListener listener, StatusMask statusMask)
+    {
+        if (topic is null)
+        {
+            throw new ArgumentNullException(nameof(topic));
+        }
+
+        if (profile is null)
+        {
+            throw new ArgumentNullException(nameof(profile));
+        }
+
+        IntPtr nativeListener = IntPtr.Zero;
+        if (listener != null)
+        {
+            nativeListener = listener.ToNative();
+        }
+
+        IntPtr native = UnsafeNativeMethods.CreateDataWriterWithProfile(_native, topic.ToNative(), profile.ToNative(), nativeListener, statusMask);
+
+        if (native.Equals(IntPtr.Zero))
+        {
+            return null;
+        }
+
+        var dw = new DataWriter(native)
+        {
+            Listener = listener,
+        };
+
+        EntityManager.Instance.Add((dw as Entity).ToNative(), dw);
+        ContainedEntities.Add(dw);
+
+        return dw;
+    }
+
     /// <summary>
     /// Deletes a <see cref="DataWriter" /> that belongs to the <see cref="Publisher" />.
     /// </summary>
@@ -225,6 +290,7 @@ public class Publisher : Entity
         {
             EntityManager.Instance.Remove((datawriter as Entity).ToNative());
             ContainedEntities.Remove(datawriter);
+            datawriter.OnDeleted();
         }
 
         return ret;
@@ -286,6 +352,7 @@ public class Publisher : Entity
             foreach (Entity e in ContainedEntities)
             {
                 EntityManager.Instance.Remove(e.ToNative());
+                e.OnDeleted();
             }
 
             ContainedEntities.Clear();
@@ -566,6 +633,11 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Publisher_CreateDataWriter", CallingConvention = CallingConvention.Cdecl)]
     public static extern IntPtr CreateDataWriter(IntPtr pub, IntPtr topic, [MarshalAs(UnmanagedType.Struct), In] DataWriterQosWrapper qos, IntPtr a_listener, uint mask);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Publisher_CreateDataWriterWithProfile")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr CreateDataWriterWithProfile(IntPtr pub, IntPtr topic, IntPtr profile, IntPtr a_listener, uint mask);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Publisher_GetDefaultDataWriterQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode GetDefaultDataWriterQos(IntPtr pub, [MarshalAs(UnmanagedType.Struct), In, Out] ref DataWriterQosWrapper qos);
@@ -639,6 +711,10 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Publisher_CreateDataWriter", CallingConvention = CallingConvention.Cdecl)]
     public static extern IntPtr CreateDataWriter(IntPtr pub, IntPtr topic, [MarshalAs(UnmanagedType.Struct), In] DataWriterQosWrapper qos, IntPtr a_listener, uint mask);
 
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Publisher_CreateDataWriterWithProfile", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr CreateDataWriterWithProfile(IntPtr pub, IntPtr topic, IntPtr profile, IntPtr a_listener, uint mask);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Publisher_GetDefaultDataWriterQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode GetDefaultDataWriterQos(IntPtr pub, [MarshalAs(UnmanagedType.Struct), In, Out] ref DataWriterQosWrapper qos);
@@ -0,0 +1,359 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.DDS;
+
+/// <summary>
+/// Holds a set of <see cref="TopicQos" />, <see cref="DataWriterQos" /> and <see cref="DataReaderQos" /> policies
+/// converted once to the native representation.
+/// </summary>
+/// <remarks>
+/// <para>The policies are validated and copied to native memory when they are set. The creation operations that receive
+/// a <see cref="QosProfile" /> only pass the native handle, so no QoS marshalling happens on each entity creation.</para>
+/// <para>Setting new policies replaces the previous ones without affecting the entities already created with the profile.
+/// If a set of policies has not been established, the default QoS is used when creating the entities.</para>
+/// </remarks>
+public sealed class QosProfile : IDisposable
+{
+    #region Fields
+    private IntPtr _native;
+    private bool _disposed;
+    #endregion
+
+    #region Constructors
+    /// <summary>
+    /// Initializes a new instance of the <see cref="QosProfile"/> class.
+    /// </summary>
+    public QosProfile()
+    {
+        _native = UnsafeNativeMethods.NewQosProfile();
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="QosProfile"/> class.
+    /// </summary>
+    ~QosProfile()
+    {
+        Dispose(false);
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Sets the <see cref="TopicQos" /> policies of the profile.
+    /// </summary>
+    /// <param name="qos">The <see cref="TopicQos" /> to be set.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode SetTopicQos(TopicQos qos)
+    {
+        if (qos == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        var ret = UnsafeNativeMethods.SetTopicQos(_native, qos.ToNative());
+
+        qos.Release();
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Gets the <see cref="TopicQos" /> policies of the profile.
+    /// </summary>
+    /// <param name="qos">The <see cref="TopicQos" /> to be filled up.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.
+    /// <see cref="ReturnCode.NoData" /> if the policies have not been set.</returns>
+    public ReturnCode GetTopicQos(TopicQos qos)
+    {
+        if (qos == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        TopicQosWrapper qosWrapper = default;
+        var ret = UnsafeNativeMethods.GetTopicQos(_native, ref qosWrapper);
+
+        if (ret == ReturnCode.Ok)
+        {
+            qos.FromNative(qosWrapper);
+        }
+
+        qos.Release();
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Sets the <see cref="DataWriterQos" /> policies of the profile.
+    /// </summary>
+    /// <param name="qos">The <see cref="DataWriterQos" /> to be set.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode SetDataWriterQos(DataWriterQos qos)
+    {
+        if (qos == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        var ret = UnsafeNativeMethods.SetDataWriterQos(_native, qos.ToNative());
+
+        qos.Release();
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Gets the <see cref="DataWriterQos" /> policies of the profile.
+    /// </summary>
+    /// <param name="qos">The <see cref="DataWriterQos" /> to be filled up.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.
+    /// <see cref="ReturnCode.NoData" /> if the policies have not been set.</returns>
+    public ReturnCode GetDataWriterQos(DataWriterQos qos)
+    {
+        if (qos == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        DataWriterQosWrapper qosWrapper = default;
+        var ret = UnsafeNativeMethods.GetDataWriterQos(_native, ref qosWrapper);
+
+        if (ret == ReturnCode.Ok)
+        {
+            qos.FromNative(qosWrapper);
+        }
+
+        qos.Release();
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Sets the <see cref="DataReaderQos" /> policies of the profile.
+    /// </summary>
+    /// <param name="qos">The <see cref="DataReaderQos" /> to be set.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode SetDataReaderQos(DataReaderQos qos)
+    {
+        if (qos == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        var ret = UnsafeNativeMethods.SetDataReaderQos(_native, qos.ToNative());
+
+        qos.Release();
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Gets the <see cref="DataReaderQos" /> policies of the profile.
+    /// </summary>
+    /// <param name="qos">The <see cref="DataReaderQos" /> to be filled up.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.
+    /// <see cref="ReturnCode.NoData" /> if the policies have not been set.</returns>
+    public ReturnCode GetDataReaderQos(DataReaderQos qos)
+    {
+        if (qos == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        DataReaderQosWrapper qosWrapper = default;
+        var ret = UnsafeNativeMethods.GetDataReaderQos(_native, ref qosWrapper);
+
+        if (ret == ReturnCode.Ok)
+        {
+            qos.FromNative(qosWrapper);
+        }
+
+        qos.Release();
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Copies the current QoS policies of a <see cref="Topic" /> into the profile.
+    /// </summary>
+    /// <param name="topic">The <see cref="Topic" /> to copy the policies from.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode CopyFrom(Topic topic)
+    {
+        if (topic == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        return UnsafeNativeMethods.CopyFromTopic(_native, topic.ToNative());
+    }
+
+    /// <summary>
+    /// Copies the current QoS policies of a <see cref="DataWriter" /> into the profile.
+    /// </summary>
+    /// <param name="dataWriter">The <see cref="DataWriter" /> to copy the policies from.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode CopyFrom(DataWriter dataWriter)
+    {
+        if (dataWriter == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        return UnsafeNativeMethods.CopyFromDataWriter(_native, dataWriter.ToNative());
+    }
+
+    /// <summary>
+    /// Copies the current QoS policies of a <see cref="DataReader" /> into the profile.
+    /// </summary>
+    /// <param name="dataReader">The <see cref="DataReader" /> to copy the policies from.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode CopyFrom(DataReader dataReader)
+    {
+        if (dataReader == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        return UnsafeNativeMethods.CopyFromDataReader(_native, dataReader.ToNative());
+    }
+
+    /// <summary>
+    /// Releases the native profile.
+    /// </summary>
+    public void Dispose()
+    {
+        Dispose(true);
+        GC.SuppressFinalize(this);
+    }
+
+    internal IntPtr ToNative()
+    {
+        if (_disposed)
+        {
+            throw new ObjectDisposedException(nameof(QosProfile));
+        }
+
+        return _native;
+    }
+
+    private void Dispose(bool disposing)
+    {
+        if (_disposed)
+        {
+            return;
+        }
+
+        _disposed = true;
+
+        UnsafeNativeMethods.DeleteQosProfile(_native);
+        _native = IntPtr.Zero;
+    }
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage is secure because no stack walk will be performed.
+/// </summary>
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_New")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr NewQosProfile();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_Delete")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void DeleteQosProfile(IntPtr profile);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_CopyFromTopic")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode CopyFromTopic(IntPtr profile, IntPtr topic);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_CopyFromDataWriter")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode CopyFromDataWriter(IntPtr profile, IntPtr dw);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_CopyFromDataReader")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode CopyFromDataReader(IntPtr profile, IntPtr dr);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_New", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr NewQosProfile();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_Delete", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void DeleteQosProfile(IntPtr profile);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_CopyFromTopic", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode CopyFromTopic(IntPtr profile, IntPtr topic);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_CopyFromDataWriter", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode CopyFromDataWriter(IntPtr profile, IntPtr dw);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_CopyFromDataReader", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode CopyFromDataReader(IntPtr profile, IntPtr dr);
+#endif
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_GetTopicQos", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode GetTopicQos(IntPtr profile, [MarshalAs(UnmanagedType.Struct), In, Out] ref TopicQosWrapper qos);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_SetTopicQos", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode SetTopicQos(IntPtr profile, [MarshalAs(UnmanagedType.Struct), In] TopicQosWrapper qos);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_GetDataWriterQos", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode GetDataWriterQos(IntPtr profile, [MarshalAs(UnmanagedType.Struct), In, Out] ref DataWriterQosWrapper qos);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_SetDataWriterQos", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode SetDataWriterQos(IntPtr profile, [MarshalAs(UnmanagedType.Struct), In] DataWriterQosWrapper qos);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_GetDataReaderQos", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode GetDataReaderQos(IntPtr profile, [MarshalAs(UnmanagedType.Struct), In, Out] ref DataReaderQosWrapper qos);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "QosProfile_SetDataReaderQos", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode SetDataReaderQos(IntPtr profile, [MarshalAs(UnmanagedType.Struct), In] DataReaderQosWrapper qos);
+}
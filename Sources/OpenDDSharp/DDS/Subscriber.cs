@@ -216,6 +216,72 @@ public class Subscriber : Entity
         return dr;
     }
 
+    /// <summary>
+    /// Creates a new <see cref="DataReader" /> using the <see cref="DataReaderQos" /> policies held by a <see cref="QosProfile" />
+    /// and without listener attached.
+    /// </summary>
+    /// <remarks>
+    /// The policies are already stored in native memory by the <see cref="QosProfile" />, so they are not marshalled again.
+    /// If the profile has no <see cref="DataReaderQos" /> set, the default <see cref="DataReaderQos" /> of the <see cref="Subscriber" /> is used.
+    /// </remarks>
+    /// <param name="topicDescription">The <see cref="ITopicDescription" /> that the <see cref="DataReader" /> will be associated with.</param>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be used for creating the new <see cref="DataReader" />.</param>
+    /// <returns>The newly created <see cref="DataReader" /> on success, otherwise <see langword="null"/>.</returns>
+    public DataReader CreateDataReaderWithProfile(ITopicDescription topicDescription, QosProfile profile)
+    {
+        return CreateDataReaderWithProfile(topicDescription, profile, null, StatusMask.DefaultStatusMask);
+    }
+
+    /// <summary>
+    /// Creates a new <see cref="DataReader" /> using the <see cref="DataReaderQos" /> policies held by a <see cref="QosProfile" />
+    /// and attaches to it the specified <see cref="DataReaderListener" />.
+    /// </summary>
+    /// <remarks>
+    /// The policies are already stored in native memory by the <see cref="QosProfile" />, so they are not marshalled again.
+    /// If the profile has no <see cref="DataReaderQos" /> set, the default <see cref="DataReaderQos" /> of the <see cref="Subscriber" /> is used.
+    /// </remarks>
+    /// <param name="topicDescription">The <see cref="ITopicDescription" /> that the <see cref="DataReader" /> will be associated with.</param>
+    /// <param name="profile">The <see cref="QosProfile" /> with the policies to be used for creating the new <see cref="DataReader" />.</param>
+    /// <param name="listener">The <see cref="DataReaderListener" /> to be attached to the newly created <see cref="DataReader" />.</param>
+    /// <param name="statusMask">The <see cref="StatusMask" /> of which status changes the listener should be notified.</param>
+    /// <returns>The newly created <see cref="DataReader" /> on success, otherwise <see langword="null"/>.</returns>
+    public DataReader CreateDataReaderWithProfile(ITopicDescription topicDescription, QosProfile profile, DataReaderListener listener, StatusMask statusMask)
+    {
+        if (topicDescription is null)
+        {
+            throw new ArgumentNullException(nameof(topicDescription));
+        }
+
+        if (profile is null)
+        {
+            throw new ArgumentNullException(nameof(profile));
+        }
+
+        IntPtr nativeListener = IntPtr.Zero;
+        if (listener != null)
+        {
+            nativeListener = listener.ToNative();
+        }
+
+        IntPtr td = topicDescription.ToNativeTopicDescription();
+        IntPtr native = UnsafeNativeMethods.CreateDataReaderWithProfile(_native, td, profile.ToNative(), nativeListener, statusMask);
+
+        if (native.Equals(IntPtr.Zero))
+        {
+            return null;
+        }
+
+        var dr = new DataReader(native)
+        {
+            Listener = listener,
+        };
+
+        EntityManager.Instance.Add((dr as Entity).ToNative(), dr);
+        ContainedEntities.Add(dr);
+
+        return dr;
+    }
+
     /// <summary>
     /// Deletes a <see cref="DataReader" /> that belongs to the <see cref="Subscriber" />.
     /// </summary>
@@ -250,6 +316,7 @@ public class Subscriber : Entity
         {
             EntityManager.Instance.Remove((dataReader as Entity).ToNative());
             ContainedEntities.Remove(dataReader);
+            dataReader.OnDeleted();
         }
 
         return ret;
@@ -282,6 +349,7 @@ public class Subscriber : Entity
             {
                 EntityManager.Instance.Remove(e.ToNative());
                 e.ClearContainedEntities();
+                e.OnDeleted();
             }
 
             ContainedEntities.Clear();
@@ -668,6 +736,11 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Subscriber_CreateDataReader", CallingConvention = CallingConvention.Cdecl)]
     public static extern IntPtr CreateDataReader(IntPtr sub, IntPtr topic, [MarshalAs(UnmanagedType.Struct), In] DataReaderQosWrapper qos, IntPtr a_listener, uint mask);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Subscriber_CreateDataReaderWithProfile")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr CreateDataReaderWithProfile(IntPtr sub, IntPtr topic, IntPtr profile, IntPtr a_listener, uint mask);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Subscriber_GetDefaultDataReaderQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode GetDefaultDataReaderQos(IntPtr sub, [MarshalAs(UnmanagedType.Struct), In, Out] ref DataReaderQosWrapper qos);
@@ -737,6 +810,10 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Subscriber_CreateDataReader", CallingConvention = CallingConvention.Cdecl)]
     public static extern IntPtr CreateDataReader(IntPtr sub, IntPtr topic, [MarshalAs(UnmanagedType.Struct), In] DataReaderQosWrapper qos, IntPtr a_listener, uint mask);
 
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Subscriber_CreateDataReaderWithProfile", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr CreateDataReaderWithProfile(IntPtr sub, IntPtr topic, IntPtr profile, IntPtr a_listener, uint mask);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "Subscriber_GetDefaultDataReaderQos", CallingConvention = CallingConvention.Cdecl)]
     public static extern ReturnCode GetDefaultDataReaderQos(IntPtr sub, [MarshalAs(UnmanagedType.Struct), In, Out] ref DataReaderQosWrapper qos);
@@ -0,0 +1,100 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Runtime.InteropServices;
+
+namespace OpenDDSharp.DDS;
+
+/// <summary>
+/// Time spent on each phase of a fast teardown.
+/// </summary>
+/// <remarks>
+/// Filled up by <see cref="DomainParticipant.FastDeleteContainedEntities(int, TeardownTimings)" /> and
+/// <see cref="OpenDDS.DCPS.ParticipantService.FastShutdown" />.
+/// When several participants are deleted concurrently, each phase reports the slowest participant.
+/// </remarks>
+public sealed class TeardownTimings
+{
+    #region Properties
+    /// <summary>
+    /// Gets the time spent detaching the participant, publisher and subscriber listeners.
+    /// </summary>
+    public TimeSpan Listeners { get; internal set; }
+
+    /// <summary>
+    /// Gets the time spent deleting the data writers and data readers, done concurrently per publisher and subscriber.
+    /// </summary>
+    public TimeSpan Endpoints { get; internal set; }
+
+    /// <summary>
+    /// Gets the time spent deleting the remaining contained entities (publishers, subscribers and topics).
+    /// </summary>
+    public TimeSpan ContainedEntities { get; internal set; }
+
+    /// <summary>
+    /// Gets the time spent deleting the participants. Only filled up by <see cref="OpenDDS.DCPS.ParticipantService.FastShutdown" />.
+    /// </summary>
+    public TimeSpan Participants { get; internal set; }
+
+    /// <summary>
+    /// Gets the time spent shutting down the service. Only filled up by <see cref="OpenDDS.DCPS.ParticipantService.FastShutdown" />.
+    /// </summary>
+    public TimeSpan Shutdown { get; internal set; }
+
+    /// <summary>
+    /// Gets the number of threads used to delete the data writers and data readers.
+    /// </summary>
+    public int Threads { get; internal set; }
+    #endregion
+
+    #region Methods
+    internal void FromNative(TeardownTimingsWrapper wrapper)
+    {
+        Listeners = TimeSpan.FromTicks(wrapper.ListenersUs * 10);
+        Endpoints = TimeSpan.FromTicks(wrapper.EndpointsUs * 10);
+        ContainedEntities = TimeSpan.FromTicks(wrapper.EntitiesUs * 10);
+        Threads = wrapper.Threads;
+    }
+
+    internal void Merge(TeardownTimings other)
+    {
+        Listeners = Max(Listeners, other.Listeners);
+        Endpoints = Max(Endpoints, other.Endpoints);
+        ContainedEntities = Max(ContainedEntities, other.ContainedEntities);
+        Threads = Math.Max(Threads, other.Threads);
+    }
+
+    private static TimeSpan Max(TimeSpan left, TimeSpan right)
+    {
+        return left > right ? left : right;
+    }
+    #endregion
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct TeardownTimingsWrapper
+{
+    #region Fields
+    public long ListenersUs;
+    public long EndpointsUs;
+    public long EntitiesUs;
+    public int Threads;
+    #endregion
+}
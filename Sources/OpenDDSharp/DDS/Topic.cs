@@ -72,6 +72,12 @@ public class Topic : Entity, ITopicDescription
         _native = native;
         _nativeTopicDescription = NarrowTopicDescription(native);
     }
+
+    internal Topic(IntPtr native, IntPtr entity, IntPtr topicDescription) : base(entity)
+    {
+        _native = native;
+        _nativeTopicDescription = topicDescription;
+    }
     #endregion
 
     #region Methods
@@ -0,0 +1,193 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Native allocation accounting of the wrapper entry points.
+/// </summary>
+/// <remarks>
+/// <para>The allocations are only accounted when the native libraries are compiled with the
+/// <c>OPENDDSHARP_ALLOC_ACCOUNTING</c> option, otherwise <see cref="Enabled" /> is <see langword="false" /> and
+/// the snapshot is always empty. The build script enables it with <c>--AllocAccounting=True</c>.</para>
+/// <para>Every buffer and string allocated by the native marshaling code is attributed to the exported method that
+/// was called from .NET. The allocations released before the method returns are counted as allocations and releases,
+/// the ones handed to .NET stay live until they are released, so a growing <see cref="AllocationSite.LiveBytes" />
+/// points to a leak.</para>
+/// </remarks>
+public static class AllocAccounting
+{
+    #region Properties
+    /// <summary>
+    /// Gets a value indicating whether the native wrapper has been compiled with the allocation accounting.
+    /// </summary>
+    public static bool Enabled => UnsafeNativeMethods.AllocAccountingGetEnabled();
+
+    /// <summary>
+    /// Gets the native hooks shared with the generated type support libraries.
+    /// </summary>
+    /// <remarks>
+    /// This property is intended to be used from the generated type support code.
+    /// </remarks>
+    public static IntPtr NativeHooks => UnsafeNativeMethods.AllocAccountingGetHooks();
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Gets the allocation counters of each entry point.
+    /// </summary>
+    /// <returns>The allocation counters, sorted by entry point name.</returns>
+    public static IReadOnlyList<AllocationSite> GetSnapshot()
+    {
+        IntPtr ptr = IntPtr.Zero;
+        UnsafeNativeMethods.AllocAccountingGetSnapshot(ref ptr);
+
+        IList<AllocationSite> sites = new List<AllocationSite>();
+        ptr.PtrToSequence(ref sites);
+        ptr.ReleaseNativePointer();
+
+        return (IReadOnlyList<AllocationSite>)sites;
+    }
+
+    /// <summary>
+    /// Resets the allocation counters. The live allocations are kept so their later release is still accounted.
+    /// </summary>
+    public static void Reset()
+    {
+        UnsafeNativeMethods.AllocAccountingReset();
+    }
+    #endregion
+}
+
+/// <summary>
+/// Allocation counters of a native wrapper entry point.
+/// </summary>
+[StructLayout(LayoutKind.Sequential, Pack = 1)]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the allocation accounting.")]
+public struct AllocationSite
+{
+    #region Constants
+    private const int ENTRY_POINT_LENGTH = 128;
+    #endregion
+
+    #region Fields
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = ENTRY_POINT_LENGTH)]
+    private string _entryPoint;
+    private ulong _allocations;
+    private ulong _bytes;
+    private ulong _releases;
+    private ulong _liveAllocations;
+    private ulong _liveBytes;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the name of the exported native method, or <c>(unscoped)</c> for the allocations made outside of one.
+    /// </summary>
+    public string EntryPoint => _entryPoint ?? string.Empty;
+
+    /// <summary>
+    /// Gets the number of allocations.
+    /// </summary>
+    public ulong Allocations => _allocations;
+
+    /// <summary>
+    /// Gets the number of allocated bytes.
+    /// </summary>
+    public ulong Bytes => _bytes;
+
+    /// <summary>
+    /// Gets the number of released allocations.
+    /// </summary>
+    public ulong Releases => _releases;
+
+    /// <summary>
+    /// Gets the number of allocations not released yet.
+    /// </summary>
+    public ulong LiveAllocations => _liveAllocations;
+
+    /// <summary>
+    /// Gets the number of bytes not released yet.
+    /// </summary>
+    public ulong LiveBytes => _liveBytes;
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:FileMayOnlyContainASingleType", Justification = "Native p/invoke calls.")]
+[SuppressMessage("StyleCop.CSharp.DocumentationRules", "SA1601:PartialElementsMustBeDocumented", Justification = "Partial required for the source generator.")]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_GetEnabled")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool AllocAccountingGetEnabled();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_GetHooks")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr AllocAccountingGetHooks();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_GetSnapshot")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void AllocAccountingGetSnapshot(ref IntPtr sites);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_Reset")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void AllocAccountingReset();
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_GetEnabled", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool AllocAccountingGetEnabled();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_GetHooks", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr AllocAccountingGetHooks();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_GetSnapshot", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AllocAccountingGetSnapshot(ref IntPtr sites);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "AllocAccounting_Reset", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AllocAccountingReset();
+#endif
+}
@@ -0,0 +1,57 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System.Runtime.InteropServices;
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Utilization report of an OpenDDS internal thread, published in the <see cref="InternalThreadBuiltinTopicDataDataReader.BUILT_IN_INTERNAL_THREAD_TOPIC"/> built-in topic.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct InternalThreadBuiltinTopicData
+{
+    #region Constants
+    private const int THREAD_ID_LENGTH = 256;
+    #endregion
+
+    #region Fields
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = THREAD_ID_LENGTH)]
+    private string _threadId;
+    private double _utilization;
+    private Timestamp _timestamp;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the identifier of the thread, composed by the thread name and the process and thread ids.
+    /// </summary>
+    public string ThreadId => _threadId ?? string.Empty;
+
+    /// <summary>
+    /// Gets the fraction of time, between 0 and 1, that the thread was busy during the last report period.
+    /// </summary>
+    public double Utilization => _utilization;
+
+    /// <summary>
+    /// Gets the source timestamp of the report.
+    /// </summary>
+    public Timestamp Timestamp => _timestamp;
+    #endregion
+}
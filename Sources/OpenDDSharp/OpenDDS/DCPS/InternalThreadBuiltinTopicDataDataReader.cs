@@ -0,0 +1,302 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.DDS;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// <see cref="InternalThreadBuiltinTopicData"/> <see cref="DataReader"/>.
+/// </summary>
+/// <remarks>
+/// OpenDDS only publishes the internal thread reports when the thread status monitoring is enabled with
+/// the <c>-DCPSThreadStatusInterval &lt;seconds&gt;</c> argument (or the <c>DCPSThreadStatusInterval</c> configuration key),
+/// a new sample is published for every monitored thread each interval.
+/// </remarks>
+public class InternalThreadBuiltinTopicDataDataReader : DataReader
+{
+    #region Constants
+    /// <summary>
+    /// The built-in internal thread topic name.
+    /// </summary>
+    public const string BUILT_IN_INTERNAL_THREAD_TOPIC = "OpenDDSInternalThread";
+
+    /// <summary>
+    /// The built-in internal thread topic type.
+    /// </summary>
+    public const string BUILT_IN_INTERNAL_THREAD_TOPIC_TYPE = "OpenDDSInternalThread";
+    #endregion
+
+    #region Fields
+    private readonly IntPtr _native;
+    #endregion
+
+    #region Constructors
+    /// <summary>
+    /// Initializes a new instance of the <see cref="InternalThreadBuiltinTopicDataDataReader"/> class.
+    /// </summary>
+    /// <param name="dataReader">The built-in <see cref="DataReader"/>.</param>
+    public InternalThreadBuiltinTopicDataDataReader(DataReader dataReader) : base(dataReader.ToNative())
+    {
+        IntPtr ptr = base.ToNative();
+        _native = UnsafeNativeMethods.InternalThreadBuiltinNarrow(ptr);
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Reads all samples.
+    /// </summary>
+    /// <param name="receivedData">The list of data samples read.</param>
+    /// <param name="receivedInfo">The list of <see cref="SampleInfo"/> read.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode Read(List<InternalThreadBuiltinTopicData> receivedData, List<SampleInfo> receivedInfo)
+    {
+        return Read(receivedData,
+            receivedInfo,
+            ResourceLimitsQosPolicy.LengthUnlimited,
+            SampleStateMask.AnySampleState,
+            ViewStateMask.AnyViewState,
+            InstanceStateMask.AnyInstanceState);
+    }
+
+    /// <summary>
+    /// Reads all samples based in the state parameters provided and a maximum allowed samples to be retrieved.
+    /// </summary>
+    /// <param name="receivedData">The list of data samples read.</param>
+    /// <param name="receivedInfo">The list of <see cref="SampleInfo"/> read.</param>
+    /// <param name="maxSamples">The maximum allowed samples to be read.</param>
+    /// <param name="sampleStates">The <see cref="SampleStateMask"/> state to be read.</param>
+    /// <param name="viewStates">The <see cref="ViewStateMask"/> state to be read.</param>
+    /// <param name="instanceStates">The <see cref="InstanceStateMask"/> state to be read.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode Read(
+        List<InternalThreadBuiltinTopicData> receivedData,
+        List<SampleInfo> receivedInfo,
+        int maxSamples,
+        SampleStateMask sampleStates,
+        ViewStateMask viewStates,
+        InstanceStateMask instanceStates)
+    {
+        if (receivedData == null || receivedInfo == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        receivedData.Clear();
+        receivedInfo.Clear();
+
+        IntPtr rd = IntPtr.Zero;
+        IntPtr ri = IntPtr.Zero;
+
+        ReturnCode ret = (ReturnCode)UnsafeNativeMethods.InternalThreadBuiltinRead(
+            _native,
+            ref rd,
+            ref ri,
+            maxSamples,
+            sampleStates,
+            viewStates,
+            instanceStates);
+
+        if (ret == ReturnCode.Ok)
+        {
+            FromNative(rd, ri, receivedData, receivedInfo);
+        }
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Takes all samples.
+    /// </summary>
+    /// <param name="receivedData">The list of data samples taken.</param>
+    /// <param name="receivedInfo">The list of <see cref="SampleInfo"/> taken.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode Take(List<InternalThreadBuiltinTopicData> receivedData, List<SampleInfo> receivedInfo)
+    {
+        return Take(receivedData,
+            receivedInfo,
+            ResourceLimitsQosPolicy.LengthUnlimited,
+            SampleStateMask.AnySampleState,
+            ViewStateMask.AnyViewState,
+            InstanceStateMask.AnyInstanceState);
+    }
+
+    /// <summary>
+    /// Takes all samples based in the state parameters provided and a maximum allowed samples to be retrieved.
+    /// </summary>
+    /// <param name="receivedData">The list of data samples taken.</param>
+    /// <param name="receivedInfo">The list of <see cref="SampleInfo"/> taken.</param>
+    /// <param name="maxSamples">The maximum allowed samples to be taken.</param>
+    /// <param name="sampleStates">The <see cref="SampleStateMask"/> state to be taken.</param>
+    /// <param name="viewStates">The <see cref="ViewStateMask"/> state to be taken.</param>
+    /// <param name="instanceStates">The <see cref="InstanceStateMask"/> state to be taken.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode Take(
+        List<InternalThreadBuiltinTopicData> receivedData,
+        List<SampleInfo> receivedInfo,
+        int maxSamples,
+        SampleStateMask sampleStates,
+        ViewStateMask viewStates,
+        InstanceStateMask instanceStates)
+    {
+        if (receivedData == null || receivedInfo == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        receivedData.Clear();
+        receivedInfo.Clear();
+
+        IntPtr rd = IntPtr.Zero;
+        IntPtr ri = IntPtr.Zero;
+
+        ReturnCode ret = (ReturnCode)UnsafeNativeMethods.InternalThreadBuiltinTake(
+            _native,
+            ref rd,
+            ref ri,
+            maxSamples,
+            sampleStates,
+            viewStates,
+            instanceStates);
+
+        if (ret == ReturnCode.Ok)
+        {
+            FromNative(rd, ri, receivedData, receivedInfo);
+        }
+
+        return ret;
+    }
+
+    /// <summary>
+    /// Gets the latest utilization report of every alive internal thread without removing the samples from the reader.
+    /// </summary>
+    /// <remarks>
+    /// Intended to be polled periodically, e.g. by a monitoring dashboard. An empty snapshot is returned with
+    /// <see cref="ReturnCode.Ok"/> when no report has been received yet.
+    /// </remarks>
+    /// <param name="snapshot">The list to be filled with one report per thread.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    public ReturnCode GetSnapshot(List<InternalThreadBuiltinTopicData> snapshot)
+    {
+        if (snapshot == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        snapshot.Clear();
+
+        IntPtr rd = IntPtr.Zero;
+        ReturnCode ret = (ReturnCode)UnsafeNativeMethods.InternalThreadBuiltinGetSnapshot(_native, ref rd);
+        if (ret == ReturnCode.Ok && rd != IntPtr.Zero)
+        {
+            IList<InternalThreadBuiltinTopicData> data = new List<InternalThreadBuiltinTopicData>();
+            rd.PtrToSequence(ref data);
+            rd.ReleaseNativePointer();
+
+            snapshot.AddRange(data);
+        }
+
+        return ret;
+    }
+
+    private static void FromNative(IntPtr rd, IntPtr ri, List<InternalThreadBuiltinTopicData> receivedData, List<SampleInfo> receivedInfo)
+    {
+        if (rd == IntPtr.Zero || ri == IntPtr.Zero)
+        {
+            return;
+        }
+
+        IList<InternalThreadBuiltinTopicData> data = new List<InternalThreadBuiltinTopicData>();
+        IList<SampleInfoWrapper> info = new List<SampleInfoWrapper>();
+
+        rd.PtrToSequence(ref data);
+        ri.PtrToSequence(ref info);
+        rd.ReleaseNativePointer();
+        ri.ReleaseNativePointer();
+
+        receivedData.AddRange(data);
+
+        foreach (var i in info)
+        {
+            SampleInfo aux = new ();
+            aux.FromNative(i);
+            receivedInfo.Add(aux);
+        }
+    }
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage
+/// is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_Narrow")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr InternalThreadBuiltinNarrow(IntPtr dr);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_Read")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial int InternalThreadBuiltinRead(IntPtr dr, ref IntPtr receivedData, ref IntPtr receivedInfo, int maxSamples, uint sampleStates, uint viewStates, uint instanceStates);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_Take")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial int InternalThreadBuiltinTake(IntPtr dr, ref IntPtr receivedData, ref IntPtr receivedInfo, int maxSamples, uint sampleStates, uint viewStates, uint instanceStates);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_GetSnapshot")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial int InternalThreadBuiltinGetSnapshot(IntPtr dr, ref IntPtr receivedData);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_Narrow", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr InternalThreadBuiltinNarrow(IntPtr dr);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_Read", CallingConvention = CallingConvention.Cdecl)]
+    public static extern int InternalThreadBuiltinRead(IntPtr dr, ref IntPtr receivedData, ref IntPtr receivedInfo, int maxSamples, uint sampleStates, uint viewStates, uint instanceStates);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_Take", CallingConvention = CallingConvention.Cdecl)]
+    public static extern int InternalThreadBuiltinTake(IntPtr dr, ref IntPtr receivedData, ref IntPtr receivedInfo, int maxSamples, uint sampleStates, uint viewStates, uint instanceStates);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "InternalThreadBuiltinTopicDataDataReader_GetSnapshot", CallingConvention = CallingConvention.Cdecl)]
+    public static extern int InternalThreadBuiltinGetSnapshot(IntPtr dr, ref IntPtr receivedData);
+#endif
+}
@@ -0,0 +1,253 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.DDS;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// End-to-end latency histogram recorded natively for a single <see cref="DDS.DataReader" />.
+/// </summary>
+/// <remarks>
+/// The latency of each sample is the difference between its source timestamp and the moment it is read or
+/// taken for the first time through the generated wrapper, so writer and reader clocks must be synchronized
+/// when they run on different hosts. Values are expressed in nanoseconds and stored in a log-linear layout
+/// with a relative error below 1.6%. Up to 256 readers can have the histogram enabled at the same time, enabling
+/// it on more readers returns <see langword="false" />.
+/// </remarks>
+public class LatencyHistogram
+{
+    #region Constants
+    private const int HEADER_SIZE = (4 * sizeof(ulong)) + (2 * sizeof(uint));
+    #endregion
+
+    #region Fields
+    private readonly ulong[] _buckets;
+    private readonly int _subBucketBits;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the number of recorded samples.
+    /// </summary>
+    public ulong Count { get; private set; }
+
+    /// <summary>
+    /// Gets the minimum recorded latency in nanoseconds.
+    /// </summary>
+    public ulong Min { get; private set; }
+
+    /// <summary>
+    /// Gets the maximum recorded latency in nanoseconds.
+    /// </summary>
+    public ulong Max { get; private set; }
+
+    /// <summary>
+    /// Gets the sum of the recorded latencies in nanoseconds.
+    /// </summary>
+    public ulong Sum { get; private set; }
+
+    /// <summary>
+    /// Gets the mean latency in nanoseconds.
+    /// </summary>
+    public double Mean => Count == 0 ? 0 : (double)Sum / Count;
+
+    /// <summary>
+    /// Gets the raw bucket counters.
+    /// </summary>
+    public IReadOnlyList<ulong> Buckets => _buckets;
+
+    /// <summary>
+    /// Gets the native registry of the enabled histograms shared with the generated type support libraries.
+    /// </summary>
+    /// <remarks>
+    /// This property is intended to be used from the generated type support code.
+    /// </remarks>
+    public static IntPtr NativeState => UnsafeNativeMethods.LatencyHistogramGetState();
+
+    #region Constructors
+    private LatencyHistogram(ulong count, ulong min, ulong max, ulong sum, int subBucketBits, ulong[] buckets)
+    {
+        Count = count;
+        Min = min;
+        Max = max;
+        Sum = sum;
+        _subBucketBits = subBucketBits;
+        _buckets = buckets;
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Builds the histogram from the snapshot returned by the generated native wrapper and releases it.
+    /// </summary>
+    /// <remarks>
+    /// This method is intended to be called from the generated type support code.
+    /// </remarks>
+    /// <param name="ptr">The native snapshot.</param>
+    /// <returns>The latency histogram or <see langword="null" /> if it is not enabled for the reader.</returns>
+    public static LatencyHistogram FromNative(IntPtr ptr)
+    {
+        if (ptr == IntPtr.Zero)
+        {
+            return null;
+        }
+
+        var count = (ulong)Marshal.ReadInt64(ptr, 0);
+        var min = (ulong)Marshal.ReadInt64(ptr, sizeof(ulong));
+        var max = (ulong)Marshal.ReadInt64(ptr, 2 * sizeof(ulong));
+        var sum = (ulong)Marshal.ReadInt64(ptr, 3 * sizeof(ulong));
+        var subBucketBits = Marshal.ReadInt32(ptr, 4 * sizeof(ulong));
+        var bucketCount = Marshal.ReadInt32(ptr, (4 * sizeof(ulong)) + sizeof(uint));
+
+        var buckets = new ulong[bucketCount];
+        for (var i = 0; i < bucketCount; i++)
+        {
+            buckets[i] = (ulong)Marshal.ReadInt64(ptr, HEADER_SIZE + (i * sizeof(ulong)));
+        }
+
+        ptr.ReleaseNativePointer();
+
+        return new LatencyHistogram(count, min, max, sum, subBucketBits, buckets);
+    }
+
+    /// <summary>
+    /// Releases the histogram of a deleted reader, so a reader created later at the same native address does not inherit it.
+    /// </summary>
+    /// <param name="reader">The deleted reader.</param>
+    internal static void Release(DataReader reader)
+    {
+        UnsafeNativeMethods.LatencyHistogramRelease(reader.ToNative());
+    }
+
+    /// <summary>
+    /// Gets an upper bound estimation of the given percentile of the latency.
+    /// </summary>
+    /// <param name="percentile">The percentile between 0 and 100.</param>
+    /// <returns>The estimated latency in nanoseconds.</returns>
+    public ulong GetPercentile(double percentile)
+    {
+        if (Count == 0)
+        {
+            return 0;
+        }
+
+        var target = Math.Max(1, Math.Ceiling(Count * Math.Min(Math.Max(percentile, 0), 100) / 100.0));
+        ulong accumulated = 0;
+        for (var i = 0; i < _buckets.Length; i++)
+        {
+            accumulated += _buckets[i];
+            if (accumulated >= target)
+            {
+                return Math.Min(GetBucketUpperBound(i), Max);
+            }
+        }
+
+        return Max;
+    }
+
+    /// <summary>
+    /// Adds the samples of another histogram, i.e. from other readers or processes, to this one.
+    /// </summary>
+    /// <param name="other">The histogram to merge.</param>
+    public void Merge(LatencyHistogram other)
+    {
+        if (other is null)
+        {
+            throw new ArgumentNullException(nameof(other));
+        }
+
+        if (other._subBucketBits != _subBucketBits || other._buckets.Length != _buckets.Length)
+        {
+            throw new ArgumentException("The histogram layouts don't match.", nameof(other));
+        }
+
+        if (other.Count == 0)
+        {
+            return;
+        }
+
+        Min = Count == 0 ? other.Min : Math.Min(Min, other.Min);
+        Max = Math.Max(Max, other.Max);
+        Count += other.Count;
+        Sum += other.Sum;
+        for (var i = 0; i < _buckets.Length; i++)
+        {
+            _buckets[i] += other._buckets[i];
+        }
+    }
+
+    private ulong GetBucketUpperBound(int index)
+    {
+        var subBuckets = 1 << _subBucketBits;
+        if (index < subBuckets)
+        {
+            return (ulong)index;
+        }
+
+        var halfSubBuckets = subBuckets / 2;
+        var shift = ((index - subBuckets) / halfSubBuckets) + 1;
+        var subBucket = (ulong)(((index - subBuckets) % halfSubBuckets) + halfSubBuckets);
+
+        return ((subBucket + 1) << shift) - 1;
+    }
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:FileMayOnlyContainASingleType", Justification = "Native p/invoke calls.")]
+[SuppressMessage("StyleCop.CSharp.DocumentationRules", "SA1601:PartialElementsMustBeDocumented", Justification = "Partial required for the source generator.")]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LatencyHistogram_GetState")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr LatencyHistogramGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LatencyHistogram_Release")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void LatencyHistogramRelease(IntPtr dr);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LatencyHistogram_GetState", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr LatencyHistogramGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LatencyHistogram_Release", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void LatencyHistogramRelease(IntPtr dr);
+#endif
+}
@@ -0,0 +1,287 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.DDS;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Aggregated breakdown of the latency of the samples received by a <see cref="DataReader" />.
+/// </summary>
+/// <remarks>
+/// <para>For each traced reader the wrapper records, on the reader side only, the time from the native
+/// <c>on_data_available</c> notification to the entry of the managed listener callback, the time from that
+/// notification or callback entry to the next read or take, and the time from the source timestamp to the first
+/// read or take of each sample. The transport stage is taken from the OpenDDS reader latency statistics.</para>
+/// <para>The writer does not stamp the samples and they are not correlated one by one: each stage only keeps the
+/// count, sum, minimum and maximum of the intervals it observed. The transport stage covers every sample received
+/// since the statistics were enabled or reset, so the stages are not expected to add up to the end-to-end stage.</para>
+/// <para>The transport and end-to-end stages start at the source timestamp set by OpenDDS when the sample is
+/// written, so the writer and reader clocks must be synchronized when they run on different hosts.
+/// The dispatch stage is only recorded for the readers with a <see cref="DataReaderListener" />.</para>
+/// <para>The trace of a reader is released when the reader is deleted.</para>
+/// </remarks>
+public static class LifecycleTrace
+{
+    #region Constants
+    private const int STAGE_COUNT = 4;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the native lifecycle trace state shared with the generated type support libraries.
+    /// </summary>
+    /// <remarks>
+    /// This property is intended to be used from the generated type support code.
+    /// </remarks>
+    public static IntPtr NativeState => UnsafeNativeMethods.LifecycleTraceGetState();
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Enables or disables the lifecycle trace of a reader. It also enables the OpenDDS latency statistics of the reader,
+    /// which are restored to their previous setting when the trace is disabled.
+    /// </summary>
+    /// <param name="reader">The traced reader.</param>
+    /// <param name="enabled">Whether the trace is enabled.</param>
+    /// <returns><see langword="false" /> if the maximum number of traced readers has been reached.</returns>
+    public static bool Enable(DataReader reader, bool enabled)
+    {
+        if (reader is null)
+        {
+            throw new ArgumentNullException(nameof(reader));
+        }
+
+        return UnsafeNativeMethods.LifecycleTraceEnable(reader.ToNative(), enabled);
+    }
+
+    /// <summary>
+    /// Gets the lifecycle statistics of a reader.
+    /// </summary>
+    /// <param name="reader">The traced reader.</param>
+    /// <returns>The lifecycle statistics or <see langword="null" /> if the trace is not enabled for the reader.</returns>
+    public static LifecycleTraceStatistics GetStatistics(DataReader reader)
+    {
+        if (reader is null)
+        {
+            throw new ArgumentNullException(nameof(reader));
+        }
+
+        var size = Marshal.SizeOf<LifecycleStageStatistics>();
+        var ptr = Marshal.AllocHGlobal(size * STAGE_COUNT);
+        try
+        {
+            if (!UnsafeNativeMethods.LifecycleTraceGetStatistics(reader.ToNative(), ptr))
+            {
+                return null;
+            }
+
+            var stages = new LifecycleStageStatistics[STAGE_COUNT];
+            for (var i = 0; i < STAGE_COUNT; i++)
+            {
+                stages[i] = Marshal.PtrToStructure<LifecycleStageStatistics>(ptr + (i * size));
+            }
+
+            return new LifecycleTraceStatistics(stages[0], stages[1], stages[2], stages[3]);
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(ptr);
+        }
+    }
+
+    /// <summary>
+    /// Resets the lifecycle statistics of a reader.
+    /// </summary>
+    /// <param name="reader">The traced reader.</param>
+    public static void Reset(DataReader reader)
+    {
+        if (reader is null)
+        {
+            throw new ArgumentNullException(nameof(reader));
+        }
+
+        UnsafeNativeMethods.LifecycleTraceReset(reader.ToNative());
+    }
+
+    /// <summary>
+    /// Releases the trace of a deleted reader, so a reader created later at the same native address does not inherit it.
+    /// </summary>
+    /// <param name="reader">The deleted reader.</param>
+    internal static void Release(DataReader reader)
+    {
+        UnsafeNativeMethods.LifecycleTraceRelease(reader.ToNative());
+    }
+    #endregion
+}
+
+/// <summary>
+/// Lifecycle statistics of the samples received by a <see cref="DataReader" />.
+/// </summary>
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the lifecycle trace.")]
+public class LifecycleTraceStatistics
+{
+    #region Properties
+    /// <summary>
+    /// Gets the time from the source timestamp to the insertion of the sample in the reader cache, as measured by the
+    /// OpenDDS reader latency statistics over every received sample.
+    /// </summary>
+    public LifecycleStageStatistics Transport { get; }
+
+    /// <summary>
+    /// Gets the time from the native <c>on_data_available</c> notification to the entry of the managed callback.
+    /// </summary>
+    public LifecycleStageStatistics Dispatch { get; }
+
+    /// <summary>
+    /// Gets the time the samples waited in the reader cache until the first read or take, from the managed callback
+    /// entry or, when read outside of a listener, from the oldest notification pending since the previous call.
+    /// </summary>
+    public LifecycleStageStatistics CacheDwell { get; }
+
+    /// <summary>
+    /// Gets the time from the source timestamp to the first read or take of the sample.
+    /// </summary>
+    public LifecycleStageStatistics EndToEnd { get; }
+    #endregion
+
+    #region Constructors
+    internal LifecycleTraceStatistics(LifecycleStageStatistics transport, LifecycleStageStatistics dispatch, LifecycleStageStatistics cacheDwell, LifecycleStageStatistics endToEnd)
+    {
+        Transport = transport;
+        Dispatch = dispatch;
+        CacheDwell = cacheDwell;
+        EndToEnd = endToEnd;
+    }
+    #endregion
+}
+
+/// <summary>
+/// Statistics of a lifecycle stage, in nanoseconds.
+/// </summary>
+[StructLayout(LayoutKind.Sequential, Pack = 1)]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the lifecycle trace.")]
+public struct LifecycleStageStatistics
+{
+    #region Fields
+    private ulong _count;
+    private ulong _sum;
+    private ulong _min;
+    private ulong _max;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the number of recorded values.
+    /// </summary>
+    public ulong Count => _count;
+
+    /// <summary>
+    /// Gets the sum of the recorded values in nanoseconds.
+    /// </summary>
+    public ulong Sum => _sum;
+
+    /// <summary>
+    /// Gets the minimum recorded value in nanoseconds.
+    /// </summary>
+    public ulong Min => _min;
+
+    /// <summary>
+    /// Gets the maximum recorded value in nanoseconds.
+    /// </summary>
+    public ulong Max => _max;
+
+    /// <summary>
+    /// Gets the mean value in nanoseconds.
+    /// </summary>
+    public double Mean => _count == 0 ? 0 : (double)_sum / _count;
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:FileMayOnlyContainASingleType", Justification = "Native p/invoke calls.")]
+[SuppressMessage("StyleCop.CSharp.DocumentationRules", "SA1601:PartialElementsMustBeDocumented", Justification = "Partial required for the source generator.")]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_GetState")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr LifecycleTraceGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_Enable")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool LifecycleTraceEnable(IntPtr dr, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_GetStatistics")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool LifecycleTraceGetStatistics(IntPtr dr, IntPtr stages);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_Reset")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void LifecycleTraceReset(IntPtr dr);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_Release")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void LifecycleTraceRelease(IntPtr dr);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_GetState", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr LifecycleTraceGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_Enable", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool LifecycleTraceEnable(IntPtr dr, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_GetStatistics", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool LifecycleTraceGetStatistics(IntPtr dr, IntPtr stages);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_Reset", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void LifecycleTraceReset(IntPtr dr);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "LifecycleTrace_Release", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void LifecycleTraceRelease(IntPtr dr);
+#endif
+}
@@ -18,9 +18,13 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 using System;
+using System.Collections.Generic;
+using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
+using System.Linq;
 using System.Runtime.InteropServices;
 using System.Security;
+using System.Threading.Tasks;
 using OpenDDSharp.DDS;
 using OpenDDSharp.Helpers;
 
@@ -68,6 +72,18 @@ public sealed class ParticipantService
     /// </summary>
     public bool IsShutdown => UnsafeNativeMethods.GetIsShutdown();
 
+    /// <summary>
+    /// Gets or sets the maximum time a <see cref="DataWriter" /> waits for its pending samples to be sent when it is deleted.
+    /// It bounds the time spent by the delete operations and the <see cref="FastShutdown" />.
+    /// The default value is zero, which means no limit.
+    /// </summary>
+    [SuppressMessage("Performance", "CA1822:Mark members as static", Justification = "We keep the singleton access to match OpenDDS API.")]
+    public TimeValue PendingTimeout
+    {
+        get => UnsafeNativeMethods.GetPendingTimeout();
+        set => UnsafeNativeMethods.SetPendingTimeout(value);
+    }
+
     /// <summary>
     /// Gets or sets the default discovery.
     /// </summary>
@@ -165,6 +181,78 @@ public sealed class ParticipantService
         return UnsafeNativeMethods.Shutdown();
     }
 
+    /// <summary>
+    /// Deletes the given participants and their contained entities concurrently and stops being a participant in the service.
+    /// </summary>
+    /// <remarks>
+    /// <para>Each participant runs <see cref="DomainParticipant.FastDeleteContainedEntities(int, TeardownTimings)" /> in parallel with the others,
+    /// each of them with its share of the processors, then the participants are deleted and the service is shut down. The operation stops at the first phase that fails.</para>
+    /// <para>All the participants created by the application must be passed, otherwise the shutdown returns <see cref="ReturnCode.PreconditionNotMet" />.</para>
+    /// </remarks>
+    /// <param name="factory">The <see cref="DomainParticipantFactory" /> used to create the participants.</param>
+    /// <param name="participants">The participants to be deleted.</param>
+    /// <param name="timings">The <see cref="TeardownTimings" /> to be filled up with the time spent on each phase, or <see langword="null"/>.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    [SuppressMessage("Performance", "CA1822:Mark members as static", Justification = "We keep the singleton access to match OpenDDS API.")]
+    public ReturnCode FastShutdown(DomainParticipantFactory factory, IEnumerable<DomainParticipant> participants, TeardownTimings timings)
+    {
+        if (factory == null || participants == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        var list = participants.Where(p => p != null).ToList();
+        var results = new ReturnCode[list.Count];
+        var partials = new TeardownTimings[list.Count];
+
+        // The participants already run in parallel, they share the processors instead of each one using all of them.
+        var maxThreads = Math.Max(1, Environment.ProcessorCount / Math.Max(1, list.Count));
+        Parallel.For(0, list.Count, i =>
+        {
+            partials[i] = new TeardownTimings();
+            results[i] = list[i].FastDeleteContainedEntities(maxThreads, partials[i]);
+        });
+
+        if (timings != null)
+        {
+            foreach (var t in partials)
+            {
+                timings.Merge(t);
+            }
+        }
+
+        var ret = results.FirstOrDefault(r => r != ReturnCode.Ok);
+        if (ret != ReturnCode.Ok)
+        {
+            return ret;
+        }
+
+        var watch = Stopwatch.StartNew();
+        foreach (var participant in list)
+        {
+            ret = factory.DeleteParticipant(participant);
+            if (ret != ReturnCode.Ok)
+            {
+                return ret;
+            }
+        }
+
+        if (timings != null)
+        {
+            timings.Participants = watch.Elapsed;
+        }
+
+        watch.Restart();
+        ret = UnsafeNativeMethods.Shutdown();
+
+        if (timings != null)
+        {
+            timings.Shutdown = watch.Elapsed;
+        }
+
+        return ret;
+    }
+
     private static string GetDefaultDiscovery()
     {
         var ptr = UnsafeNativeMethods.NativeGetDefaultDiscovery();
@@ -237,6 +325,15 @@ internal static partial class UnsafeNativeMethods
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
     [return: MarshalAs(UnmanagedType.U1)]
     public static partial bool GetIsShutdown();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "ParticipantService_GetPendingTimeout", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.Struct)]
+    public static extern TimeValue GetPendingTimeout();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "ParticipantService_SetPendingTimeout", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void SetPendingTimeout([MarshalAs(UnmanagedType.Struct)] TimeValue value);
 #else
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "ParticipantService_new", CallingConvention = CallingConvention.Cdecl)]
@@ -274,5 +371,14 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "ParticipantService_GetIsShutdown", CallingConvention = CallingConvention.Cdecl)]
     [return: MarshalAs(UnmanagedType.U1)]
     public static extern bool GetIsShutdown();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "ParticipantService_GetPendingTimeout", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.Struct)]
+    public static extern TimeValue GetPendingTimeout();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "ParticipantService_SetPendingTimeout", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void SetPendingTimeout([MarshalAs(UnmanagedType.Struct)] TimeValue value);
 #endif
 }
\ No newline at end of file
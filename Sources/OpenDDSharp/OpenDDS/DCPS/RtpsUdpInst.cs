@@ -164,6 +164,61 @@ public class RtpsUdpInst : TransportInst
         get => GetReceiveAddressDuration();
         set => SetReceiveAddressDuration(value);
     }
+
+    /// <summary>
+    /// Gets or sets the maximum size of an RTPS message. Samples bigger than this size are fragmented,
+    /// so it also determines the fragment size. The default value is 65466.
+    /// </summary>
+    public ulong MaxMessageSize
+    {
+        get => GetMaxMessageSize();
+        set => SetMaxMessageSize(value);
+    }
+
+    /// <summary>
+    /// Gets or sets the initial number of fragments that the reader expects for a fragmented sample.
+    /// It is used to size the initial NACK_FRAG bitmap when the heartbeat does not inform about the number of fragments.
+    /// The default value is 1.
+    /// </summary>
+    public ulong AnticipatedFragments
+    {
+        get => GetAnticipatedFragments();
+        set => SetAnticipatedFragments(value);
+    }
+
+    /// <summary>
+    /// Gets or sets a value indicating whether the reliability protocol responds immediately,
+    /// sending heartbeats and acknowledgements without waiting for the periodic timers.
+    /// The default value is false.
+    /// </summary>
+    public bool ResponsiveMode
+    {
+        get => GetResponsiveMode();
+        set => SetResponsiveMode(value);
+    }
+
+    /// <summary>
+    /// Gets or sets the time that the transport waits to aggregate samples in the same RTPS message before sending it.
+    /// It works together with <see cref="TransportInst.MaxSamplesPerPacket" />, a message is sent as soon as
+    /// it is full or the delay expires. The default value is 10 milliseconds.
+    /// </summary>
+    public TimeValue SendDelay
+    {
+        get => GetSendDelay();
+        set => SetSendDelay(value);
+    }
+
+    /// <summary>
+    /// Gets or sets a value indicating whether the transport counts the sent and received messages
+    /// per locator, the resent samples per writer and the NACKs per reader.
+    /// The counters can be read with <see cref="TransportInst.GetStatistics" />.
+    /// The default value is false.
+    /// </summary>
+    public bool CountMessages
+    {
+        get => GetCountMessages();
+        set => SetCountMessages(value);
+    }
     #endregion
 
     #region Constructors
@@ -327,6 +382,56 @@ public class RtpsUdpInst : TransportInst
     {
         UnsafeNativeMethods.SetReceiveAddressDuration(_native, value);
     }
+
+    private ulong GetMaxMessageSize()
+    {
+        return UnsafeNativeMethods.RtpsUdpInstGetMaxMessageSize(_native).ToUInt64();
+    }
+
+    private void SetMaxMessageSize(ulong value)
+    {
+        UnsafeNativeMethods.RtpsUdpInstSetMaxMessageSize(_native, new UIntPtr(value));
+    }
+
+    private ulong GetAnticipatedFragments()
+    {
+        return UnsafeNativeMethods.RtpsUdpInstGetAnticipatedFragments(_native).ToUInt64();
+    }
+
+    private void SetAnticipatedFragments(ulong value)
+    {
+        UnsafeNativeMethods.RtpsUdpInstSetAnticipatedFragments(_native, new UIntPtr(value));
+    }
+
+    private bool GetResponsiveMode()
+    {
+        return UnsafeNativeMethods.RtpsUdpInstGetResponsiveMode(_native);
+    }
+
+    private void SetResponsiveMode(bool value)
+    {
+        UnsafeNativeMethods.RtpsUdpInstSetResponsiveMode(_native, value);
+    }
+
+    private TimeValue GetSendDelay()
+    {
+        return UnsafeNativeMethods.RtpsUdpInstGetSendDelay(_native);
+    }
+
+    private void SetSendDelay(TimeValue value)
+    {
+        UnsafeNativeMethods.RtpsUdpInstSetSendDelay(_native, value);
+    }
+
+    private bool GetCountMessages()
+    {
+        return UnsafeNativeMethods.RtpsUdpInstGetCountMessages(_native);
+    }
+
+    private void SetCountMessages(bool value)
+    {
+        UnsafeNativeMethods.RtpsUdpInstSetCountMessages(_native, value);
+    }
     #endregion
 }
 
@@ -465,6 +570,57 @@ internal static partial class UnsafeNativeMethods
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetReceiveAddressDuration", CallingConvention = CallingConvention.Cdecl)]
     public static extern void SetReceiveAddressDuration(IntPtr mi, [MarshalAs(UnmanagedType.Struct)] TimeValue value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetMaxMessageSize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial UIntPtr RtpsUdpInstGetMaxMessageSize(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetMaxMessageSize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void RtpsUdpInstSetMaxMessageSize(IntPtr mi, UIntPtr value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetAnticipatedFragments")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial UIntPtr RtpsUdpInstGetAnticipatedFragments(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetAnticipatedFragments")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void RtpsUdpInstSetAnticipatedFragments(IntPtr mi, UIntPtr value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetResponsiveMode")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool RtpsUdpInstGetResponsiveMode(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetResponsiveMode")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void RtpsUdpInstSetResponsiveMode(IntPtr mi, [MarshalAs(UnmanagedType.I1)] bool value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetCountMessages")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool RtpsUdpInstGetCountMessages(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetCountMessages")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void RtpsUdpInstSetCountMessages(IntPtr mi, [MarshalAs(UnmanagedType.I1)] bool value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetSendDelay", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.Struct)]
+    public static extern TimeValue RtpsUdpInstGetSendDelay(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetSendDelay", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void RtpsUdpInstSetSendDelay(IntPtr mi, [MarshalAs(UnmanagedType.Struct)] TimeValue value);
 #else
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_new", CallingConvention = CallingConvention.Cdecl)]
@@ -571,5 +727,48 @@ internal static partial class UnsafeNativeMethods
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetReceiveAddressDuration", CallingConvention = CallingConvention.Cdecl)]
     public static extern void SetReceiveAddressDuration(IntPtr mi, [MarshalAs(UnmanagedType.Struct)] TimeValue value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetMaxMessageSize", CallingConvention = CallingConvention.Cdecl)]
+    public static extern UIntPtr RtpsUdpInstGetMaxMessageSize(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetMaxMessageSize", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void RtpsUdpInstSetMaxMessageSize(IntPtr mi, UIntPtr value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetAnticipatedFragments", CallingConvention = CallingConvention.Cdecl)]
+    public static extern UIntPtr RtpsUdpInstGetAnticipatedFragments(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetAnticipatedFragments", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void RtpsUdpInstSetAnticipatedFragments(IntPtr mi, UIntPtr value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetResponsiveMode", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool RtpsUdpInstGetResponsiveMode(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetResponsiveMode", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void RtpsUdpInstSetResponsiveMode(IntPtr mi, [MarshalAs(UnmanagedType.I1)] bool value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetCountMessages", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool RtpsUdpInstGetCountMessages(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetCountMessages", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void RtpsUdpInstSetCountMessages(IntPtr mi, [MarshalAs(UnmanagedType.I1)] bool value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_GetSendDelay", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.Struct)]
+    public static extern TimeValue RtpsUdpInstGetSendDelay(IntPtr mi);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsUdpInst_SetSendDelay", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void RtpsUdpInstSetSendDelay(IntPtr mi, [MarshalAs(UnmanagedType.Struct)] TimeValue value);
 #endif
 }
\ No newline at end of file
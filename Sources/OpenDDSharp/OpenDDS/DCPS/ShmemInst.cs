@@ -71,9 +71,16 @@ public class ShmemInst : TransportInst
     }
 
     /// <summary>
-    /// Gets the host name.
+    /// Gets or sets the host name used to identify the host machine.
+    /// Two shared-memory transport instances only associate when they report the same host name,
+    /// so it can be overridden to group processes (e.g. containers sharing /dev/shm) that see different host names.
+    /// Defaults to the machine host name.
     /// </summary>
-    public string HostName => GetHostName();
+    public string HostName
+    {
+        get => GetHostName();
+        set => SetHostName(value);
+    }
 
     /// <summary>
     /// Gets the pool name.
@@ -129,6 +136,11 @@ public class ShmemInst : TransportInst
         return Marshal.PtrToStringAnsi(UnsafeNativeMethods.GetHostName(_native));
     }
 
+    private void SetHostName(string value)
+    {
+        UnsafeNativeMethods.ShmemInstSetHostName(_native, value);
+    }
+
     private string GetPoolName()
     {
         return Marshal.PtrToStringAnsi(UnsafeNativeMethods.GetPoolName(_native));
@@ -182,6 +194,11 @@ internal static partial class UnsafeNativeMethods
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
     public static partial IntPtr GetHostName(IntPtr si);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "ShmemInst_SetHostName", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void ShmemInstSetHostName(IntPtr si, string value);
+
     [SuppressUnmanagedCodeSecurity]
     [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "ShmemInst_GetPoolName")]
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
@@ -216,6 +233,10 @@ internal static partial class UnsafeNativeMethods
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "ShmemInst_GetHostName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
     public static extern IntPtr GetHostName(IntPtr si);
 
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "ShmemInst_SetHostName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
+    public static extern void ShmemInstSetHostName(IntPtr si, string value);
+
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "ShmemInst_GetPoolName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
     public static extern IntPtr GetPoolName(IntPtr si);
@@ -0,0 +1,464 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using System.Globalization;
+using System.Linq;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.DDS;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Represents the OpenDDS static discovery.
+/// </summary>
+/// <remarks>
+/// <para>With static discovery the endpoints are declared in advance, so the writers and readers match as soon as they are enabled,
+/// without any SPDP/SEDP exchange. The endpoints can be declared from a configuration file or programmatically with
+/// <see cref="AddEndpoints" />.</para>
+/// <para>Set <see cref="ParticipantService.DefaultDiscovery" /> to <see cref="Discovery.DEFAULT_STATIC" /> to use it.</para>
+/// </remarks>
+public class StaticDiscovery : Discovery
+{
+    #region Constants
+    private const int PARTICIPANT_ID_LENGTH = 6;
+    private const int ENTITY_KEY_LENGTH = 3;
+    #endregion
+
+    #region Fields
+    private static readonly object _lock = new object();
+    private static readonly HashSet<string> _names = new HashSet<string>(StringComparer.Ordinal);
+    #endregion
+
+    #region Constructors
+    /// <summary>
+    /// Initializes a new instance of the <see cref="StaticDiscovery"/> class.
+    /// </summary>
+    /// <remarks>
+    /// OpenDDS has a single static discovery instance registered with the <see cref="Discovery.DEFAULT_STATIC" /> key.
+    /// </remarks>
+    public StaticDiscovery()
+    {
+        FromNative(UnsafeNativeMethods.StaticDiscoveryNarrowBase(UnsafeNativeMethods.StaticDiscoveryGetInstance()));
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Loads the topics, QoS and endpoints declared in an OpenDDS configuration file.
+    /// </summary>
+    /// <param name="fileName">The configuration file path.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    [SuppressMessage("Performance", "CA1822:Mark members as static", Justification = "Keep the instance access as the rest of discoveries.")]
+    public ReturnCode LoadConfiguration(string fileName)
+    {
+        if (string.IsNullOrWhiteSpace(fileName))
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        var cf = UnsafeNativeMethods.StaticDiscoveryNewConfiguration();
+        if (cf == IntPtr.Zero)
+        {
+            return ReturnCode.Error;
+        }
+
+        try
+        {
+            var ret = UnsafeNativeMethods.StaticDiscoveryImportConfiguration(cf, fileName);
+            if (ret != ReturnCode.Ok)
+            {
+                return ret;
+            }
+
+            return UnsafeNativeMethods.StaticDiscoveryLoadConfiguration(cf);
+        }
+        finally
+        {
+            UnsafeNativeMethods.StaticDiscoveryDeleteConfiguration(cf);
+        }
+    }
+
+    /// <summary>
+    /// Declares a set of endpoints in the static discovery.
+    /// </summary>
+    /// <remarks>
+    /// <para>The endpoint names must be unique, also across calls, because they name the configuration sections of the endpoints.</para>
+    /// <para>The static discovery cannot declare the durability service, writer data lifecycle and data representation policies,
+    /// so an endpoint with a non-default value in any of them returns <see cref="ReturnCode.Unsupported" />. The user data is
+    /// reserved for the entity key.</para>
+    /// </remarks>
+    /// <param name="endpoints">The endpoints to be declared.</param>
+    /// <returns>The <see cref="ReturnCode" /> that indicates the operation result.</returns>
+    [SuppressMessage("Performance", "CA1822:Mark members as static", Justification = "Keep the instance access as the rest of discoveries.")]
+    public ReturnCode AddEndpoints(IEnumerable<StaticEndpoint> endpoints)
+    {
+        if (endpoints == null)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        var list = endpoints.ToList();
+        if (list.Any(e => !IsValid(e)))
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        if (list.Select(e => e.Name).Distinct(StringComparer.Ordinal).Count() != list.Count)
+        {
+            return ReturnCode.BadParameter;
+        }
+
+        if (list.Any(e => !IsSupported(e)))
+        {
+            return ReturnCode.Unsupported;
+        }
+
+        lock (_lock)
+        {
+            if (list.Any(e => _names.Contains(e.Name)))
+            {
+                return ReturnCode.BadParameter;
+            }
+
+            var cf = UnsafeNativeMethods.StaticDiscoveryNewConfiguration();
+            if (cf == IntPtr.Zero)
+            {
+                return ReturnCode.Error;
+            }
+
+            try
+            {
+                foreach (var endpoint in list)
+                {
+                    var ret = AddEndpoint(cf, endpoint);
+                    if (ret != ReturnCode.Ok)
+                    {
+                        return ret;
+                    }
+                }
+
+                var result = UnsafeNativeMethods.StaticDiscoveryLoadConfiguration(cf);
+                if (result == ReturnCode.Ok)
+                {
+                    _names.UnionWith(list.Select(e => e.Name));
+                }
+
+                return result;
+            }
+            finally
+            {
+                UnsafeNativeMethods.StaticDiscoveryDeleteConfiguration(cf);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Sets the participant id used by the static discovery to build the GUID of the participant entities.
+    /// </summary>
+    /// <param name="qos">The <see cref="DomainParticipantQos" /> used to create the participant.</param>
+    /// <param name="participantId">The six bytes that identify the participant.</param>
+    public static void SetParticipantId(DomainParticipantQos qos, IList<byte> participantId)
+    {
+        if (qos == null)
+        {
+            throw new ArgumentNullException(nameof(qos));
+        }
+
+        qos.UserData.Value = CheckLength(participantId, PARTICIPANT_ID_LENGTH, nameof(participantId));
+    }
+
+    /// <summary>
+    /// Sets the entity key used by the static discovery to build the GUID of a data writer.
+    /// </summary>
+    /// <param name="qos">The <see cref="DataWriterQos" /> used to create the data writer.</param>
+    /// <param name="entityKey">The three bytes that identify the data writer inside its participant.</param>
+    public static void SetEntityKey(DataWriterQos qos, IList<byte> entityKey)
+    {
+        if (qos == null)
+        {
+            throw new ArgumentNullException(nameof(qos));
+        }
+
+        qos.UserData.Value = CheckLength(entityKey, ENTITY_KEY_LENGTH, nameof(entityKey));
+    }
+
+    /// <summary>
+    /// Sets the entity key used by the static discovery to build the GUID of a data reader.
+    /// </summary>
+    /// <param name="qos">The <see cref="DataReaderQos" /> used to create the data reader.</param>
+    /// <param name="entityKey">The three bytes that identify the data reader inside its participant.</param>
+    public static void SetEntityKey(DataReaderQos qos, IList<byte> entityKey)
+    {
+        if (qos == null)
+        {
+            throw new ArgumentNullException(nameof(qos));
+        }
+
+        qos.UserData.Value = CheckLength(entityKey, ENTITY_KEY_LENGTH, nameof(entityKey));
+    }
+
+    private static IList<byte> CheckLength(IList<byte> value, int length, string name)
+    {
+        if (value == null || value.Count != length)
+        {
+            throw new ArgumentException($"The value must contain exactly {length} bytes.", name);
+        }
+
+        return value.ToList();
+    }
+
+    private static bool IsValid(StaticEndpoint endpoint)
+    {
+        return endpoint != null &&
+               !string.IsNullOrWhiteSpace(endpoint.Name) &&
+               !string.IsNullOrWhiteSpace(endpoint.TopicName) &&
+               !string.IsNullOrWhiteSpace(endpoint.TypeName) &&
+               endpoint.ParticipantId?.Count == PARTICIPANT_ID_LENGTH &&
+               endpoint.EntityKey?.Count == ENTITY_KEY_LENGTH &&
+               (!string.IsNullOrWhiteSpace(endpoint.TransportConfig) || !string.IsNullOrWhiteSpace(endpoint.LocalAddress));
+    }
+
+    private static ReturnCode AddEndpoint(IntPtr cf, StaticEndpoint endpoint)
+    {
+        var values = new List<(string Section, string Key, string Value)>
+        {
+            ("topic/" + endpoint.TopicName, "name", endpoint.TopicName),
+            ("topic/" + endpoint.TopicName, "type_name", endpoint.TypeName),
+        };
+
+        var section = "endpoint/" + endpoint.Name;
+        values.Add((section, "domain", endpoint.Domain.ToString(CultureInfo.InvariantCulture)));
+        values.Add((section, "participant", ToHex(endpoint.ParticipantId)));
+        values.Add((section, "entity", ToHex(endpoint.EntityKey)));
+        values.Add((section, "topic", endpoint.TopicName));
+
+        var config = endpoint.TransportConfig;
+        if (string.IsNullOrWhiteSpace(config))
+        {
+            config = endpoint.Name + "_config";
+            var transport = endpoint.Name + "_rtps";
+            values.Add(("config/" + config, "transports", transport));
+            values.Add(("transport/" + transport, "transport_type", "rtps_udp"));
+            values.Add(("transport/" + transport, "use_multicast", "0"));
+            values.Add(("transport/" + transport, "local_address", endpoint.LocalAddress));
+        }
+
+        values.Add((section, "config", config));
+
+        var qosSection = endpoint.Name + "_qos";
+        if (endpoint.Kind == EndpointKind.DataWriter)
+        {
+            values.Add((section, "type", "writer"));
+
+            if (endpoint.DataWriterQos != null)
+            {
+                var qos = endpoint.DataWriterQos;
+                var qosPath = "datawriterqos/" + qosSection;
+                values.Add((section, "datawriterqos", qosSection));
+                AddQos(values, qosPath, qos.Durability, qos.Deadline, qos.LatencyBudget, qos.Liveliness, qos.Reliability,
+                    qos.DestinationOrder, qos.History, qos.ResourceLimits, qos.Ownership);
+                values.Add((qosPath, "transport_priority.value", ToInvariant(qos.TransportPriority.Value)));
+                AddDuration(values, qosPath, "lifespan.duration", qos.Lifespan.Duration);
+                values.Add((qosPath, "ownership_strength.value", ToInvariant(qos.OwnershipStrength.Value)));
+            }
+        }
+        else
+        {
+            values.Add((section, "type", "reader"));
+
+            if (endpoint.DataReaderQos != null)
+            {
+                var qos = endpoint.DataReaderQos;
+                var qosPath = "datareaderqos/" + qosSection;
+                values.Add((section, "datareaderqos", qosSection));
+                AddQos(values, qosPath, qos.Durability, qos.Deadline, qos.LatencyBudget, qos.Liveliness, qos.Reliability,
+                    qos.DestinationOrder, qos.History, qos.ResourceLimits, qos.Ownership);
+                AddDuration(values, qosPath, "time_based_filter.minimum_separation", qos.TimeBasedFilter.MinimumSeparation);
+                AddDuration(values, qosPath, "reader_data_lifecycle.autopurge_nowriter_samples_delay", qos.ReaderDataLifecycle.AutopurgeNowriterSamplesDelay);
+                AddDuration(values, qosPath, "reader_data_lifecycle.autopurge_disposed_samples_delay", qos.ReaderDataLifecycle.AutopurgeDisposedSamplesDelay);
+            }
+        }
+
+        foreach (var (s, k, v) in values)
+        {
+            var ret = UnsafeNativeMethods.StaticDiscoverySetConfigurationValue(cf, s, k, v);
+            if (ret != ReturnCode.Ok)
+            {
+                return ret;
+            }
+        }
+
+        return ReturnCode.Ok;
+    }
+
+    // The policies without a static discovery key must keep their default value.
+    private static bool IsSupported(StaticEndpoint endpoint)
+    {
+        if (endpoint.Kind == EndpointKind.DataWriter)
+        {
+            var qos = endpoint.DataWriterQos;
+            var defaults = new DataWriterQos();
+            return qos == null || (qos.DurabilityService == defaults.DurabilityService &&
+                                   qos.WriterDataLifecycle == defaults.WriterDataLifecycle &&
+                                   qos.Representation == defaults.Representation);
+        }
+        else
+        {
+            var qos = endpoint.DataReaderQos;
+            return qos == null || qos.Representation == new DataReaderQos().Representation;
+        }
+    }
+
+    private static void AddQos(ICollection<(string Section, string Key, string Value)> values, string section,
+        DurabilityQosPolicy durability, DeadlineQosPolicy deadline, LatencyBudgetQosPolicy latencyBudget, LivelinessQosPolicy liveliness,
+        ReliabilityQosPolicy reliability, DestinationOrderQosPolicy destinationOrder, HistoryQosPolicy history,
+        ResourceLimitsQosPolicy resourceLimits, OwnershipQosPolicy ownership)
+    {
+        values.Add((section, "durability.kind", durability.Kind switch
+        {
+            DurabilityQosPolicyKind.TransientLocalDurabilityQos => "TRANSIENT_LOCAL",
+            DurabilityQosPolicyKind.TransientDurabilityQos => "TRANSIENT",
+            DurabilityQosPolicyKind.PersistentDurabilityQos => "PERSISTENT",
+            _ => "VOLATILE",
+        }));
+        AddDuration(values, section, "deadline.period", deadline.Period);
+        AddDuration(values, section, "latency_budget.duration", latencyBudget.Duration);
+        values.Add((section, "liveliness.kind", liveliness.Kind switch
+        {
+            LivelinessQosPolicyKind.ManualByParticipantLivelinessQos => "MANUAL_BY_PARTICIPANT",
+            LivelinessQosPolicyKind.ManualByTopicLivelinessQos => "MANUAL_BY_TOPIC",
+            _ => "AUTOMATIC",
+        }));
+        AddDuration(values, section, "liveliness.lease_duration", liveliness.LeaseDuration);
+        values.Add((section, "reliability.kind", reliability.Kind == ReliabilityQosPolicyKind.ReliableReliabilityQos ? "RELIABLE" : "BEST_EFFORT"));
+        AddDuration(values, section, "reliability.max_blocking_time", reliability.MaxBlockingTime);
+        values.Add((section, "destination_order.kind", destinationOrder.Kind == DestinationOrderQosPolicyKind.BySourceTimestampDestinationOrderQos ? "BY_SOURCE_TIMESTAMP" : "BY_RECEPTION_TIMESTAMP"));
+        values.Add((section, "history.kind", history.Kind == HistoryQosPolicyKind.KeepAllHistoryQos ? "KEEP_ALL" : "KEEP_LAST"));
+        values.Add((section, "history.depth", ToInvariant(history.Depth)));
+        values.Add((section, "resource_limits.max_samples", ToInvariant(resourceLimits.MaxSamples)));
+        values.Add((section, "resource_limits.max_instances", ToInvariant(resourceLimits.MaxInstances)));
+        values.Add((section, "resource_limits.max_samples_per_instance", ToInvariant(resourceLimits.MaxSamplesPerInstance)));
+        values.Add((section, "ownership.kind", ownership.Kind == OwnershipQosPolicyKind.ExclusiveOwnershipQos ? "EXCLUSIVE" : "SHARED"));
+    }
+
+    private static void AddDuration(ICollection<(string Section, string Key, string Value)> values, string section, string key, Duration duration)
+    {
+        values.Add((section, key + ".sec", ToInvariant(duration.Seconds)));
+        values.Add((section, key + ".nanosec", duration.NanoSeconds.ToString(CultureInfo.InvariantCulture)));
+    }
+
+    private static string ToInvariant(int value)
+    {
+        return value.ToString(CultureInfo.InvariantCulture);
+    }
+
+    private static string ToHex(IEnumerable<byte> value)
+    {
+        return string.Concat(value.Select(b => b.ToString("x2", CultureInfo.InvariantCulture)));
+    }
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage
+/// is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+[ExcludeFromCodeCoverage]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:FileMayOnlyContainASingleType", Justification = "Native p/invoke calls.")]
+[SuppressMessage("StyleCop.CSharp.DocumentationRules", "SA1601:PartialElementsMustBeDocumented", Justification = "Partial required for the source generator.")]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_NarrowBase")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr StaticDiscoveryNarrowBase(IntPtr ptr);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_GetInstance")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr StaticDiscoveryGetInstance();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_NewConfiguration")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr StaticDiscoveryNewConfiguration();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_DeleteConfiguration")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void StaticDiscoveryDeleteConfiguration(IntPtr cf);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_SetConfigurationValue", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode StaticDiscoverySetConfigurationValue(IntPtr cf, string section, string key, string value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_ImportConfiguration", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode StaticDiscoveryImportConfiguration(IntPtr cf, string fileName);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_LoadConfiguration")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ReturnCode StaticDiscoveryLoadConfiguration(IntPtr cf);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_NarrowBase", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr StaticDiscoveryNarrowBase(IntPtr ptr);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_GetInstance", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr StaticDiscoveryGetInstance();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_NewConfiguration", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr StaticDiscoveryNewConfiguration();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_DeleteConfiguration", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void StaticDiscoveryDeleteConfiguration(IntPtr cf);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_SetConfigurationValue", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
+    public static extern ReturnCode StaticDiscoverySetConfigurationValue(IntPtr cf, string section, string key, string value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_ImportConfiguration", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
+    public static extern ReturnCode StaticDiscoveryImportConfiguration(IntPtr cf, string fileName);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "StaticDiscovery_LoadConfiguration", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ReturnCode StaticDiscoveryLoadConfiguration(IntPtr cf);
+#endif
+}
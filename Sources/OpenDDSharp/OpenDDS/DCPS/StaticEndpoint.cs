@@ -0,0 +1,95 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System.Collections.Generic;
+using OpenDDSharp.DDS;
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Declares a data writer or data reader known in advance by the <see cref="StaticDiscovery" />.
+/// </summary>
+/// <remarks>
+/// The endpoint GUID is built from the <see cref="ParticipantId" /> and the <see cref="EntityKey" />. The local entities must be created
+/// with the same values in their user data, see <see cref="StaticDiscovery.SetParticipantId" /> and <see cref="StaticDiscovery.SetEntityKey(DataWriterQos, IList{byte})" />.
+/// </remarks>
+public sealed class StaticEndpoint
+{
+    #region Properties
+    /// <summary>
+    /// Gets or sets the unique name of the endpoint in the configuration.
+    /// </summary>
+    public string Name { get; set; }
+
+    /// <summary>
+    /// Gets or sets the domain id of the endpoint.
+    /// </summary>
+    public int Domain { get; set; }
+
+    /// <summary>
+    /// Gets or sets the six bytes that identify the participant of the endpoint.
+    /// </summary>
+    public IList<byte> ParticipantId { get; set; }
+
+    /// <summary>
+    /// Gets or sets the three bytes that identify the endpoint inside its participant.
+    /// </summary>
+    public IList<byte> EntityKey { get; set; }
+
+    /// <summary>
+    /// Gets or sets the kind of endpoint.
+    /// </summary>
+    public EndpointKind Kind { get; set; }
+
+    /// <summary>
+    /// Gets or sets the topic name.
+    /// </summary>
+    public string TopicName { get; set; }
+
+    /// <summary>
+    /// Gets or sets the registered type name of the topic.
+    /// </summary>
+    public string TypeName { get; set; }
+
+    /// <summary>
+    /// Gets or sets the name of an existing transport configuration used to reach the endpoint.
+    /// </summary>
+    /// <remarks>
+    /// If <see langword="null"/>, a rtps_udp transport configuration bound to <see cref="LocalAddress" /> is declared for the endpoint.
+    /// </remarks>
+    public string TransportConfig { get; set; }
+
+    /// <summary>
+    /// Gets or sets the unicast locator (host:port) of the endpoint when <see cref="TransportConfig" /> is not set.
+    /// </summary>
+    public string LocalAddress { get; set; }
+
+    /// <summary>
+    /// Gets or sets the <see cref="DDS.DataWriterQos" /> of the endpoint when the kind is <see cref="EndpointKind.DataWriter" />.
+    /// If <see langword="null"/>, the default QoS is used.
+    /// </summary>
+    public DataWriterQos DataWriterQos { get; set; }
+
+    /// <summary>
+    /// Gets or sets the <see cref="DDS.DataReaderQos" /> of the endpoint when the kind is <see cref="EndpointKind.DataReader" />.
+    /// If <see langword="null"/>, the default QoS is used.
+    /// </summary>
+    public DataReaderQos DataReaderQos { get; set; }
+    #endregion
+}
@@ -0,0 +1,248 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Diagnostics.CodeAnalysis;
+using System.Globalization;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Security;
+using System.Threading;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Native trace event recorder of the wrapper hot path (listener dispatch, waits, reads, writes and marshaling).
+/// </summary>
+/// <remarks>
+/// <para>The events are kept in per-thread native ring buffers and written to a Chrome trace event file
+/// that can be opened with the Perfetto UI or chrome://tracing. When disabled, the traced calls only pay for an atomic load.</para>
+/// <para>If a <see cref="TriggerThreshold" /> is set, the first traced call that takes longer stops the recording,
+/// so the rings keep the events that led to the latency spike until they are flushed. The blocking waits
+/// (i.e. <c>WaitSet.Wait</c>) are traced but never fire the trigger.</para>
+/// </remarks>
+public static class Tracer
+{
+    #region Fields
+    private static readonly object _lock = new object();
+    private static Timer _triggerTimer;
+    private static string _triggerPath;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets or sets a value indicating whether the trace events are recorded.
+    /// </summary>
+    public static bool Enabled
+    {
+        get => UnsafeNativeMethods.TracerGetEnabled();
+        set => UnsafeNativeMethods.TracerSetEnabled(value);
+    }
+
+    /// <summary>
+    /// Gets or sets the duration of a traced call that stops the recording. <see cref="TimeSpan.Zero" /> disables the trigger.
+    /// </summary>
+    public static TimeSpan TriggerThreshold
+    {
+        get => TimeSpan.FromTicks((long)(UnsafeNativeMethods.TracerGetTriggerThreshold() / 100));
+        set => UnsafeNativeMethods.TracerSetTriggerThreshold(value <= TimeSpan.Zero ? 0 : (ulong)value.Ticks * 100);
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the <see cref="TriggerThreshold" /> has been exceeded since the last <see cref="Clear" />.
+    /// </summary>
+    public static bool Triggered => UnsafeNativeMethods.TracerGetTriggered();
+
+    /// <summary>
+    /// Gets the native tracer state shared with the generated type support libraries.
+    /// </summary>
+    /// <remarks>
+    /// This property is intended to be used from the generated type support code.
+    /// </remarks>
+    public static IntPtr NativeState => UnsafeNativeMethods.TracerGetState();
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Writes the recorded events to a Chrome trace event JSON file.
+    /// </summary>
+    /// <param name="path">The path of the trace file.</param>
+    /// <returns>The number of events written or -1 if the file couldn't be written.</returns>
+    public static int Flush(string path)
+    {
+        if (string.IsNullOrWhiteSpace(path))
+        {
+            throw new ArgumentNullException(nameof(path));
+        }
+
+        return UnsafeNativeMethods.TracerFlush(path);
+    }
+
+    /// <summary>
+    /// Discards the recorded events and resets the <see cref="Triggered" /> flag.
+    /// </summary>
+    /// <remarks>
+    /// The events recorded by other threads while clearing may or may not be kept.
+    /// </remarks>
+    public static void Clear()
+    {
+        UnsafeNativeMethods.TracerClear();
+    }
+
+    /// <summary>
+    /// Automatically flushes the events every time the <see cref="TriggerThreshold" /> is exceeded and restarts the recording.
+    /// </summary>
+    /// <remarks>
+    /// Each trace is written next to the given path with the UTC time of the flush appended to the file name.
+    /// </remarks>
+    /// <param name="path">The base path of the trace files or <see langword="null" /> to stop flushing on trigger.</param>
+    /// <param name="pollInterval">The interval used to check the trigger.</param>
+    public static void FlushOnTrigger(string path, TimeSpan pollInterval)
+    {
+        lock (_lock)
+        {
+            _triggerTimer?.Dispose();
+            _triggerTimer = null;
+            _triggerPath = path;
+
+            if (string.IsNullOrWhiteSpace(path))
+            {
+                return;
+            }
+
+            _triggerTimer = new Timer(_ => CheckTrigger(), null, pollInterval, pollInterval);
+        }
+    }
+
+    private static void CheckTrigger()
+    {
+        lock (_lock)
+        {
+            if (_triggerPath is null || !Triggered)
+            {
+                return;
+            }
+
+            var directory = Path.GetDirectoryName(_triggerPath) ?? string.Empty;
+            var name = Path.GetFileNameWithoutExtension(_triggerPath);
+            var extension = Path.GetExtension(_triggerPath);
+            var timestamp = DateTime.UtcNow.ToString("yyyyMMddHHmmssfff", CultureInfo.InvariantCulture);
+
+            Flush(Path.Combine(directory, name + "-" + timestamp + extension));
+            Clear();
+            Enabled = true;
+        }
+    }
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:FileMayOnlyContainASingleType", Justification = "Native p/invoke calls.")]
+[SuppressMessage("StyleCop.CSharp.DocumentationRules", "SA1601:PartialElementsMustBeDocumented", Justification = "Partial required for the source generator.")]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetState")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr TracerGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_SetEnabled")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void TracerSetEnabled([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetEnabled")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool TracerGetEnabled();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_SetTriggerThreshold")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void TracerSetTriggerThreshold(ulong threshold);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetTriggerThreshold")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial ulong TracerGetTriggerThreshold();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetTriggered")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static partial bool TracerGetTriggered();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_Clear")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void TracerClear();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_Flush", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial int TracerFlush(string path);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetState", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr TracerGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_SetEnabled", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void TracerSetEnabled([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetEnabled", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool TracerGetEnabled();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_SetTriggerThreshold", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void TracerSetTriggerThreshold(ulong threshold);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetTriggerThreshold", CallingConvention = CallingConvention.Cdecl)]
+    public static extern ulong TracerGetTriggerThreshold();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_GetTriggered", CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool TracerGetTriggered();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_Clear", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void TracerClear();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "Tracer_Flush", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
+    public static extern int TracerFlush(string path);
+#endif
+}
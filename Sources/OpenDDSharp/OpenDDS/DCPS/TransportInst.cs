@@ -18,6 +18,7 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 using System.Security;
 using OpenDDSharp.Helpers;
@@ -216,6 +217,46 @@ public class TransportInst
         UnsafeNativeMethods.SetDatalinkControlChunks(_native, new UIntPtr(value));
     }
 
+    /// <summary>
+    /// Gets a snapshot of the message counters kept by the transport instance.
+    /// </summary>
+    /// <remarks>
+    /// Only the rtps_udp transport keeps message counters and they must be enabled with
+    /// <see cref="RtpsUdpInst.CountMessages" />, other transports return empty statistics.
+    /// The counters are cumulative, call this method periodically and subtract two snapshots to get rates.
+    /// </remarks>
+    /// <returns>The <see cref="TransportStatistics" /> of the transport instance.</returns>
+    public TransportStatistics GetStatistics()
+    {
+        var messages = IntPtr.Zero;
+        var resends = IntPtr.Zero;
+        var nacks = IntPtr.Zero;
+        UnsafeNativeMethods.TransportInstGetStatistics(_native, ref messages, ref resends, ref nacks);
+
+        IList<TransportMessageCount> messageCounts = new List<TransportMessageCount>();
+        if (!messages.Equals(IntPtr.Zero))
+        {
+            messages.PtrToSequence(ref messageCounts);
+            messages.ReleaseNativePointer();
+        }
+
+        IList<TransportGuidCount> resendCounts = new List<TransportGuidCount>();
+        if (!resends.Equals(IntPtr.Zero))
+        {
+            resends.PtrToSequence(ref resendCounts);
+            resends.ReleaseNativePointer();
+        }
+
+        IList<TransportGuidCount> nackCounts = new List<TransportGuidCount>();
+        if (!nacks.Equals(IntPtr.Zero))
+        {
+            nacks.PtrToSequence(ref nackCounts);
+            nacks.ReleaseNativePointer();
+        }
+
+        return new TransportStatistics(Name, messageCounts, resendCounts, nackCounts);
+    }
+
     internal IntPtr ToNative()
     {
         return _native;
@@ -302,6 +343,11 @@ internal static partial class UnsafeNativeMethods
     [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "TransportInst_SetDatalinkControlChunks")]
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
     public static partial void SetDatalinkControlChunks(IntPtr ti, UIntPtr value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "TransportInst_GetStatistics")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void TransportInstGetStatistics(IntPtr ti, ref IntPtr messageCounts, ref IntPtr writerResendCounts, ref IntPtr readerNackCounts);
 #else
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "TransportInst_GetTransportType", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
@@ -359,5 +405,9 @@ internal static partial class UnsafeNativeMethods
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "TransportInst_SetDatalinkControlChunks", CallingConvention = CallingConvention.Cdecl)]
     public static extern void SetDatalinkControlChunks(IntPtr ti, UIntPtr value);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "TransportInst_GetStatistics", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void TransportInstGetStatistics(IntPtr ti, ref IntPtr messageCounts, ref IntPtr writerResendCounts, ref IntPtr readerNackCounts);
 #endif
 }
\ No newline at end of file
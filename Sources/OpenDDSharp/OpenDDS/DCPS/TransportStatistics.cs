@@ -0,0 +1,243 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using System.Linq;
+using System.Net;
+using System.Runtime.InteropServices;
+using OpenDDSharp.DDS;
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Snapshot of the message counters kept by a transport instance.
+/// </summary>
+/// <remarks>
+/// The counters are maintained by the transport implementation itself and only the rtps_udp transport
+/// provides them. Message counting must be enabled with <see cref="RtpsUdpInst.CountMessages" />.
+/// The counters are kept per remote locator, per local writer and per local reader, which is the association
+/// granularity tracked by the transport. Per-thread utilization is not part of the transport statistics, it is
+/// published through the <see cref="InternalThreadBuiltinTopicDataDataReader" /> built-in topic when <c>DCPSThreadStatusInterval</c> is set.
+/// </remarks>
+public class TransportStatistics
+{
+    #region Properties
+    /// <summary>
+    /// Gets the name of the transport instance.
+    /// </summary>
+    public string Transport { get; }
+
+    /// <summary>
+    /// Gets the message counters per remote locator.
+    /// </summary>
+    public IReadOnlyList<TransportMessageCount> MessageCounts { get; }
+
+    /// <summary>
+    /// Gets the number of resent samples per local writer.
+    /// </summary>
+    public IReadOnlyList<TransportGuidCount> WriterResendCounts { get; }
+
+    /// <summary>
+    /// Gets the number of NACKs sent per local reader.
+    /// </summary>
+    public IReadOnlyList<TransportGuidCount> ReaderNackCounts { get; }
+
+    /// <summary>
+    /// Gets the total number of messages sent by the transport.
+    /// </summary>
+    public ulong SendCount => MessageCounts.Aggregate(0UL, (total, m) => total + m.SendCount);
+
+    /// <summary>
+    /// Gets the total number of bytes sent by the transport.
+    /// </summary>
+    public ulong SendBytes => MessageCounts.Aggregate(0UL, (total, m) => total + m.SendBytes);
+
+    /// <summary>
+    /// Gets the total number of messages that failed to be sent by the transport.
+    /// </summary>
+    public ulong SendFailCount => MessageCounts.Aggregate(0UL, (total, m) => total + m.SendFailCount);
+
+    /// <summary>
+    /// Gets the total number of messages received by the transport.
+    /// </summary>
+    public ulong ReceiveCount => MessageCounts.Aggregate(0UL, (total, m) => total + m.ReceiveCount);
+
+    /// <summary>
+    /// Gets the total number of bytes received by the transport.
+    /// </summary>
+    public ulong ReceiveBytes => MessageCounts.Aggregate(0UL, (total, m) => total + m.ReceiveBytes);
+
+    /// <summary>
+    /// Gets the total number of samples resent by the local writers.
+    /// </summary>
+    public ulong ResendCount => WriterResendCounts.Aggregate(0UL, (total, c) => total + c.Count);
+
+    /// <summary>
+    /// Gets the total number of NACKs sent by the local readers.
+    /// </summary>
+    public ulong NackCount => ReaderNackCounts.Aggregate(0UL, (total, c) => total + c.Count);
+    #endregion
+
+    #region Constructors
+    internal TransportStatistics(string transport, IList<TransportMessageCount> messageCounts, IList<TransportGuidCount> writerResendCounts, IList<TransportGuidCount> readerNackCounts)
+    {
+        Transport = transport;
+        MessageCounts = messageCounts.ToList();
+        WriterResendCounts = writerResendCounts.ToList();
+        ReaderNackCounts = readerNackCounts.ToList();
+    }
+    #endregion
+}
+
+/// <summary>
+/// Kind of the messages counted by the transport.
+/// </summary>
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the transport statistics.")]
+public enum MessageCountKind
+{
+    /// <summary>
+    /// RTPS messages.
+    /// </summary>
+    Rtps = 0,
+
+    /// <summary>
+    /// STUN messages used for the ICE connectivity checks.
+    /// </summary>
+    Stun = 1,
+}
+
+/// <summary>
+/// Message counters of a transport for a single remote locator.
+/// </summary>
+[StructLayout(LayoutKind.Sequential, Pack = 1)]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the transport statistics.")]
+public struct TransportMessageCount
+{
+    #region Constants
+    private const int LOCATOR_KIND_UDPV4 = 1;
+    #endregion
+
+    #region Fields
+    private int _locatorKind;
+    private uint _locatorPort;
+    [MarshalAs(UnmanagedType.ByValArray, ArraySubType = UnmanagedType.I1, SizeConst = 16)]
+    private byte[] _locatorAddress;
+    private MessageCountKind _kind;
+    [MarshalAs(UnmanagedType.I1)]
+    private bool _relay;
+    private uint _sendCount;
+    private uint _sendBytes;
+    private uint _sendFailCount;
+    private uint _sendFailBytes;
+    private uint _receiveCount;
+    private uint _receiveBytes;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the remote locator in the address:port format.
+    /// </summary>
+    public string Locator
+    {
+        get
+        {
+            if (_locatorAddress == null)
+            {
+                return string.Empty;
+            }
+
+            var address = _locatorKind == LOCATOR_KIND_UDPV4
+                ? new IPAddress(_locatorAddress.Skip(12).ToArray())
+                : new IPAddress(_locatorAddress);
+
+            return new IPEndPoint(address, (int)_locatorPort).ToString();
+        }
+    }
+
+    /// <summary>
+    /// Gets the kind of the counted messages.
+    /// </summary>
+    public MessageCountKind Kind => _kind;
+
+    /// <summary>
+    /// Gets a value indicating whether the messages were sent through the RTPS relay.
+    /// </summary>
+    public bool Relay => _relay;
+
+    /// <summary>
+    /// Gets the number of messages sent.
+    /// </summary>
+    public uint SendCount => _sendCount;
+
+    /// <summary>
+    /// Gets the number of bytes sent.
+    /// </summary>
+    public uint SendBytes => _sendBytes;
+
+    /// <summary>
+    /// Gets the number of messages that failed to be sent.
+    /// </summary>
+    public uint SendFailCount => _sendFailCount;
+
+    /// <summary>
+    /// Gets the number of bytes that failed to be sent.
+    /// </summary>
+    public uint SendFailBytes => _sendFailBytes;
+
+    /// <summary>
+    /// Gets the number of messages received.
+    /// </summary>
+    public uint ReceiveCount => _receiveCount;
+
+    /// <summary>
+    /// Gets the number of bytes received.
+    /// </summary>
+    public uint ReceiveBytes => _receiveBytes;
+    #endregion
+}
+
+/// <summary>
+/// Counter of a transport for a single local writer or reader.
+/// </summary>
+/// <remarks>
+/// The <see cref="Guid" /> is the same value used as <see cref="BuiltinTopicKey" /> of the entity in the
+/// publication and subscription built-in topics.
+/// </remarks>
+[StructLayout(LayoutKind.Sequential, Pack = 1)]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the transport statistics.")]
+public struct TransportGuidCount
+{
+    #region Fields
+    private BuiltinTopicKey _guid;
+    private uint _count;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the GUID of the local entity.
+    /// </summary>
+    public BuiltinTopicKey Guid => _guid;
+
+    /// <summary>
+    /// Gets the counter value.
+    /// </summary>
+    public uint Count => _count;
+    #endregion
+}
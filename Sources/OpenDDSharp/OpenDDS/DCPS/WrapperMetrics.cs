@@ -0,0 +1,280 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
+using System.Linq;
+using System.Runtime.InteropServices;
+using System.Security;
+using OpenDDSharp.Helpers;
+
+#if NET7_0_OR_GREATER
+using System.Runtime.CompilerServices;
+#endif
+
+namespace OpenDDSharp.OpenDDS.DCPS;
+
+/// <summary>
+/// Metrics recorded by the generated native wrapper for a single <see cref="DDS.DataWriter" /> or <see cref="DDS.DataReader" />.
+/// </summary>
+/// <remarks>
+/// The metrics are only recorded when the native type support library is compiled with the
+/// <c>OPENDDSHARP_WRAPPER_METRICS</c> option, otherwise the snapshot is always empty.
+/// </remarks>
+public class WrapperMetrics
+{
+    #region Constants
+    private const int HISTOGRAM_BUCKETS = 32;
+    private const int STAGE_VALUES = HISTOGRAM_BUCKETS + 3;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the native pointer of the writer or reader that owns the metrics.
+    /// </summary>
+    public IntPtr Entity { get; }
+
+    /// <summary>
+    /// Gets the metrics of each stage of the wrapper calls.
+    /// </summary>
+    public IReadOnlyDictionary<WrapperMetricsStage, WrapperStageMetrics> Stages { get; }
+
+    /// <summary>
+    /// Gets the native release hooks shared with the generated type support libraries.
+    /// </summary>
+    /// <remarks>
+    /// This property is intended to be used from the generated type support code.
+    /// </remarks>
+    public static IntPtr NativeState => UnsafeNativeMethods.WrapperMetricsGetState();
+    #endregion
+
+    #region Constructors
+    private WrapperMetrics(IntPtr entity, IReadOnlyDictionary<WrapperMetricsStage, WrapperStageMetrics> stages)
+    {
+        Entity = entity;
+        Stages = stages;
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Builds the metrics from the snapshot returned by the generated native wrapper and releases it.
+    /// </summary>
+    /// <remarks>
+    /// This method is intended to be called from the generated type support code.
+    /// </remarks>
+    /// <param name="ptr">The native snapshot.</param>
+    /// <param name="ticksPerMicrosecond">The number of timestamp counter ticks per microsecond.</param>
+    /// <returns>The metrics of each writer and reader of the type.</returns>
+    public static IReadOnlyList<WrapperMetrics> FromNative(IntPtr ptr, double ticksPerMicrosecond)
+    {
+        var result = new List<WrapperMetrics>();
+        if (ptr == IntPtr.Zero)
+        {
+            return result;
+        }
+
+        var stageCount = Enum.GetValues(typeof(WrapperMetricsStage)).Length;
+        var length = Marshal.ReadInt32(ptr);
+        var entitySize = IntPtr.Size + (stageCount * STAGE_VALUES * sizeof(ulong));
+        for (var i = 0; i < length; i++)
+        {
+            var offset = sizeof(int) + (i * entitySize);
+            var entity = Marshal.ReadIntPtr(ptr, offset);
+            offset += IntPtr.Size;
+
+            var stages = new Dictionary<WrapperMetricsStage, WrapperStageMetrics>(stageCount);
+            for (var s = 0; s < stageCount; s++)
+            {
+                var values = new ulong[STAGE_VALUES];
+                for (var v = 0; v < STAGE_VALUES; v++)
+                {
+                    values[v] = (ulong)Marshal.ReadInt64(ptr, offset);
+                    offset += sizeof(ulong);
+                }
+
+                stages.Add((WrapperMetricsStage)s, new WrapperStageMetrics(values, ticksPerMicrosecond));
+            }
+
+            result.Add(new WrapperMetrics(entity, stages));
+        }
+
+        ptr.ReleaseNativePointer();
+
+        return result;
+    }
+
+    /// <summary>
+    /// Releases the metrics of a deleted writer or reader, so an entity created later at the same native address does not inherit them.
+    /// </summary>
+    /// <param name="entity">The native pointer of the deleted writer or reader.</param>
+    internal static void Release(IntPtr entity)
+    {
+        UnsafeNativeMethods.WrapperMetricsRelease(entity);
+    }
+    #endregion
+}
+
+/// <summary>
+/// Stages of the generated wrapper calls.
+/// </summary>
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the wrapper metrics.")]
+public enum WrapperMetricsStage
+{
+    /// <summary>
+    /// Deserialization of the CDR bytes received from .NET.
+    /// </summary>
+    Deserialize = 0,
+
+    /// <summary>
+    /// Serialization of the samples to the CDR bytes returned to .NET.
+    /// </summary>
+    Serialize = 1,
+
+    /// <summary>
+    /// Decoding of the JSON strings received from .NET.
+    /// </summary>
+    JsonDecode = 2,
+
+    /// <summary>
+    /// Encoding of the samples to the JSON strings returned to .NET.
+    /// </summary>
+    JsonEncode = 3,
+
+    /// <summary>
+    /// Allocation and copy of the buffers returned to .NET.
+    /// </summary>
+    Copy = 4,
+
+    /// <summary>
+    /// The OpenDDS call itself.
+    /// </summary>
+    Dds = 5,
+}
+
+/// <summary>
+/// Metrics of a single stage of the generated wrapper calls.
+/// </summary>
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:File may only contain a single type", Justification = "Types only used by the wrapper metrics.")]
+public class WrapperStageMetrics
+{
+    #region Fields
+    private readonly ulong[] _histogram;
+    private readonly double _ticksPerMicrosecond;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the number of times the stage has been executed.
+    /// </summary>
+    public ulong Count { get; }
+
+    /// <summary>
+    /// Gets the total number of bytes processed by the stage.
+    /// </summary>
+    public ulong Bytes { get; }
+
+    /// <summary>
+    /// Gets the total time spent in the stage in microseconds.
+    /// </summary>
+    public double TotalMicroseconds { get; }
+
+    /// <summary>
+    /// Gets the average time spent in the stage in microseconds.
+    /// </summary>
+    public double AverageMicroseconds => Count == 0 ? 0 : TotalMicroseconds / Count;
+
+    /// <summary>
+    /// Gets the latency histogram. The bucket i counts the executions that took between 2^i and 2^(i+1) timestamp ticks.
+    /// </summary>
+    public IReadOnlyList<ulong> Histogram => _histogram;
+    #endregion
+
+    #region Constructors
+    internal WrapperStageMetrics(ulong[] values, double ticksPerMicrosecond)
+    {
+        _ticksPerMicrosecond = ticksPerMicrosecond;
+        Count = values[0];
+        Bytes = values[1];
+        TotalMicroseconds = ticksPerMicrosecond > 0 ? values[2] / ticksPerMicrosecond : 0;
+        _histogram = values.Skip(3).ToArray();
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Gets an upper bound estimation of the given percentile of the stage latency.
+    /// </summary>
+    /// <param name="percentile">The percentile between 0 and 100.</param>
+    /// <returns>The estimated latency in microseconds.</returns>
+    public double GetPercentile(double percentile)
+    {
+        if (Count == 0 || _ticksPerMicrosecond <= 0)
+        {
+            return 0;
+        }
+
+        var target = Math.Ceiling(Count * Math.Min(Math.Max(percentile, 0), 100) / 100.0);
+        ulong accumulated = 0;
+        for (var i = 0; i < _histogram.Length; i++)
+        {
+            accumulated += _histogram[i];
+            if (accumulated >= target)
+            {
+                return Math.Pow(2, i + 1) / _ticksPerMicrosecond;
+            }
+        }
+
+        return Math.Pow(2, _histogram.Length) / _ticksPerMicrosecond;
+    }
+    #endregion
+}
+
+/// <summary>
+/// This class suppresses stack walks for unmanaged code permission.
+/// (System.Security.SuppressUnmanagedCodeSecurityAttribute is applied to this class.)
+/// This class is for methods that are potentially dangerous. Any caller of these methods must perform a full
+/// security review to make sure that the usage is secure because no stack walk will be performed.
+/// </summary>
+[SuppressUnmanagedCodeSecurity]
+[SuppressMessage("StyleCop.CSharp.MaintainabilityRules", "SA1402:FileMayOnlyContainASingleType", Justification = "Native p/invoke calls.")]
+[SuppressMessage("StyleCop.CSharp.DocumentationRules", "SA1601:PartialElementsMustBeDocumented", Justification = "Partial required for the source generator.")]
+internal static partial class UnsafeNativeMethods
+{
+#if NET7_0_OR_GREATER
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "WrapperMetrics_GetState")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr WrapperMetricsGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "WrapperMetrics_Release")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void WrapperMetricsRelease(IntPtr entity);
+#else
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "WrapperMetrics_GetState", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr WrapperMetricsGetState();
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "WrapperMetrics_Release", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void WrapperMetricsRelease(IntPtr entity);
+#endif
+}
@@ -20,8 +20,10 @@ along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 using System;
 using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
+using System.Linq;
 using System.Runtime.InteropServices;
 using System.Security;
+using OpenDDSharp.DDS;
 using OpenDDSharp.Helpers;
 using OpenDDSharp.OpenDDS.DCPS;
 
@@ -291,6 +293,84 @@ public class RtpsDiscovery : Discovery
         UnsafeNativeMethods.SetDefaultMulticastGroup(_native, full);
     }
 
+    /// <summary>
+    /// Adds unicast or multicast addresses to the <see cref="SpdpSendAddrs" /> list.
+    /// </summary>
+    /// <remarks>
+    /// The addresses already configured are kept. Addresses added before creating the participants receive directed SPDP
+    /// announcements as soon as the participants are enabled, so known peers don't need to wait for the multicast
+    /// announcements to be discovered.
+    /// </remarks>
+    /// <param name="addresses">The network addresses (host:port) to be added.</param>
+    public void AddSpdpSendAddrs(IEnumerable<string> addresses)
+    {
+        if (addresses == null)
+        {
+            throw new ArgumentNullException(nameof(addresses));
+        }
+
+        IList<string> list = addresses.Where(a => !string.IsNullOrWhiteSpace(a)).ToList();
+        if (list.Count == 0)
+        {
+            return;
+        }
+
+        var ptr = IntPtr.Zero;
+        var toRelease = list.StringSequenceToPtr(ref ptr, false);
+        toRelease.Add(ptr);
+
+        try
+        {
+            UnsafeNativeMethods.AddSpdpSendAddrs(_native, ptr);
+        }
+        finally
+        {
+            foreach (var p in toRelease)
+            {
+                Marshal.FreeHGlobal(p);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Gets the SPDP unicast locators of the remote participants currently discovered by a <see cref="DomainParticipant" />.
+    /// </summary>
+    /// <remarks>
+    /// The locators are read from the OpenDDS participant location built-in topic, the samples are not taken.
+    /// </remarks>
+    /// <param name="participant">The local <see cref="DomainParticipant" />.</param>
+    /// <returns>The network addresses (host:port) of the discovered participants.</returns>
+    public static IList<string> GetParticipantLocators(DomainParticipant participant)
+    {
+        if (participant == null)
+        {
+            throw new ArgumentNullException(nameof(participant));
+        }
+
+        IList<string> locators = new List<string>();
+        UnsafeNativeMethods.GetParticipantLocators(participant.ToNative()).PtrToStringSequence(ref locators, false);
+
+        return locators;
+    }
+
+    /// <summary>
+    /// Enables the discovery warm-start cache persisted in the provided file.
+    /// </summary>
+    /// <remarks>
+    /// <para>The locators stored in the file are added to the <see cref="SpdpSendAddrs" /> so the participants created afterwards
+    /// announce themselves directly to the peers known in a previous run, reducing the time to the first match after a restart.</para>
+    /// <para>Use <see cref="RtpsWarmStartCache.Track" /> to persist the participants discovered during this run.</para>
+    /// </remarks>
+    /// <param name="fileName">The cache file path.</param>
+    /// <returns>The warm-start cache, it must be disposed to stop the persistence.</returns>
+    public RtpsWarmStartCache EnableWarmStartCache(string fileName)
+    {
+        var cache = new RtpsWarmStartCache(this, fileName);
+        cache.Load();
+
+        return cache;
+    }
+
     private TimeValue GetResendPeriod()
     {
         return UnsafeNativeMethods.GetResendPeriod(_native);
@@ -610,6 +690,16 @@ internal static partial class UnsafeNativeMethods
     [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_SetGuidInterface", StringMarshalling = StringMarshalling.Utf8)]
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
     public static partial void SetGuidInterface(IntPtr ird, string ip);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_AddSpdpSendAddrs")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial void AddSpdpSendAddrs(IntPtr ird, IntPtr addrs);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_GetParticipantLocators")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    public static partial IntPtr GetParticipantLocators(IntPtr dp);
 #else
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_NarrowBase", CallingConvention = CallingConvention.Cdecl)]
@@ -736,6 +826,14 @@ internal static partial class UnsafeNativeMethods
     [SuppressUnmanagedCodeSecurity]
     [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_SetGuidInterface", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, BestFitMapping = false, ThrowOnUnmappableChar = true)]
     public static extern void SetGuidInterface(IntPtr ird, string ip);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_AddSpdpSendAddrs", CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AddSpdpSendAddrs(IntPtr ird, IntPtr addrs);
+
+    [SuppressUnmanagedCodeSecurity]
+    [DllImport(MarshalHelper.API_DLL, EntryPoint = "RtpsDiscovery_GetParticipantLocators", CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr GetParticipantLocators(IntPtr dp);
 #endif
 }
 #endregion
\ No newline at end of file
@@ -0,0 +1,276 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using OpenDDSharp.DDS;
+
+namespace OpenDDSharp.OpenDDS.RTPS;
+
+/// <summary>
+/// Persists the locators of the discovered participants so a restarted process can announce itself directly
+/// to the peers known in a previous run.
+/// </summary>
+/// <remarks>
+/// The cache file contains one network address (host:port) per line. The cache is written to a temporary file that replaces
+/// the previous one, so a process killed while saving never leaves a truncated cache.
+/// </remarks>
+public sealed class RtpsWarmStartCache : IDisposable
+{
+    #region Fields
+    private readonly object _lock = new object();
+    private readonly RtpsDiscovery _discovery;
+    private readonly List<DomainParticipant> _participants = new List<DomainParticipant>();
+    private readonly HashSet<string> _locators = new HashSet<string>(StringComparer.Ordinal);
+    private Timer _timer;
+    private bool _disposed;
+    #endregion
+
+    #region Properties
+    /// <summary>
+    /// Gets the cache file path.
+    /// </summary>
+    public string FileName { get; }
+
+    /// <summary>
+    /// Gets or sets the maximum number of locators kept in the cache. The default value is 256.
+    /// </summary>
+    /// <remarks>
+    /// When the limit is reached, the locators that are not currently discovered are dropped first.
+    /// </remarks>
+    public int MaxLocators { get; set; } = 256;
+
+    /// <summary>
+    /// Gets the locators currently known by the cache.
+    /// </summary>
+    public IReadOnlyCollection<string> Locators
+    {
+        get
+        {
+            lock (_lock)
+            {
+                return _locators.ToList();
+            }
+        }
+    }
+    #endregion
+
+    #region Constructors
+    /// <summary>
+    /// Initializes a new instance of the <see cref="RtpsWarmStartCache"/> class.
+    /// </summary>
+    /// <param name="discovery">The <see cref="RtpsDiscovery" /> that uses the cached locators.</param>
+    /// <param name="fileName">The cache file path.</param>
+    public RtpsWarmStartCache(RtpsDiscovery discovery, string fileName)
+    {
+        if (string.IsNullOrWhiteSpace(fileName))
+        {
+            throw new ArgumentNullException(nameof(fileName));
+        }
+
+        _discovery = discovery ?? throw new ArgumentNullException(nameof(discovery));
+        FileName = fileName;
+    }
+    #endregion
+
+    #region Methods
+    /// <summary>
+    /// Loads the cache file and adds the stored locators to the <see cref="RtpsDiscovery.SpdpSendAddrs" />.
+    /// </summary>
+    /// <remarks>
+    /// It must be called before creating the participants that use the discovery. A missing or unreadable cache file is
+    /// not an error, the discovery just starts cold.
+    /// </remarks>
+    /// <returns>The number of locators loaded.</returns>
+    public int Load()
+    {
+        IList<string> loaded;
+        try
+        {
+            if (!File.Exists(FileName))
+            {
+                return 0;
+            }
+
+            loaded = File.ReadAllLines(FileName)
+                .Select(l => l.Trim())
+                .Where(l => l.Length > 0 && !l.StartsWith("#", StringComparison.Ordinal))
+                .Take(MaxLocators)
+                .ToList();
+        }
+        catch (IOException)
+        {
+            return 0;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return 0;
+        }
+
+        lock (_lock)
+        {
+            foreach (var locator in loaded)
+            {
+                _locators.Add(locator);
+            }
+        }
+
+        _discovery.AddSpdpSendAddrs(loaded);
+
+        return loaded.Count;
+    }
+
+    /// <summary>
+    /// Starts tracking the participants discovered by a <see cref="DomainParticipant" /> and persisting them periodically.
+    /// </summary>
+    /// <param name="participant">The local <see cref="DomainParticipant" />.</param>
+    /// <param name="period">The period between saves.</param>
+    public void Track(DomainParticipant participant, TimeSpan period)
+    {
+        if (participant == null)
+        {
+            throw new ArgumentNullException(nameof(participant));
+        }
+
+        if (period <= TimeSpan.Zero)
+        {
+            throw new ArgumentOutOfRangeException(nameof(period));
+        }
+
+        lock (_lock)
+        {
+            if (_disposed)
+            {
+                throw new ObjectDisposedException(nameof(RtpsWarmStartCache));
+            }
+
+            if (!_participants.Contains(participant))
+            {
+                _participants.Add(participant);
+            }
+
+            if (_timer == null)
+            {
+                _timer = new Timer(_ => Save(), null, period, period);
+            }
+            else
+            {
+                _timer.Change(period, period);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Stops tracking a <see cref="DomainParticipant" />. It must be called before deleting the participant.
+    /// </summary>
+    /// <param name="participant">The local <see cref="DomainParticipant" />.</param>
+    public void Untrack(DomainParticipant participant)
+    {
+        Save();
+
+        lock (_lock)
+        {
+            _participants.Remove(participant);
+        }
+    }
+
+    /// <summary>
+    /// Saves the locators of the discovered participants to the cache file.
+    /// </summary>
+    /// <returns><see langword="true" /> if the cache file has been written, otherwise <see langword="false" />.</returns>
+    public bool Save()
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+            {
+                return false;
+            }
+
+            var current = new HashSet<string>(StringComparer.Ordinal);
+            foreach (var participant in _participants)
+            {
+                foreach (var locator in RtpsDiscovery.GetParticipantLocators(participant))
+                {
+                    current.Add(locator);
+                }
+            }
+
+            // Keep the previous locators as well, a peer that is restarting at the same time must still be reachable.
+            var all = current.Concat(_locators.Where(l => !current.Contains(l))).Take(MaxLocators).ToList();
+            _locators.Clear();
+            _locators.UnionWith(all);
+
+            var temp = FileName + ".tmp";
+            try
+            {
+                File.WriteAllLines(temp, all);
+                if (File.Exists(FileName))
+                {
+                    File.Replace(temp, FileName, null);
+                }
+                else
+                {
+                    File.Move(temp, FileName);
+                }
+            }
+            catch (IOException)
+            {
+                return false;
+            }
+            catch (UnauthorizedAccessException)
+            {
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    /// <summary>
+    /// Stops the periodic persistence and saves the cache a last time.
+    /// </summary>
+    public void Dispose()
+    {
+        Timer timer;
+        lock (_lock)
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            timer = _timer;
+            _timer = null;
+        }
+
+        timer?.Dispose();
+        Save();
+
+        lock (_lock)
+        {
+            _participants.Clear();
+            _disposed = true;
+        }
+    }
+    #endregion
+}
@@ -2,6 +2,7 @@ using System.Diagnostics.CodeAnalysis;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Security;
+using OpenDDSharp.BenchmarkPerformance.PerformanceTests;
 
 namespace OpenDDSharp.BenchmarkPerformance.Helpers;
 
@@ -45,9 +46,19 @@ internal static partial class UnsafeNativeMethods
     internal static partial void LatencyFinalize(IntPtr test);
 
     [SuppressUnmanagedCodeSecurity]
-    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "latency_get_latencies")]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "latency_set_rate")]
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
-    internal static partial IntPtr LatencyGetLatencies(IntPtr test);
+    internal static partial void LatencySetRate(IntPtr test, double samplesPerSecond);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "latency_get_histogram")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr LatencyGetHistogram(IntPtr test, [MarshalAs(UnmanagedType.U1)] bool corrected);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "latency_get_summary")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void LatencyGetSummary(IntPtr test, [MarshalAs(UnmanagedType.U1)] bool corrected, out LatencySummary summary);
 
     [SuppressUnmanagedCodeSecurity]
     [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "throughput_initialize")]
@@ -64,6 +75,234 @@ internal static partial class UnsafeNativeMethods
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
     internal static partial void ThroughputFinalize(IntPtr c);
 
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sweep_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr SweepInitialize(ulong payloadSize, int throughputSamples, int latencySamples);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sweep_add_values")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SweepAddValues(IntPtr sweep, int parameter, long[] values, int count);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sweep_run")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial uint SweepRun(IntPtr sweep);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sweep_report")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SweepReport(IntPtr sweep);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sweep_get_results")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr SweepGetResults(IntPtr sweep);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sweep_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SweepFinalize(IntPtr sweep);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "scaling_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr ScalingInitialize(int writers, int readers, int topics, int instances, int samplesPerWriter,
+        ulong payloadSize, [MarshalAs(UnmanagedType.U1)] bool reliable, [MarshalAs(UnmanagedType.U1)] bool pinThreads, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "scaling_run")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ScalingRun(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "scaling_get_result")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ScalingGetResult(IntPtr test, out ScalingResult result);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "scaling_get_readers")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr ScalingGetReaders(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "scaling_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ScalingFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "instance_scaling_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr InstanceScalingInitialize(int totalInstances, int samplesPerInstance, ulong payloadSize,
+        [MarshalAs(UnmanagedType.U1)] bool keepAll, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "instance_scaling_run")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void InstanceScalingRun(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "instance_scaling_get_result")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void InstanceScalingGetResult(IntPtr test, out InstanceScalingResult result);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "instance_scaling_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void InstanceScalingFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "wrapper_overhead_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr WrapperOverheadInitialize(int totalSamples, ulong payloadSize, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "wrapper_overhead_run")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void WrapperOverheadRun(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "wrapper_overhead_get_results")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr WrapperOverheadGetResults(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "wrapper_overhead_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void WrapperOverheadFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_initialize", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr SplitInitialize([MarshalAs(UnmanagedType.U1)] bool driver, string topicPrefix, ulong payloadSize, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_run_latency")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SplitRunLatency(IntPtr test, int totalSamples);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_get_latencies")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr SplitGetLatencies(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_get_round_trips")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr SplitGetRoundTrips(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_run_throughput")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial uint SplitRunThroughput(IntPtr test, int totalSamples);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_run_peer")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SplitRunPeer(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "split_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SplitFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "discovery_initialize", StringMarshalling = StringMarshalling.Utf8)]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr DiscoveryInitialize(int domainId, int role, int participants, int endpointsPerParticipant, int timeoutMs,
+        string topicPrefix);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "discovery_start")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void DiscoveryStart(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "discovery_wait")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void DiscoveryWait(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "discovery_get_result")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void DiscoveryGetResult(IntPtr test, out DiscoveryResult result);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "discovery_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void DiscoveryFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "shape_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr ShapeInitialize(int shape, ulong payloadSize, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "shape_run_throughput")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial uint ShapeRunThroughput(IntPtr test, int totalSamples);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "shape_run_latency")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ShapeRunLatency(IntPtr test, int totalSamples);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "shape_get_latencies")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr ShapeGetLatencies(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "shape_get_sample_size")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial ulong ShapeGetSampleSize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "shape_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ShapeFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "receive_strategy_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr ReceiveStrategyInitialize(int strategy, ulong payloadSize, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "receive_strategy_run")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ReceiveStrategyRun(IntPtr test, int totalSamples, double samplesPerSecond);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "receive_strategy_get_result")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ReceiveStrategyGetResult(IntPtr test, out ReceiveStrategyResult result);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "receive_strategy_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void ReceiveStrategyFinalize(IntPtr test);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sustained_rate_initialize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial IntPtr SustainedRateInitialize(in SustainedRateConfig config, ulong payloadSize, IntPtr participant);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sustained_rate_run")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SustainedRateRun(IntPtr test, int totalSamples, double samplesPerSecond);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sustained_rate_get_result")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SustainedRateGetResult(IntPtr test, out SustainedRateResult result);
+
+    [SuppressUnmanagedCodeSecurity]
+    [LibraryImport(TEST_LIBRARY_NAME, EntryPoint = "sustained_rate_finalize")]
+    [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+    internal static partial void SustainedRateFinalize(IntPtr test);
+
     [LibraryImport("kernel32.dll", SetLastError = true)]
     [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
     [return: MarshalAs(UnmanagedType.U1)]
@@ -0,0 +1,336 @@
+using System.Diagnostics;
+using System.Globalization;
+using OpenDDSharp.DDS;
+using CdrWrapper;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Throughput and latency of one topic type shape through the OpenDDSharp CDR wrapper.
+/// The samples are filled like the native <c>ShapeTest</c> does, so both paths serialize the same bytes.
+/// </summary>
+internal sealed class CDRShapeTest : IDisposable
+{
+    private const int CONFIG_ENTRIES_PER_SECTION = 8;
+    private const ulong CONFIG_SECTION_SIZE = 600;
+
+    private readonly DomainParticipant _participant;
+
+    private Func<ReturnCode> _write;
+    private Func<int> _take;
+
+    private Topic _topic;
+    private Publisher _publisher;
+    private DataWriter _dataWriter;
+    private Subscriber _subscriber;
+    private DataReader _dataReader;
+    private StatusCondition _statusCondition;
+    private WaitSet _waitSet;
+
+    public CDRShapeTest(TypeShape shape, ulong totalPayload, DomainParticipant participant)
+    {
+        _participant = participant;
+
+        switch (shape)
+        {
+            case TypeShape.KeyedOctets:
+                InitializeDDSEntities(new KeyedOctetsTypeSupport(), CreateKeyedOctets(totalPayload),
+                    dw => new KeyedOctetsDataWriter(dw), dr => new KeyedOctetsDataReader(dr),
+                    (w, s) => w.Write(s), (r, s, i) => r.Take(s, i));
+                break;
+            case TypeShape.MarketTick:
+                InitializeDDSEntities(new MarketTickTypeSupport(), CreateMarketTick(),
+                    dw => new MarketTickDataWriter(dw), dr => new MarketTickDataReader(dr),
+                    (w, s) => w.Write(s), (r, s, i) => r.Take(s, i));
+                break;
+            case TypeShape.TelemetryFrame:
+                InitializeDDSEntities(new TelemetryFrameTypeSupport(), CreateTelemetryFrame(totalPayload),
+                    dw => new TelemetryFrameDataWriter(dw), dr => new TelemetryFrameDataReader(dr),
+                    (w, s) => w.Write(s), (r, s, i) => r.Take(s, i));
+                break;
+            case TypeShape.ConfigRecord:
+                InitializeDDSEntities(new ConfigRecordTypeSupport(), CreateConfigRecord(totalPayload),
+                    dw => new ConfigRecordDataWriter(dw), dr => new ConfigRecordDataReader(dr),
+                    (w, s) => w.Write(s), (r, s, i) => r.Take(s, i));
+                break;
+            default:
+                throw new ArgumentOutOfRangeException(nameof(shape), shape, "Unknown type shape.");
+        }
+    }
+
+    public ulong RunThroughput(int totalSamples)
+    {
+        var pubThread = new Thread(_ =>
+        {
+            for (var i = 1; i <= totalSamples; i++)
+            {
+                _write();
+            }
+        });
+        pubThread.Start();
+
+        ulong received = 0;
+        while (received < (ulong)totalSamples && WaitSamples())
+        {
+            received += (ulong)_take();
+        }
+
+        pubThread.Join();
+
+        return received;
+    }
+
+    public IList<TimeSpan> RunLatency(int totalSamples)
+    {
+        var latencies = new List<TimeSpan>(totalSamples);
+        var stopwatch = new Stopwatch();
+
+        for (var i = 1; i <= totalSamples; i++)
+        {
+            stopwatch.Restart();
+            var result = _write();
+            if (result != ReturnCode.Ok)
+            {
+                throw new InvalidOperationException($"Error writing sample: {result}");
+            }
+
+            var taken = 0;
+            while (taken == 0)
+            {
+                if (!WaitSamples())
+                {
+                    throw new TimeoutException("Timeout waiting for samples.");
+                }
+
+                taken = _take();
+            }
+
+            latencies.Add(stopwatch.Elapsed);
+        }
+
+        return latencies;
+    }
+
+    private bool WaitSamples()
+    {
+        var conditions = new List<Condition>();
+        return _waitSet.Wait(conditions, new Duration { Seconds = 10, NanoSeconds = 0 }) == ReturnCode.Ok;
+    }
+
+    private void InitializeDDSEntities<T, TWriter, TReader>(ITypeSupport<T> typeSupport, T sample,
+        Func<DataWriter, TWriter> createWriter, Func<DataReader, TReader> createReader,
+        Func<TWriter, T, ReturnCode> write, Func<TReader, List<T>, List<SampleInfo>, ReturnCode> take)
+        where TWriter : DataWriter
+        where TReader : DataReader
+    {
+        var typeName = typeSupport.GetTypeName();
+        typeSupport.RegisterType(_participant, typeName);
+
+        var topicQos = new TopicQos
+        {
+            Reliability = { Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos },
+            History = { Kind = HistoryQosPolicyKind.KeepAllHistoryQos },
+        };
+        _topic = _participant.CreateTopic(Guid.NewGuid().ToString(), typeName, topicQos);
+
+        var pubQos = new PublisherQos
+        {
+            EntityFactory = { AutoenableCreatedEntities = false },
+        };
+        pubQos.Partition.Name.Add($"/CDRShape/{Environment.MachineName}/{Environment.ProcessId}");
+
+        _publisher = _participant.CreatePublisher(pubQos);
+
+        var dwQos = new DataWriterQos
+        {
+            Reliability =
+            {
+                Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                MaxBlockingTime = new Duration
+                {
+                    Seconds = Duration.InfiniteSeconds,
+                    NanoSeconds = Duration.InfiniteNanoSeconds,
+                },
+            },
+            History = { Kind = HistoryQosPolicyKind.KeepAllHistoryQos },
+        };
+        var dataWriter = createWriter(_publisher.CreateDataWriter(_topic, dwQos));
+        _dataWriter = dataWriter;
+
+        var subQos = new SubscriberQos
+        {
+            EntityFactory = { AutoenableCreatedEntities = false },
+        };
+        subQos.Partition.Name.Add($"/CDRShape/{Environment.MachineName}/{Environment.ProcessId}");
+
+        _subscriber = _participant.CreateSubscriber(subQos);
+
+        var drQos = new DataReaderQos
+        {
+            Reliability =
+            {
+                Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                MaxBlockingTime = new Duration
+                {
+                    Seconds = Duration.InfiniteSeconds,
+                    NanoSeconds = Duration.InfiniteNanoSeconds,
+                },
+            },
+            History = { Kind = HistoryQosPolicyKind.KeepAllHistoryQos },
+        };
+        var dataReader = createReader(_subscriber.CreateDataReader(_topic, drQos));
+        _dataReader = dataReader;
+
+        _write = () => write(dataWriter, sample);
+        _take = () =>
+        {
+            var samples = new List<T>();
+            var sampleInfos = new List<SampleInfo>();
+            return take(dataReader, samples, sampleInfos) == ReturnCode.Ok ? samples.Count : 0;
+        };
+
+        _waitSet = new WaitSet();
+        _statusCondition = _dataReader.StatusCondition;
+        _statusCondition.EnabledStatuses = StatusKind.DataAvailableStatus;
+        _waitSet.AttachCondition(_statusCondition);
+
+        _dataWriter.Enable();
+        _dataReader.Enable();
+
+        if (!_dataReader.WaitForPublications(1, 5_000))
+        {
+            throw new InvalidOperationException("Error waiting for publications.");
+        }
+
+        if (!_dataWriter.WaitForSubscriptions(1, 5_000))
+        {
+            throw new InvalidOperationException("Error waiting for subscriptions.");
+        }
+    }
+
+    private static KeyedOctets CreateKeyedOctets(ulong totalPayload)
+    {
+        var payload = new byte[totalPayload];
+        Random.Shared.NextBytes(payload);
+
+        return new KeyedOctets
+        {
+            KeyField = "1",
+            ValueField = payload,
+        };
+    }
+
+    private static MarketTick CreateMarketTick()
+    {
+        return new MarketTick
+        {
+            Symbol = "EURUSD",
+            Venue = 1,
+            Side = TickSide.TICK_TRADE,
+            Price = 1.08425,
+            Quantity = 1_000_000.0,
+            ExchangeTimestamp = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() * 1_000_000,
+            SequenceNumber = 1,
+            Currency = "USD",
+        };
+    }
+
+    private static TelemetryFrame CreateTelemetryFrame(ulong totalPayload)
+    {
+        var channels = new TelemetryChannel[16];
+        for (var i = 0; i < channels.Length; i++)
+        {
+            channels[i] = new TelemetryChannel
+            {
+                Id = (ushort)i,
+                Value = i * 1.5f,
+                Minimum = -100.0f,
+                Maximum = 100.0f,
+                Valid = true,
+            };
+        }
+
+        var count = (int)(totalPayload / sizeof(float));
+        var samples = new List<float>(count);
+        for (var i = 0; i < count; i++)
+        {
+            samples.Add(i % 1_000 * 0.25f);
+        }
+
+        return new TelemetryFrame
+        {
+            DeviceId = 1,
+            Stream = 1,
+            Timestamp = (ulong)DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() * 1_000_000,
+            Channels = channels,
+            Samples = samples,
+        };
+    }
+
+    private static ConfigRecord CreateConfigRecord(ulong totalPayload)
+    {
+        var sections = new List<ConfigSection>();
+        var count = Math.Max(totalPayload / CONFIG_SECTION_SIZE, 1);
+        for (ulong s = 0; s < count; s++)
+        {
+            var entries = new List<ConfigEntry>(CONFIG_ENTRIES_PER_SECTION);
+            for (var e = 0; e < CONFIG_ENTRIES_PER_SECTION; e++)
+            {
+                entries.Add(new ConfigEntry
+                {
+                    Name = RandomString(16),
+                    Kind = (ConfigValueKind)(e % 3),
+                    Value = RandomString(32),
+                });
+            }
+
+            sections.Add(new ConfigSection
+            {
+                Name = "section_" + s.ToString(CultureInfo.InvariantCulture),
+                Owner = new ConfigOwner
+                {
+                    Team = "platform",
+                    Contact = "platform-oncall@example.com",
+                },
+                Entries = entries,
+            });
+        }
+
+        return new ConfigRecord
+        {
+            Application = "order-gateway",
+            Deployment = "production",
+            Revision = 1,
+            Tags = new List<string> { "trading", "eu-west", "critical", "v2" },
+            Sections = sections,
+        };
+    }
+
+    private static string RandomString(int length)
+    {
+        const string CHARACTERS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+        return string.Create(length, CHARACTERS, (span, characters) =>
+        {
+            for (var i = 0; i < span.Length; i++)
+            {
+                span[i] = characters[Random.Shared.Next(characters.Length)];
+            }
+        });
+    }
+
+    public void Dispose()
+    {
+        _publisher.DeleteDataWriter(_dataWriter);
+        _publisher.DeleteContainedEntities();
+        _participant.DeletePublisher(_publisher);
+
+        _waitSet.DetachCondition(_statusCondition);
+        _dataReader.DeleteContainedEntities();
+        _subscriber.DeleteDataReader(_dataReader);
+        _subscriber.DeleteContainedEntities();
+        _participant.DeleteSubscriber(_subscriber);
+
+        _participant.DeleteTopic(_topic);
+    }
+}
@@ -0,0 +1,230 @@
+using System.Diagnostics;
+using System.Globalization;
+using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.OpenDDS.RTPS;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Time to match and time to first sample with a growing number of participants, with RTPS discovery at several
+/// resend periods and with InfoRepo discovery, in a single process and split between two processes.
+/// </summary>
+/// <remarks>
+/// Every point runs in a new domain, so the participants of the previous points are not part of the discovery.
+/// In the multi-process mode the writers live in a child process started with the <c>--discovery-peer</c> argument
+/// and the readers are created once the peer is ready, so the numbers are those of late joining readers.
+/// The InfoRepo scenario only runs when the DCPSInfoRepo executable is found in <c>$DDS_ROOT/bin</c>.
+/// </remarks>
+internal static class DiscoveryTest
+{
+    internal const string RTPS = "rtps";
+    internal const string INFOREPO = "inforepo";
+    private const string INFOREPO_IOR = "corbaloc::localhost:12345/DCPSInfoRepo";
+    private const string READY = "READY";
+    private const int FIRST_DOMAIN_ID = 100;
+    private const int TIMEOUT_MS = 60_000;
+    private static readonly int[] RESEND_PERIODS_MS = [1_000, 5_000, 30_000];
+
+    private static readonly HashSet<string> _discoveries = [];
+    private static int _nextDomainId = FIRST_DOMAIN_ID;
+
+    public static void Run(int maxParticipants, int endpointsPerParticipant, string historyFile)
+    {
+        Console.WriteLine($"Discovery test, up to {maxParticipants} participants, {endpointsPerParticipant} topics per participant.");
+        Console.WriteLine($"{"Mode",-8}{"Discovery",-14}{"Parts",7}{"Setup ms",11}{"First ms",11}{"Match p50",11}{"Match ms",11}" +
+                          $"{"Sample p50",12}{"Sample ms",11}{"Matched",12}{"With data",12}");
+
+        var date = DateTime.UtcNow.ToString("o", CultureInfo.InvariantCulture);
+        var lines = new List<string>();
+        if (!File.Exists(historyFile))
+        {
+            lines.Add("date,mode,discovery,resend_ms,participants,endpoints_per_participant,setup_ms,first_match_ms," +
+                      "full_match_p50_ms,full_match_ms,first_sample_p50_ms,first_sample_ms,endpoints,endpoints_matched,readers,readers_with_data");
+        }
+
+        var scenarios = RESEND_PERIODS_MS.Select(p => (Discovery: RTPS, ResendMs: p)).ToList();
+        using var infoRepo = StartInfoRepo();
+        if (infoRepo != null)
+        {
+            scenarios.Add((INFOREPO, 0));
+        }
+        else
+        {
+            Console.WriteLine("DCPSInfoRepo not found in $DDS_ROOT/bin, the InfoRepo scenario is skipped.");
+        }
+
+        foreach (var (discovery, resendMs) in scenarios)
+        {
+            var name = discovery == INFOREPO ? "InfoRepo" : $"RTPS {resendMs / 1_000}s";
+            foreach (var multiProcess in new[] { false, true })
+            {
+                var mode = multiProcess ? "Multi" : "Single";
+                for (var participants = 1; participants <= maxParticipants; participants *= 2)
+                {
+                    var result = multiProcess
+                        ? RunMultiProcess(discovery, resendMs, participants, endpointsPerParticipant)
+                        : RunSingleProcess(discovery, resendMs, participants, endpointsPerParticipant);
+                    if (result is not { } r)
+                    {
+                        Console.WriteLine($"{mode,-8}{name,-14}{participants,7}  the peer process did not start.");
+                        continue;
+                    }
+
+                    Console.WriteLine($"{mode,-8}{name,-14}{participants,7}{r.SetupMilliseconds,11:F1}{r.FirstMatchMilliseconds,11:F1}" +
+                                      $"{r.FullMatchFiftyMilliseconds,11:F1}{r.FullMatchMilliseconds,11:F1}{r.FirstSampleFiftyMilliseconds,12:F1}" +
+                                      $"{r.FirstSampleMilliseconds,11:F1}{$"{r.EndpointsMatched}/{r.Endpoints}",12}{$"{r.ReadersWithData}/{r.Readers}",12}");
+
+                    lines.Add(string.Create(CultureInfo.InvariantCulture,
+                        $"{date},{mode},{discovery},{resendMs},{participants},{endpointsPerParticipant},{r.SetupMilliseconds:F3}," +
+                        $"{r.FirstMatchMilliseconds:F3},{r.FullMatchFiftyMilliseconds:F3},{r.FullMatchMilliseconds:F3}," +
+                        $"{r.FirstSampleFiftyMilliseconds:F3},{r.FirstSampleMilliseconds:F3},{r.Endpoints},{r.EndpointsMatched}," +
+                        $"{r.Readers},{r.ReadersWithData}"));
+                }
+            }
+        }
+
+        if (infoRepo is { HasExited: false })
+        {
+            infoRepo.Kill();
+            infoRepo.WaitForExit();
+        }
+
+        Directory.CreateDirectory(Path.GetDirectoryName(historyFile)!);
+        File.AppendAllLines(historyFile, lines);
+        Console.WriteLine($"Results appended to {historyFile}.");
+    }
+
+    public static void RunPeer(string discovery, int resendMs, int domainId, int participants, int endpointsPerParticipant, int timeoutMs, string topicPrefix)
+    {
+        Configure(discovery, resendMs, domainId);
+
+        using var test = new OpenDDSDiscoveryTest(domainId, DiscoveryRole.Writers, participants, endpointsPerParticipant, timeoutMs, topicPrefix);
+        test.Start();
+        Console.WriteLine(READY);
+        test.Wait();
+    }
+
+    private static DiscoveryResult RunSingleProcess(string discovery, int resendMs, int participants, int endpointsPerParticipant)
+    {
+        var domainId = _nextDomainId++;
+        Configure(discovery, resendMs, domainId);
+
+        using var test = new OpenDDSDiscoveryTest(domainId, DiscoveryRole.All, participants, endpointsPerParticipant, TIMEOUT_MS, NewPrefix());
+        test.Start();
+        test.Wait();
+        return test.Result;
+    }
+
+    private static DiscoveryResult? RunMultiProcess(string discovery, int resendMs, int participants, int endpointsPerParticipant)
+    {
+        var domainId = _nextDomainId++;
+        var prefix = NewPrefix();
+        Configure(discovery, resendMs, domainId);
+
+        using var ready = new ManualResetEventSlim();
+        using var peer = Process.Start(new ProcessStartInfo
+        {
+            FileName = Environment.ProcessPath!,
+            Arguments = string.Create(CultureInfo.InvariantCulture,
+                $"--discovery-peer {discovery} {resendMs} {domainId} {participants} {endpointsPerParticipant} {TIMEOUT_MS * 2} {prefix}"),
+            UseShellExecute = false,
+            RedirectStandardOutput = true,
+        })!;
+        peer.OutputDataReceived += (_, e) =>
+        {
+            if (e.Data == READY)
+            {
+                ready.Set();
+            }
+        };
+        peer.BeginOutputReadLine();
+
+        if (!ready.Wait(TIMEOUT_MS))
+        {
+            peer.Kill();
+            return null;
+        }
+
+        DiscoveryResult result;
+        using (var test = new OpenDDSDiscoveryTest(domainId, DiscoveryRole.Readers, participants, endpointsPerParticipant, TIMEOUT_MS, prefix))
+        {
+            test.Start();
+            test.Wait();
+            result = test.Result;
+        }
+
+        // The peer returns once its writers are unmatched.
+        if (!peer.WaitForExit(TIMEOUT_MS))
+        {
+            peer.Kill();
+        }
+
+        return result;
+    }
+
+    private static void Configure(string discovery, int resendMs, int domainId)
+    {
+        var key = discovery == INFOREPO ? "DiscoveryTest_InfoRepo" : $"DiscoveryTest_Rtps_{resendMs}";
+        if (_discoveries.Add(key))
+        {
+            if (discovery == INFOREPO)
+            {
+                ParticipantService.Instance.AddDiscovery(new InfoRepoDiscovery(key, INFOREPO_IOR)
+                {
+                    BitTransportIp = "localhost",
+                    BitTransportPort = 0,
+                });
+            }
+            else
+            {
+                ParticipantService.Instance.AddDiscovery(new RtpsDiscovery(key)
+                {
+                    ResendPeriod = new TimeValue
+                    {
+                        Seconds = resendMs / 1_000,
+                        MicroSeconds = resendMs % 1_000 * 1_000,
+                    },
+                });
+            }
+        }
+
+        ParticipantService.Instance.SetRepoDomain(domainId, key);
+        _ = ParticipantService.Instance.GetDomainParticipantFactory();
+    }
+
+    private static Process StartInfoRepo()
+    {
+        var ddsRoot = Environment.GetEnvironmentVariable("DDS_ROOT");
+        if (string.IsNullOrEmpty(ddsRoot))
+        {
+            return null;
+        }
+
+        var path = Path.Combine(ddsRoot, "bin", OperatingSystem.IsWindows() ? "DCPSInfoRepo.exe" : "DCPSInfoRepo");
+        if (!File.Exists(path))
+        {
+            return null;
+        }
+
+        var infoRepo = Process.Start(new ProcessStartInfo
+        {
+            FileName = path,
+            Arguments = "-o repo.ior -ORBListenEndpoints iiop://localhost:12345",
+            UseShellExecute = false,
+            RedirectStandardOutput = true,
+            RedirectStandardError = true,
+        })!;
+        infoRepo.BeginOutputReadLine();
+        infoRepo.BeginErrorReadLine();
+
+        // Give the repository the time to open its endpoint.
+        Thread.Sleep(1_000);
+
+        return infoRepo;
+    }
+
+    private static string NewPrefix()
+    {
+        return "Discovery_" + Guid.NewGuid().ToString("N", CultureInfo.InvariantCulture);
+    }
+}
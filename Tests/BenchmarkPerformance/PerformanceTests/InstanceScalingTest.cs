@@ -0,0 +1,47 @@
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Register, write, lookup, take and dispose throughput and memory per instance, with the instance count growing by
+/// decades, over RTPS/UDP loopback with KEEP_LAST 1 and KEEP_ALL histories.
+/// </summary>
+/// <remarks>
+/// Each point runs in a new participant. The memory is the resident set growth of the whole process, writer and
+/// reader caches included, so the small counts are dominated by the allocator and only the trend is meaningful.
+/// </remarks>
+internal static class InstanceScalingTest
+{
+    public static void Run(ulong totalPayload, int maxInstances, int samplesPerInstance)
+    {
+        Console.WriteLine($"Instance scaling test, payload {totalPayload} bytes, {samplesPerInstance} samples per instance.");
+        Console.WriteLine($"{"Instances",-11}{"History",-11}{"Taken",11}{"Register/s",13}{"Write/s",13}{"Lookup/s",13}" +
+                          $"{"Take/s",13}{"Dispose/s",13}{"Bytes/inst",12}");
+
+        foreach (var keepAll in new[] { false, true })
+        {
+            for (var instances = 1; instances <= maxInstances; instances *= 10)
+            {
+                var participant = SameHostTest.Setup(SameHostTest.RTPS_UDP);
+
+                InstanceScalingResult result;
+                using (var test = new OpenDDSInstanceScalingTest(instances, samplesPerInstance, totalPayload, keepAll, participant))
+                {
+                    test.Run();
+                    result = test.Result;
+                }
+
+                UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+                Console.WriteLine($"{instances,-11}{(keepAll ? "KEEP_ALL" : "KEEP_LAST"),-11}{result.SamplesTaken,11}" +
+                                  $"{result.RegisterPerSecond,13:F0}{result.WritePerSecond,13:F0}{result.LookupPerSecond,13:F0}" +
+                                  $"{result.TakePerSecond,13:F0}{result.DisposePerSecond,13:F0}{result.BytesPerInstance,12:F0}");
+
+                if (instances > int.MaxValue / 10)
+                {
+                    break;
+                }
+            }
+        }
+    }
+}
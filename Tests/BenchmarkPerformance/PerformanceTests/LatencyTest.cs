@@ -17,6 +17,12 @@ public class LatencyTest
     private const int DOMAIN_ID_JSON = 43;
     private const int DOMAIN_ID_NATIVE = 45;
     private const string RTPS_DISCOVERY = "RtpsDiscovery";
+    private static readonly double[] HISTOGRAM_PERCENTILES = [0, 50, 75, 90, 99, 99.9, 99.99, 99.999, 100];
+
+    /// <summary>
+    /// Gets the folder where the native test writes the full latency distribution.
+    /// </summary>
+    public static readonly string HistogramOutputFolder = Path.Combine(Path.GetTempPath(), "LatencyHistogram");
 
     private CDRLatencyTest _cdrLatencyTest;
     private JSONLatencyTest _jsonLatencyTest;
@@ -67,6 +73,17 @@ public class LatencyTest
     /// </summary>
     public static IEnumerable<ulong> TotalPayloadValues { get; set;  }
 
+    /// <summary>
+    /// Gets or sets the sending rate in samples per second of the native test, zero sends back-to-back.
+    /// </summary>
+    [ParamsSource(nameof(SendRateValues))]
+    public double SendRate { get; set; }
+
+    /// <summary>
+    /// Gets or sets the sending rates for the native test.
+    /// </summary>
+    public static IEnumerable<double> SendRateValues { get; set; } = [0];
+
     [GlobalSetup(Target = nameof(OpenDDSharpCDRLatencyTest))]
     public void OpenDDSharpGlobalSetupCDR()
     {
@@ -191,7 +208,10 @@ public class LatencyTest
     [IterationSetup(Target = nameof(OpenDDSNativeLatencyTest))]
     public void OpenDDSNativeIterationSetup()
     {
-        _openDDSLatencyTest = new OpenDDSLatencyTest(TotalInstances, TotalSamples, TotalPayload, _participantNative);
+        _openDDSLatencyTest = new OpenDDSLatencyTest(TotalInstances, TotalSamples, TotalPayload, _participantNative)
+        {
+            Rate = SendRate,
+        };
     }
 
     [IterationSetup(Target = nameof(RtiConnextLatencyTest))]
@@ -223,12 +243,10 @@ public class LatencyTest
     [IterationCleanup(Target = nameof(OpenDDSNativeLatencyTest))]
     public void OpenDDSNativeIterationCleanup()
     {
-        _latencyHistory = _openDDSLatencyTest.Latencies;
-        _openDDSLatencyTest.Dispose();
+        HistogramStatistics("openddsnative");
+        NativeLatencyStatistics("openddsnative");
 
-        LatencyStatistics("openddsnative");
-
-        _latencyHistory.Clear();
+        _openDDSLatencyTest.Dispose();
     }
 
     [IterationCleanup(Target = nameof(RtiConnextLatencyTest))]
@@ -265,6 +283,53 @@ public class LatencyTest
         _latencyHistory= _rtiConnextLatencyTest.Run();
     }
 
+    private void HistogramStatistics(string name)
+    {
+        Directory.CreateDirectory(HistogramOutputFolder);
+
+        var rate = SendRate.ToString(CultureInfo.InvariantCulture);
+        var file = $"{name}-latency-histogram.{TotalInstances}.{TotalSamples}.{TotalPayload}.{rate}.txt";
+        using var writer = new StreamWriter(Path.Combine(HistogramOutputFolder, file));
+
+        foreach (var corrected in new[] { false, true })
+        {
+            var summary = _openDDSLatencyTest.GetSummary(corrected);
+            var histogram = _openDDSLatencyTest.GetHistogram(corrected);
+
+            writer.WriteLine(corrected ? "# Corrected (from the scheduled send time)" : "# Raw (from the actual send time)");
+            writer.WriteLine(string.Create(CultureInfo.InvariantCulture,
+                $"Count={summary.Count} Min={summary.Min / 1000.0:0.000}us Mean={summary.Mean / 1000.0:0.000}us Max={summary.Max / 1000.0:0.000}us"));
+            writer.WriteLine(string.Create(CultureInfo.InvariantCulture,
+                $"p50={summary.Fifty / 1000.0:0.000}us p90={summary.Ninety / 1000.0:0.000}us p99={summary.NinetyNine / 1000.0:0.000}us " +
+                $"p99.9={summary.NinetyNineNine / 1000.0:0.000}us p99.99={summary.NinetyNineNineNine / 1000.0:0.000}us"));
+
+            // Percentile distribution, one line per percentile, so the runs can be plotted and compared.
+            writer.WriteLine("Percentile\tValue(us)");
+            foreach (var percentile in HISTOGRAM_PERCENTILES)
+            {
+                writer.WriteLine(string.Create(CultureInfo.InvariantCulture,
+                    $"{percentile:0.000}\t{histogram.GetPercentile(percentile) / 1000.0:0.000}"));
+            }
+
+            writer.WriteLine();
+        }
+    }
+
+    private void NativeLatencyStatistics(string name)
+    {
+        // The native test keeps no per-sample storage, the columns come from its histogram of the raw round trips.
+        var summary = _openDDSLatencyTest.GetSummary(false);
+
+        var sentSamples = (ulong)TotalSamples * (ulong)TotalInstances;
+        if (summary.Count != sentSamples)
+        {
+            throw new InvalidOperationException($"Lost samples detected {summary.Count}/{sentSamples}.");
+        }
+
+        WriteLatencyStatistics(name, summary.Mean / 1e6, summary.Deviation / 1e6, summary.Min / 1e6, summary.Max / 1e6,
+            summary.Fifty / 1e6, summary.Ninety / 1e6, summary.NinetyNine / 1e6);
+    }
+
     private void LatencyStatistics(string name)
     {
         var sentSamples = TotalSamples * TotalInstances;
@@ -284,6 +349,15 @@ public class LatencyTest
         var latencyMin = sorted.First();
         var latencyMax = sorted.Last();
 
+        WriteLatencyStatistics(name, latencyAve, latencyStd, latencyMin.TotalMilliseconds, latencyMax.TotalMilliseconds,
+            _latencyHistory[count * 50 / 100].TotalMilliseconds,
+            _latencyHistory[count * 90 / 100].TotalMilliseconds,
+            _latencyHistory[count * 99 / 100].TotalMilliseconds);
+    }
+
+    private void WriteLatencyStatistics(string name, double latencyAve, double latencyStd, double latencyMin, double latencyMax,
+        double latencyFifty, double latencyNinety, double latencyNinetyNine)
+    {
         Directory.CreateDirectory(LatencyAverageColumn.OutputFolder);
         Directory.CreateDirectory(LatencyDeviationColumn.OutputFolder);
         Directory.CreateDirectory(LatencyMinimumColumn.OutputFolder);
@@ -302,23 +376,23 @@ public class LatencyTest
 
         var minimumFile = $"{name}-latency-minimum.{TotalInstances}.{TotalSamples}.{TotalPayload}.txt";
         File.WriteAllText(Path.Combine(LatencyMinimumColumn.OutputFolder, minimumFile),
-            latencyMin.TotalMilliseconds.ToString("0.0000", CultureInfo.InvariantCulture));
+            latencyMin.ToString("0.0000", CultureInfo.InvariantCulture));
 
         var maximumFile = $"{name}-latency-maximum.{TotalInstances}.{TotalSamples}.{TotalPayload}.txt";
         File.WriteAllText(Path.Combine(LatencyMaximumColumn.OutputFolder, maximumFile),
-            latencyMax.TotalMilliseconds.ToString("0.0000", CultureInfo.InvariantCulture));
+            latencyMax.ToString("0.0000", CultureInfo.InvariantCulture));
 
         var fiftyFile = $"{name}-latency-fifty.{TotalInstances}.{TotalSamples}.{TotalPayload}.txt";
         File.WriteAllText(Path.Combine(LatencyFiftyColumn.OutputFolder, fiftyFile),
-            _latencyHistory[count * 50 / 100].TotalMilliseconds.ToString("0.0000", CultureInfo.InvariantCulture));
+            latencyFifty.ToString("0.0000", CultureInfo.InvariantCulture));
 
         var ninetyFile = $"{name}-latency-ninety.{TotalInstances}.{TotalSamples}.{TotalPayload}.txt";
         File.WriteAllText(Path.Combine(LatencyNinetyColumn.OutputFolder, ninetyFile),
-            _latencyHistory[count * 90 / 100].TotalMilliseconds.ToString("0.0000", CultureInfo.InvariantCulture));
+            latencyNinety.ToString("0.0000", CultureInfo.InvariantCulture));
 
         var ninetyNineFile = $"{name}-latency-ninety-nine.{TotalInstances}.{TotalSamples}.{TotalPayload}.txt";
         File.WriteAllText(Path.Combine(LatencyNinetyNineColumn.OutputFolder, ninetyNineFile),
-            _latencyHistory[count * 99 / 100].TotalMilliseconds.ToString("0.0000", CultureInfo.InvariantCulture));
+            latencyNinetyNine.ToString("0.0000", CultureInfo.InvariantCulture));
     }
 }
 
@@ -0,0 +1,68 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Endpoints hosted by the process running the discovery test.
+/// </summary>
+internal enum DiscoveryRole
+{
+    All = 0,
+    Readers = 1,
+    Writers = 2,
+}
+
+/// <summary>
+/// Measurements of a discovery run. The times are milliseconds from the creation of the first participant,
+/// NaN when no endpoint got there before the timeout.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct DiscoveryResult
+{
+    public long Participants;
+    public long EndpointsPerParticipant;
+    public long Endpoints;
+    public long EndpointsMatched;
+    public long Readers;
+    public long ReadersWithData;
+    public double SetupMilliseconds;
+    public double FirstMatchMilliseconds;
+    public double FullMatchFiftyMilliseconds;
+    public double FullMatchMilliseconds;
+    public double FirstSampleFiftyMilliseconds;
+    public double FirstSampleMilliseconds;
+}
+
+/// <summary>
+/// Native discovery and time-to-first-sample test on the domain configured by the caller.
+/// </summary>
+internal sealed class OpenDDSDiscoveryTest(int domainId, DiscoveryRole role, int participants, int endpointsPerParticipant, int timeoutMs, string topicPrefix)
+    : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.DiscoveryInitialize(domainId, (int)role, participants, endpointsPerParticipant, timeoutMs, topicPrefix);
+
+    public DiscoveryResult Result
+    {
+        get
+        {
+            UnsafeNativeMethods.DiscoveryGetResult(_ptr, out var result);
+            return result;
+        }
+    }
+
+    public void Start()
+    {
+        UnsafeNativeMethods.DiscoveryStart(_ptr);
+    }
+
+    public void Wait()
+    {
+        UnsafeNativeMethods.DiscoveryWait(_ptr);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.DiscoveryFinalize(_ptr);
+    }
+}
@@ -0,0 +1,49 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Measurements of an instance scaling run. The rates are operations per second.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct InstanceScalingResult
+{
+    public long Instances;
+    public long SamplesWritten;
+    public long SamplesTaken;
+    public double RegisterPerSecond;
+    public double WritePerSecond;
+    public double LookupPerSecond;
+    public double TakePerSecond;
+    public double DisposePerSecond;
+    public double BytesPerInstance;
+}
+
+/// <summary>
+/// Native instance count scaling test with a KEEP_LAST 1 or KEEP_ALL history.
+/// </summary>
+internal sealed class OpenDDSInstanceScalingTest(int totalInstances, int samplesPerInstance, ulong totalPayload, bool keepAll, IntPtr participant)
+    : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.InstanceScalingInitialize(totalInstances, samplesPerInstance, totalPayload, keepAll, participant);
+
+    public InstanceScalingResult Result
+    {
+        get
+        {
+            UnsafeNativeMethods.InstanceScalingGetResult(_ptr, out var result);
+            return result;
+        }
+    }
+
+    public void Run()
+    {
+        UnsafeNativeMethods.InstanceScalingRun(_ptr);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.InstanceScalingFinalize(_ptr);
+    }
+}
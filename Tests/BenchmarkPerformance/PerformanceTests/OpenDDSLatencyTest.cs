@@ -1,22 +1,52 @@
-using OpenDDSharp.Marshaller;
+using System.Runtime.InteropServices;
 using OpenDDSharp.BenchmarkPerformance.Helpers;
+using OpenDDSharp.OpenDDS.DCPS;
 
 namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
 
+/// <summary>
+/// Percentile summary of the native latency histogram, in nanoseconds.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct LatencySummary
+{
+    public ulong Count;
+    public ulong Min;
+    public ulong Max;
+    public double Mean;
+    public double Deviation;
+    public ulong Fifty;
+    public ulong Ninety;
+    public ulong NinetyNine;
+    public ulong NinetyNineNine;
+    public ulong NinetyNineNineNine;
+}
+
 internal sealed class OpenDDSLatencyTest(int totalInstances, int totalSamples, ulong totalPayload, IntPtr participant) : IDisposable
 {
     private readonly IntPtr _ptr = UnsafeNativeMethods.LatencyInitialize(totalInstances, totalSamples, totalPayload, participant);
 
-    public IList<TimeSpan> Latencies
+    /// <summary>
+    /// Sets the fixed sending rate in samples per second, zero sends back-to-back.
+    /// </summary>
+    public double Rate
+    {
+        set => UnsafeNativeMethods.LatencySetRate(_ptr, value);
+    }
+
+    /// <summary>
+    /// Gets the percentile summary of the round trips. The corrected one is measured from the scheduled send time,
+    /// so it includes the time the samples waited behind a slow round trip at a fixed rate.
+    /// </summary>
+    public LatencySummary GetSummary(bool corrected)
+    {
+        UnsafeNativeMethods.LatencyGetSummary(_ptr, corrected, out var summary);
+        return summary;
+    }
+
+    public LatencyHistogram GetHistogram(bool corrected)
     {
-        get
-        {
-            var ptr = UnsafeNativeMethods.LatencyGetLatencies(_ptr);
-            IList<double> list = new List<double>();
-            ptr.PtrToSequence(ref list);
-            ptr.ReleaseNativePointer();
-            return list.Select(TimeSpan.FromMilliseconds).ToList();
-        }
+        return LatencyHistogram.FromNative(UnsafeNativeMethods.LatencyGetHistogram(_ptr, corrected));
     }
 
     public ulong Run()
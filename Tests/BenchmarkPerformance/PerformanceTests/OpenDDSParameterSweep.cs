@@ -0,0 +1,83 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.Marshaller;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// The RTPS/UDP transport knobs swept by the <see cref="OpenDDSParameterSweep" />.
+/// </summary>
+internal enum SweepParameter
+{
+    MaxMessageSize = 0,
+    MaxSamplesPerPacket = 1,
+    SendDelayMicroseconds = 2,
+    HeartbeatPeriodMicroseconds = 3,
+    NakResponseDelayMicroseconds = 4,
+    ResponsiveMode = 5,
+    AnticipatedFragments = 6,
+}
+
+/// <summary>
+/// One point of the parameter grid. A parameter value of -1 means the transport default.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct SweepResult
+{
+    public long MaxMessageSize;
+    public long MaxSamplesPerPacket;
+    public long SendDelayMicroseconds;
+    public long HeartbeatPeriodMicroseconds;
+    public long NakResponseDelayMicroseconds;
+    public long ResponsiveMode;
+    public long AnticipatedFragments;
+    public long SamplesReceived;
+    public double ThroughputSamplesPerSecond;
+    public double ThroughputMegabitsPerSecond;
+    public double LatencyAverageMilliseconds;
+    public double LatencyFiftyMilliseconds;
+    public double LatencyNinetyNineMilliseconds;
+    public long ParetoOptimal;
+}
+
+/// <summary>
+/// Runs the native RTPS/UDP parameter sweep over loopback and reports the throughput/latency Pareto frontier.
+/// </summary>
+internal sealed class OpenDDSParameterSweep(ulong payloadSize, int throughputSamples, int latencySamples) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.SweepInitialize(payloadSize, throughputSamples, latencySamples);
+
+    public IList<SweepResult> Results
+    {
+        get
+        {
+            var ptr = UnsafeNativeMethods.SweepGetResults(_ptr);
+            IList<SweepResult> list = new List<SweepResult>();
+            ptr.PtrToSequence(ref list);
+            ptr.ReleaseNativePointer();
+            return list;
+        }
+    }
+
+    public void AddValues(SweepParameter parameter, params long[] values)
+    {
+        ArgumentNullException.ThrowIfNull(values);
+
+        UnsafeNativeMethods.SweepAddValues(_ptr, (int)parameter, values, values.Length);
+    }
+
+    public uint Run()
+    {
+        return UnsafeNativeMethods.SweepRun(_ptr);
+    }
+
+    public void Report()
+    {
+        UnsafeNativeMethods.SweepReport(_ptr);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.SweepFinalize(_ptr);
+    }
+}
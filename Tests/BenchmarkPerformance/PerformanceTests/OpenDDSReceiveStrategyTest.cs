@@ -0,0 +1,66 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// How the reader of the <see cref="OpenDDSReceiveStrategyTest" /> gets its samples. <see cref="ListenerThread" /> is
+/// the dispatch of the OpenDDSharp listeners, a new thread per callback.
+/// </summary>
+internal enum ReceiveStrategy : long
+{
+    Listener = 0,
+    ListenerThread = 1,
+    WaitSet = 2,
+    Polling = 3,
+}
+
+/// <summary>
+/// Measurements of a receive strategy run. The latencies are nanoseconds from the write to the take, the CPU time is
+/// the one of the whole process.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct ReceiveStrategyResult
+{
+    public ReceiveStrategy Strategy;
+    public long SamplesWritten;
+    public long SamplesReceived;
+    public long Wakeups;
+    public double TargetRate;
+    public double AchievedRate;
+    public double CpuNanosecondsPerSample;
+    public double CpuUtilization;
+    public double LatencyMeanNanoseconds;
+    public ulong LatencyFiftyNanoseconds;
+    public ulong LatencyNinetyNanoseconds;
+    public ulong LatencyNinetyNineNanoseconds;
+    public ulong LatencyNinetyNineNineNanoseconds;
+    public ulong LatencyMaxNanoseconds;
+}
+
+/// <summary>
+/// Native receive strategy test at a fixed write rate.
+/// </summary>
+internal sealed class OpenDDSReceiveStrategyTest(ReceiveStrategy strategy, ulong totalPayload, IntPtr participant) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.ReceiveStrategyInitialize((int)strategy, totalPayload, participant);
+
+    public ReceiveStrategyResult Result
+    {
+        get
+        {
+            UnsafeNativeMethods.ReceiveStrategyGetResult(_ptr, out var result);
+            return result;
+        }
+    }
+
+    public void Run(int totalSamples, double samplesPerSecond)
+    {
+        UnsafeNativeMethods.ReceiveStrategyRun(_ptr, totalSamples, samplesPerSecond);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.ReceiveStrategyFinalize(_ptr);
+    }
+}
@@ -0,0 +1,79 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.Marshaller;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Aggregate measurements of a scaling run.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct ScalingResult
+{
+    public long SamplesSent;
+    public long SamplesExpected;
+    public long SamplesReceived;
+    public double Seconds;
+    public double SamplesPerSecond;
+    public double MegabitsPerSecond;
+    public double LossPercentage;
+    public double CpuUserSeconds;
+    public double CpuSystemSeconds;
+    public double CpuCores;
+}
+
+/// <summary>
+/// Measurements of a single reader of a scaling run.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct ScalingReaderResult
+{
+    public long Topic;
+    public long Reader;
+    public long SamplesExpected;
+    public long SamplesReceived;
+    public double LossPercentage;
+    public double Seconds;
+    public double SamplesPerSecond;
+}
+
+/// <summary>
+/// Native fan-out/fan-in scaling test. The writer and reader counts are per topic.
+/// </summary>
+internal sealed class OpenDDSScalingTest(int writers, int readers, int topics, int instances, int samplesPerWriter,
+    ulong totalPayload, bool reliable, bool pinThreads, IntPtr participant) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.ScalingInitialize(writers, readers, topics, instances, samplesPerWriter,
+        totalPayload, reliable, pinThreads, participant);
+
+    public ScalingResult Result
+    {
+        get
+        {
+            UnsafeNativeMethods.ScalingGetResult(_ptr, out var result);
+            return result;
+        }
+    }
+
+    public IList<ScalingReaderResult> Readers
+    {
+        get
+        {
+            var ptr = UnsafeNativeMethods.ScalingGetReaders(_ptr);
+            IList<ScalingReaderResult> list = new List<ScalingReaderResult>();
+            ptr.PtrToSequence(ref list);
+            ptr.ReleaseNativePointer();
+            return list;
+        }
+    }
+
+    public void Run()
+    {
+        UnsafeNativeMethods.ScalingRun(_ptr);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.ScalingFinalize(_ptr);
+    }
+}
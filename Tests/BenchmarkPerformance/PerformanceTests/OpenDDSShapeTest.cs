@@ -0,0 +1,55 @@
+using OpenDDSharp.Marshaller;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Topic types of the type shape test, declared in both the TestData and the CdrWrapper IDL.
+/// </summary>
+internal enum TypeShape
+{
+    KeyedOctets = 0,
+    MarketTick = 1,
+    TelemetryFrame = 2,
+    ConfigRecord = 3,
+}
+
+/// <summary>
+/// Native throughput and latency test of one topic type shape.
+/// </summary>
+internal sealed class OpenDDSShapeTest(TypeShape shape, ulong totalPayload, IntPtr participant) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.ShapeInitialize((int)shape, totalPayload, participant);
+
+    /// <summary>
+    /// Gets the XCDR2 size of the sample written by the test.
+    /// </summary>
+    public ulong SampleSize => UnsafeNativeMethods.ShapeGetSampleSize(_ptr);
+
+    public IList<TimeSpan> Latencies
+    {
+        get
+        {
+            var ptr = UnsafeNativeMethods.ShapeGetLatencies(_ptr);
+            IList<double> list = new List<double>();
+            ptr.PtrToSequence(ref list);
+            ptr.ReleaseNativePointer();
+            return list.Select(TimeSpan.FromMilliseconds).ToList();
+        }
+    }
+
+    public uint RunThroughput(int totalSamples)
+    {
+        return UnsafeNativeMethods.ShapeRunThroughput(_ptr, totalSamples);
+    }
+
+    public void RunLatency(int totalSamples)
+    {
+        UnsafeNativeMethods.ShapeRunLatency(_ptr, totalSamples);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.ShapeFinalize(_ptr);
+    }
+}
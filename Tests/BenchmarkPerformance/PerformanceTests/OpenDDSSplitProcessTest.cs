@@ -0,0 +1,56 @@
+using OpenDDSharp.Marshaller;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Native latency and throughput test between two participants in separate local processes.
+/// </summary>
+internal sealed class OpenDDSSplitProcessTest(bool driver, string topicPrefix, ulong totalPayload, IntPtr participant) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.SplitInitialize(driver, topicPrefix, totalPayload, participant);
+
+    public IList<TimeSpan> Latencies
+    {
+        get
+        {
+            var ptr = UnsafeNativeMethods.SplitGetLatencies(_ptr);
+            IList<double> list = new List<double>();
+            ptr.PtrToSequence(ref list);
+            ptr.ReleaseNativePointer();
+            return list.Select(TimeSpan.FromMilliseconds).ToList();
+        }
+    }
+
+    public IList<TimeSpan> RoundTrips
+    {
+        get
+        {
+            var ptr = UnsafeNativeMethods.SplitGetRoundTrips(_ptr);
+            IList<double> list = new List<double>();
+            ptr.PtrToSequence(ref list);
+            ptr.ReleaseNativePointer();
+            return list.Select(TimeSpan.FromMilliseconds).ToList();
+        }
+    }
+
+    public void RunLatency(int totalSamples)
+    {
+        UnsafeNativeMethods.SplitRunLatency(_ptr, totalSamples);
+    }
+
+    public uint RunThroughput(int totalSamples)
+    {
+        return UnsafeNativeMethods.SplitRunThroughput(_ptr, totalSamples);
+    }
+
+    public void RunPeer()
+    {
+        UnsafeNativeMethods.SplitRunPeer(_ptr);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.SplitFinalize(_ptr);
+    }
+}
@@ -0,0 +1,70 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Reliability, history and reader speed of a sustained rate run. With KEEP_ALL the depth is the
+/// max_samples_per_instance of the writer and the reader, so the reliable flow control pushes back on the writer.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct SustainedRateConfig
+{
+    public long Reliable;
+    public long KeepAll;
+    public long Depth;
+    public long MaxBlockingMilliseconds;
+    public long ReaderDelayMicroseconds;
+}
+
+/// <summary>
+/// Measurements of a sustained rate run. The latencies are nanoseconds from the write to the take.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct SustainedRateResult
+{
+    public double OfferedRate;
+    public double AchievedWriteRate;
+    public double AchievedReceiveRate;
+    public long SamplesOffered;
+    public long SamplesWritten;
+    public long SamplesReceived;
+    public long WriteTimeouts;
+    public double WriteBlockedMilliseconds;
+    public double WriteTotalMilliseconds;
+    public long SamplesLost;
+    public long SamplesRejected;
+    public long SamplesMissing;
+    public double LatencyMeanNanoseconds;
+    public ulong LatencyFiftyNanoseconds;
+    public ulong LatencyNinetyNineNanoseconds;
+    public ulong LatencyNinetyNineNineNanoseconds;
+    public ulong LatencyMaxNanoseconds;
+}
+
+/// <summary>
+/// Native throughput test at a target write rate.
+/// </summary>
+internal sealed class OpenDDSSustainedRateTest(SustainedRateConfig config, ulong totalPayload, IntPtr participant) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.SustainedRateInitialize(config, totalPayload, participant);
+
+    public SustainedRateResult Result
+    {
+        get
+        {
+            UnsafeNativeMethods.SustainedRateGetResult(_ptr, out var result);
+            return result;
+        }
+    }
+
+    public void Run(int totalSamples, double samplesPerSecond)
+    {
+        UnsafeNativeMethods.SustainedRateRun(_ptr, totalSamples, samplesPerSecond);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.SustainedRateFinalize(_ptr);
+    }
+}
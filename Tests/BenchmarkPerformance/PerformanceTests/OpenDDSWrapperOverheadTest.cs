@@ -0,0 +1,61 @@
+using System.Runtime.InteropServices;
+using OpenDDSharp.Marshaller;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// The write and take paths measured by the <see cref="OpenDDSWrapperOverheadTest" />.
+/// </summary>
+internal enum WrapperPath : long
+{
+    Native = 0,
+    Cdr = 1,
+    Json = 2,
+}
+
+/// <summary>
+/// Cost of one path in nanoseconds per sample. The overhead is the difference with the typed OpenDDS calls.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct WrapperOverheadResult
+{
+    public WrapperPath Path;
+    public long PayloadSize;
+    public long SamplesWritten;
+    public long SamplesTaken;
+    public double WriteNanosecondsPerSample;
+    public double TakeNanosecondsPerSample;
+    public double WriteOverheadNanoseconds;
+    public double TakeOverheadNanoseconds;
+}
+
+/// <summary>
+/// Native test that calls the generated _Cdr and _Json entry points of the TestData wrapper directly from C++.
+/// </summary>
+internal sealed class OpenDDSWrapperOverheadTest(int totalSamples, ulong totalPayload, IntPtr participant) : IDisposable
+{
+    private readonly IntPtr _ptr = UnsafeNativeMethods.WrapperOverheadInitialize(totalSamples, totalPayload, participant);
+
+    public IList<WrapperOverheadResult> Results
+    {
+        get
+        {
+            var ptr = UnsafeNativeMethods.WrapperOverheadGetResults(_ptr);
+            IList<WrapperOverheadResult> list = new List<WrapperOverheadResult>();
+            ptr.PtrToSequence(ref list);
+            ptr.ReleaseNativePointer();
+            return list;
+        }
+    }
+
+    public void Run()
+    {
+        UnsafeNativeMethods.WrapperOverheadRun(_ptr);
+    }
+
+    public void Dispose()
+    {
+        UnsafeNativeMethods.WrapperOverheadFinalize(_ptr);
+    }
+}
@@ -0,0 +1,57 @@
+using System.Diagnostics;
+using System.Globalization;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Multi-process ping-pong latency test. The publisher runs in this process and the echo in a child process started
+/// with the <c>--peer</c> argument, each one with its own participant, over every transport supported by <see cref="SameHostTest" />.
+/// </summary>
+/// <remarks>
+/// The round trip is measured by the publisher. The one-way estimate is half of the round trip without the time
+/// the echo spent between receiving the ping and writing the answer, so it doesn't need synchronized clocks.
+/// </remarks>
+internal static class PingPongTest
+{
+    public static void Run(ulong totalPayload, int totalSamples)
+    {
+        Console.WriteLine($"Ping-pong test, payload {totalPayload} bytes, {totalSamples} samples.");
+        Console.WriteLine($"{"Transport",-10}{"RTT avg",12}{"RTT p50",12}{"RTT p99",12}{"RTT max",12}" +
+                          $"{"1-way avg",12}{"1-way p50",12}{"1-way p99",12}{"1-way max",12}");
+
+        foreach (var transport in new[] { SameHostTest.RTPS_UDP, SameHostTest.TCP, SameHostTest.SHMEM, SameHostTest.MULTICAST })
+        {
+            var prefix = "PingPong_" + Guid.NewGuid().ToString("N", CultureInfo.InvariantCulture);
+            var participant = SameHostTest.Setup(transport);
+
+            using var echo = Process.Start(new ProcessStartInfo
+            {
+                FileName = Environment.ProcessPath!,
+                Arguments = $"--peer {transport} {prefix} {totalPayload}",
+                UseShellExecute = false,
+            })!;
+
+            List<double> roundTrips;
+            List<double> oneWay;
+            using (var test = new OpenDDSSplitProcessTest(true, prefix, totalPayload, participant))
+            {
+                test.RunLatency(totalSamples);
+                roundTrips = test.RoundTrips.Select(l => l.TotalMilliseconds).OrderBy(l => l).ToList();
+                oneWay = test.Latencies.Select(l => l.TotalMilliseconds).OrderBy(l => l).ToList();
+            }
+
+            echo.WaitForExit(30_000);
+            UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+            Console.WriteLine($"{transport,-10}{Summary(roundTrips)}{Summary(oneWay)}");
+        }
+
+        Console.WriteLine("Values in milliseconds.");
+    }
+
+    private static string Summary(IReadOnlyList<double> sorted)
+    {
+        return $"{sorted.Average(),12:F4}{SameHostTest.Percentile(sorted, 0.50),12:F4}{SameHostTest.Percentile(sorted, 0.99),12:F4}{sorted[^1],12:F4}";
+    }
+}
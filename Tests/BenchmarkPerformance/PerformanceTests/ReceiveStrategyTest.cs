@@ -0,0 +1,69 @@
+using System.Globalization;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Latency distribution and CPU cost per sample of the listener, listener with thread dispatch, WaitSet and polling
+/// receive strategies at several write rates, over RTPS/UDP loopback without any managed code in the measured path.
+/// </summary>
+/// <remarks>
+/// The CPU time is the one of the whole process, so it includes the writer and the transport threads, which are the
+/// same for every strategy at a given rate: the difference between the strategies is the cost of the receive side.
+/// Polling keeps a core busy whatever the rate, its cost per sample drops as the rate grows. The rate zero writes
+/// back-to-back. Every run is appended to a CSV file with its date, so the cost of the listener dispatch is tracked.
+/// </remarks>
+internal static class ReceiveStrategyTest
+{
+    private static readonly int[] RATES = [100, 1_000, 10_000, 50_000, 0];
+    private const int UNPACED_SAMPLES = 100_000;
+
+    public static void Run(ulong totalPayload, int secondsPerRate, string historyFile)
+    {
+        Console.WriteLine($"Receive strategy test, payload {totalPayload} bytes, {secondsPerRate} seconds per rate.");
+        Console.WriteLine($"{"Rate",-9}{"Strategy",-16}{"Received",10}{"Achieved/s",12}{"Wakeups",12}{"CPU ns",10}{"CPU %",8}" +
+                          $"{"p50 us",10}{"p90 us",10}{"p99 us",10}{"p99.9 us",10}{"Max us",10}");
+
+        var date = DateTime.UtcNow.ToString("o", CultureInfo.InvariantCulture);
+        var lines = new List<string>();
+        if (!File.Exists(historyFile))
+        {
+            lines.Add("date,payload,strategy,target_rate,samples,received,achieved_rate,wakeups,cpu_ns_per_sample,cpu_utilization," +
+                      "latency_mean_ns,latency_p50_ns,latency_p90_ns,latency_p99_ns,latency_p999_ns,latency_max_ns");
+        }
+
+        var participant = SameHostTest.Setup(SameHostTest.RTPS_UDP);
+        foreach (var rate in RATES)
+        {
+            var totalSamples = rate > 0 ? rate * secondsPerRate : UNPACED_SAMPLES;
+            foreach (var strategy in Enum.GetValues<ReceiveStrategy>())
+            {
+                ReceiveStrategyResult result;
+                using (var test = new OpenDDSReceiveStrategyTest(strategy, totalPayload, participant))
+                {
+                    test.Run(totalSamples, rate);
+                    result = test.Result;
+                }
+
+                var rateName = rate > 0 ? rate.ToString(CultureInfo.InvariantCulture) : "max";
+                Console.WriteLine($"{rateName,-9}{strategy,-16}{result.SamplesReceived,10}{result.AchievedRate,12:F0}{result.Wakeups,12}" +
+                                  $"{result.CpuNanosecondsPerSample,10:F0}{result.CpuUtilization * 100,8:F1}" +
+                                  $"{result.LatencyFiftyNanoseconds / 1_000.0,10:F1}{result.LatencyNinetyNanoseconds / 1_000.0,10:F1}" +
+                                  $"{result.LatencyNinetyNineNanoseconds / 1_000.0,10:F1}{result.LatencyNinetyNineNineNanoseconds / 1_000.0,10:F1}" +
+                                  $"{result.LatencyMaxNanoseconds / 1_000.0,10:F1}");
+
+                lines.Add(string.Create(CultureInfo.InvariantCulture,
+                    $"{date},{totalPayload},{strategy},{rate},{result.SamplesWritten},{result.SamplesReceived},{result.AchievedRate:F1}," +
+                    $"{result.Wakeups},{result.CpuNanosecondsPerSample:F1},{result.CpuUtilization:F4},{result.LatencyMeanNanoseconds:F0}," +
+                    $"{result.LatencyFiftyNanoseconds},{result.LatencyNinetyNanoseconds},{result.LatencyNinetyNineNanoseconds}," +
+                    $"{result.LatencyNinetyNineNineNanoseconds},{result.LatencyMaxNanoseconds}"));
+            }
+        }
+
+        UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+        Directory.CreateDirectory(Path.GetDirectoryName(historyFile)!);
+        File.AppendAllLines(historyFile, lines);
+        Console.WriteLine($"Results appended to {historyFile}.");
+    }
+}
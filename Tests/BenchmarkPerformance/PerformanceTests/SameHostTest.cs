@@ -0,0 +1,136 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Net;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.OpenDDS.RTPS;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Compares the same-host latency and throughput of the shared-memory transport against rtps_udp loopback.
+/// The driver runs in this process and the peer in a child process started with the <c>--peer</c> argument.
+/// </summary>
+internal static class SameHostTest
+{
+    private const int DOMAIN_ID_NATIVE = 45;
+    private const string RTPS_DISCOVERY = "RtpsDiscovery";
+    internal const string SHMEM = "shmem";
+    internal const string RTPS_UDP = "rtps_udp";
+    internal const string TCP = "tcp";
+    internal const string MULTICAST = "multicast";
+
+    private static bool _discoveryAdded;
+
+    public static void Run(ulong totalPayload, int latencySamples, int throughputSamples)
+    {
+        Console.WriteLine($"Same-host test, payload {totalPayload} bytes, {latencySamples} latency samples, {throughputSamples} throughput samples.");
+        Console.WriteLine($"{"Transport",-10}{"Avg ms",12}{"p50 ms",12}{"p99 ms",12}{"Max ms",12}{"Samples/s",14}{"Received",12}");
+
+        foreach (var transport in new[] { SHMEM, RTPS_UDP })
+        {
+            var prefix = "SameHost_" + Guid.NewGuid().ToString("N", CultureInfo.InvariantCulture);
+            var participant = Setup(transport);
+
+            using var peer = Process.Start(new ProcessStartInfo
+            {
+                FileName = Environment.ProcessPath!,
+                Arguments = $"--peer {transport} {prefix} {totalPayload}",
+                UseShellExecute = false,
+            })!;
+
+            List<double> latencies;
+            uint received;
+            TimeSpan elapsed;
+            using (var test = new OpenDDSSplitProcessTest(true, prefix, totalPayload, participant))
+            {
+                test.RunLatency(latencySamples);
+                latencies = test.Latencies.Select(l => l.TotalMilliseconds).OrderBy(l => l).ToList();
+
+                var stopwatch = Stopwatch.StartNew();
+                received = test.RunThroughput(throughputSamples);
+                elapsed = stopwatch.Elapsed;
+            }
+
+            peer.WaitForExit(30_000);
+            UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+            Console.WriteLine($"{transport,-10}{latencies.Average(),12:F4}{Percentile(latencies, 0.50),12:F4}{Percentile(latencies, 0.99),12:F4}" +
+                              $"{latencies[^1],12:F4}{received / elapsed.TotalSeconds,14:F0}{received,12}");
+        }
+    }
+
+    public static void RunPeer(string transport, string topicPrefix, ulong totalPayload)
+    {
+        var participant = Setup(transport);
+
+        using (var test = new OpenDDSSplitProcessTest(false, topicPrefix, totalPayload, participant))
+        {
+            test.RunPeer();
+        }
+
+        UnsafeNativeMethods.NativeGlobalCleanup(participant);
+    }
+
+    internal static IntPtr Setup(string transport)
+    {
+        // The discovery is registered once per process, every run only adds its own transport config.
+        if (!_discoveryAdded)
+        {
+            var disc = new RtpsDiscovery(RTPS_DISCOVERY);
+            ParticipantService.Instance.AddDiscovery(disc);
+            ParticipantService.Instance.DefaultDiscovery = RTPS_DISCOVERY;
+            ParticipantService.Instance.SetRepoDomain(DOMAIN_ID_NATIVE, RTPS_DISCOVERY);
+            _ = ParticipantService.Instance.GetDomainParticipantFactory();
+            _discoveryAdded = true;
+        }
+
+        var guid = Guid.NewGuid().ToString("N", CultureInfo.InvariantCulture);
+        var configName = "openddsharp_" + transport + "_" + guid;
+        var instName = "internal_openddsharp_" + transport + "_" + guid;
+
+        var config = TransportRegistry.Instance.CreateConfig(configName);
+        var inst = TransportRegistry.Instance.CreateInst(instName, transport);
+        switch (transport)
+        {
+            case SHMEM:
+                config.Insert(new ShmemInst(inst)
+                {
+                    PoolSize = 64 * 1024 * 1024,
+                });
+                break;
+            case TCP:
+                config.Insert(new TcpInst(inst)
+                {
+                    LocalAddress = IPAddress.Loopback + ":",
+                });
+                break;
+            case MULTICAST:
+                config.Insert(new MulticastInst(inst)
+                {
+                    Reliable = true,
+                });
+                break;
+            default:
+                config.Insert(new RtpsUdpInst(inst)
+                {
+                    UseMulticast = false,
+                    LocalAddress = IPAddress.Loopback + ":",
+                });
+                break;
+        }
+
+        return UnsafeNativeMethods.NativeGlobalSetup(configName);
+    }
+
+    internal static double Percentile(IReadOnlyList<double> sorted, double percentile)
+    {
+        if (sorted.Count == 0)
+        {
+            return double.NaN;
+        }
+
+        var rank = (int)Math.Ceiling(percentile * sorted.Count);
+        return sorted[Math.Max(rank - 1, 0)];
+    }
+}
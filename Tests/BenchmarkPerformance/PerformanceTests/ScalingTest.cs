@@ -0,0 +1,67 @@
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Fan-out (1 to N), fan-in (N to 1), N to N and multi-topic scaling over RTPS/UDP loopback, reliable and best effort.
+/// Every writer and reader runs in its own thread pinned to the cores in round robin.
+/// </summary>
+/// <remarks>
+/// The throughput is aggregated over all the readers, so a perfect fan-out scales with the reader count. The CPU
+/// column is the process CPU time over the wall time, the average number of busy cores during the run.
+/// </remarks>
+internal static class ScalingTest
+{
+    private static readonly (int Writers, int Readers, int Topics)[] TOPOLOGIES =
+    [
+        (1, 1, 1),
+        (1, 2, 1),
+        (1, 4, 1),
+        (1, 8, 1),
+        (2, 1, 1),
+        (4, 1, 1),
+        (8, 1, 1),
+        (4, 4, 1),
+        (1, 1, 4),
+        (1, 1, 16),
+        (2, 2, 8),
+    ];
+
+    public static void Run(ulong totalPayload, int samplesPerWriter, int instances)
+    {
+        Console.WriteLine($"Scaling test, payload {totalPayload} bytes, {samplesPerWriter} samples per writer, {instances} instances per writer.");
+        Console.WriteLine($"{"W x R x T",-12}{"QoS",-12}{"Expected",12}{"Received",12}{"Samples/s",14}{"Mbps",10}" +
+                          $"{"Loss %",10}{"Worst %",10}{"CPU cores",11}");
+
+        foreach (var reliable in new[] { true, false })
+        {
+            foreach (var (writers, readers, topics) in TOPOLOGIES)
+            {
+                var participant = SameHostTest.Setup(SameHostTest.RTPS_UDP);
+
+                ScalingResult result;
+                IList<ScalingReaderResult> readerResults;
+                using (var test = new OpenDDSScalingTest(writers, readers, topics, instances, samplesPerWriter, totalPayload,
+                           reliable, true, participant))
+                {
+                    test.Run();
+                    result = test.Result;
+                    readerResults = test.Readers;
+                }
+
+                UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+                var worst = readerResults.Count > 0 ? readerResults.Max(r => r.LossPercentage) : 0;
+                Console.WriteLine($"{$"{writers} x {readers} x {topics}",-12}{(reliable ? "reliable" : "best effort"),-12}" +
+                                  $"{result.SamplesExpected,12}{result.SamplesReceived,12}{result.SamplesPerSecond,14:F0}" +
+                                  $"{result.MegabitsPerSecond,10:F1}{result.LossPercentage,10:F2}{worst,10:F2}{result.CpuCores,11:F2}");
+
+                foreach (var reader in readerResults.Where(r => r.LossPercentage > 0))
+                {
+                    Console.WriteLine($"    topic {reader.Topic} reader {reader.Reader}: {reader.SamplesReceived}/{reader.SamplesExpected} " +
+                                      $"({reader.LossPercentage:F2}% lost, {reader.SamplesPerSecond:F0} samples/s)");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+using System.Globalization;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Achieved rate, writer blocking, sample loss and latency at a growing offered load, with reliable KEEP_ALL,
+/// reliable KEEP_LAST and best effort readers, fast and slow, over RTPS/UDP loopback.
+/// </summary>
+/// <remarks>
+/// The knee of a scenario is the highest offered rate still received in full: at least 95% of the offered rate,
+/// no write timeout and no missing sample. Past it the reliable KEEP_ALL writer blocks, the KEEP_LAST readers lose
+/// the overwritten samples and the latency grows with the queues. The slow readers spend
+/// <see cref="SLOW_READER_DELAY_US" /> microseconds on every sample, so their knee is near 1e6 / that delay.
+/// Every run is appended to a CSV file with its date.
+/// </remarks>
+internal static class SustainedRateTest
+{
+    private const int DEPTH = 100;
+    private const int MAX_BLOCKING_MS = 100;
+    private const int SLOW_READER_DELAY_US = 50;
+    private const double KNEE_RATIO = 0.95;
+    private static readonly int[] RATES = [1_000, 5_000, 10_000, 25_000, 50_000, 100_000, 200_000];
+
+    public static void Run(ulong totalPayload, int secondsPerRate, string historyFile)
+    {
+        var scenarios = new (string Name, SustainedRateConfig Config)[]
+        {
+            ("Reliable KEEP_ALL", Config(true, true, 0)),
+            ("Reliable KEEP_LAST", Config(true, false, 0)),
+            ("BestEffort KEEP_LAST", Config(false, false, 0)),
+            ("Reliable KEEP_ALL slow", Config(true, true, SLOW_READER_DELAY_US)),
+            ("Reliable KEEP_LAST slow", Config(true, false, SLOW_READER_DELAY_US)),
+        };
+
+        Console.WriteLine($"Sustained rate test, payload {totalPayload} bytes, {secondsPerRate} seconds per rate, depth {DEPTH}, " +
+                          $"max blocking time {MAX_BLOCKING_MS} ms.");
+
+        var date = DateTime.UtcNow.ToString("o", CultureInfo.InvariantCulture);
+        var lines = new List<string>();
+        if (!File.Exists(historyFile))
+        {
+            lines.Add("date,payload,scenario,reliable,keep_all,depth,max_blocking_ms,reader_delay_us,offered_rate,samples_offered," +
+                      "samples_written,samples_received,write_rate,receive_rate,write_timeouts,write_blocked_ms,write_total_ms," +
+                      "samples_lost,samples_rejected,samples_missing,latency_mean_ns,latency_p50_ns,latency_p99_ns,latency_p999_ns,latency_max_ns");
+        }
+
+        var participant = SameHostTest.Setup(SameHostTest.RTPS_UDP);
+        foreach (var (name, config) in scenarios)
+        {
+            Console.WriteLine();
+            Console.WriteLine(name);
+            Console.WriteLine($"{"Offered/s",11}{"Written/s",11}{"Received/s",12}{"Timeouts",10}{"Blocked ms",12}{"Lost",8}{"Rejected",10}" +
+                              $"{"Missing",10}{"p50 us",10}{"p99 us",10}{"p99.9 us",10}{"Max us",10}");
+
+            int? knee = null;
+            var kneePassed = false;
+            foreach (var rate in RATES)
+            {
+                SustainedRateResult result;
+                using (var test = new OpenDDSSustainedRateTest(config, totalPayload, participant))
+                {
+                    test.Run(rate * secondsPerRate, rate);
+                    result = test.Result;
+                }
+
+                Console.WriteLine($"{rate,11}{result.AchievedWriteRate,11:F0}{result.AchievedReceiveRate,12:F0}{result.WriteTimeouts,10}" +
+                                  $"{result.WriteBlockedMilliseconds,12:F1}{result.SamplesLost,8}{result.SamplesRejected,10}{result.SamplesMissing,10}" +
+                                  $"{result.LatencyFiftyNanoseconds / 1_000.0,10:F1}{result.LatencyNinetyNineNanoseconds / 1_000.0,10:F1}" +
+                                  $"{result.LatencyNinetyNineNineNanoseconds / 1_000.0,10:F1}{result.LatencyMaxNanoseconds / 1_000.0,10:F1}");
+
+                var sustained = result.AchievedReceiveRate >= rate * KNEE_RATIO && result.WriteTimeouts == 0 &&
+                                result.SamplesMissing == 0 && result.SamplesReceived == result.SamplesOffered;
+                if (sustained && !kneePassed)
+                {
+                    knee = rate;
+                }
+                else
+                {
+                    kneePassed = true;
+                }
+
+                lines.Add(string.Create(CultureInfo.InvariantCulture,
+                    $"{date},{totalPayload},{name},{config.Reliable},{config.KeepAll},{config.Depth},{config.MaxBlockingMilliseconds}," +
+                    $"{config.ReaderDelayMicroseconds},{rate},{result.SamplesOffered},{result.SamplesWritten},{result.SamplesReceived}," +
+                    $"{result.AchievedWriteRate:F1},{result.AchievedReceiveRate:F1},{result.WriteTimeouts},{result.WriteBlockedMilliseconds:F3}," +
+                    $"{result.WriteTotalMilliseconds:F3},{result.SamplesLost},{result.SamplesRejected},{result.SamplesMissing}," +
+                    $"{result.LatencyMeanNanoseconds:F0},{result.LatencyFiftyNanoseconds},{result.LatencyNinetyNineNanoseconds}," +
+                    $"{result.LatencyNinetyNineNineNanoseconds},{result.LatencyMaxNanoseconds}"));
+            }
+
+            Console.WriteLine(knee is { } k
+                ? $"Knee: sustained up to {k} samples/s."
+                : $"Knee: not sustained at {RATES[0]} samples/s.");
+        }
+
+        UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+        Directory.CreateDirectory(Path.GetDirectoryName(historyFile)!);
+        File.AppendAllLines(historyFile, lines);
+        Console.WriteLine($"Results appended to {historyFile}.");
+    }
+
+    private static SustainedRateConfig Config(bool reliable, bool keepAll, int readerDelayMicroseconds)
+    {
+        return new SustainedRateConfig
+        {
+            Reliable = reliable ? 1 : 0,
+            KeepAll = keepAll ? 1 : 0,
+            Depth = DEPTH,
+            MaxBlockingMilliseconds = MAX_BLOCKING_MS,
+            ReaderDelayMicroseconds = readerDelayMicroseconds,
+        };
+    }
+}
@@ -0,0 +1,112 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Net;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+using OpenDDSharp.OpenDDS.DCPS;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Throughput and latency of realistic topic type shapes, natively and through the OpenDDSharp CDR wrapper.
+/// </summary>
+/// <remarks>
+/// KeyedOctets is the best case for the serializers, the market tick, telemetry frame and configuration record
+/// shapes add multi-field keys, enums, arrays of structs, nested structs and many strings. The payload size
+/// scales the sequences of the shapes, the table reports the serialized size actually written.
+/// Every run is appended to a CSV file with its date, so marshaling changes can be compared per shape.
+/// </remarks>
+internal static class TypeShapeTest
+{
+    private const int DOMAIN_ID_CDR = 42;
+
+    public static void Run(ulong totalPayload, int throughputSamples, int latencySamples, string historyFile)
+    {
+        Console.WriteLine($"Type shape test, payload {totalPayload} bytes, {throughputSamples} throughput samples, {latencySamples} latency samples.");
+        Console.WriteLine($"{"Shape",-16}{"Path",-8}{"Bytes",9}{"Samples/s",14}{"MB/s",10}{"Received",10}{"p50 ms",10}{"p99 ms",10}{"Max ms",10}");
+
+        var date = DateTime.UtcNow.ToString("o", CultureInfo.InvariantCulture);
+        var lines = new List<string>();
+        if (!File.Exists(historyFile))
+        {
+            lines.Add("date,shape,path,payload,sample_bytes,samples,received,samples_per_second,megabytes_per_second,latency_p50_ms,latency_p99_ms,latency_max_ms");
+        }
+
+        var nativeParticipant = SameHostTest.Setup(SameHostTest.RTPS_UDP);
+
+        var guid = Guid.NewGuid().ToString("N", CultureInfo.InvariantCulture);
+        var configName = "openddsharp_rtps_udp_" + guid;
+        var config = TransportRegistry.Instance.CreateConfig(configName);
+        var inst = TransportRegistry.Instance.CreateInst("internal_openddsharp_rtps_udp_" + guid, SameHostTest.RTPS_UDP);
+        config.Insert(new RtpsUdpInst(inst)
+        {
+            UseMulticast = false,
+            LocalAddress = IPAddress.Loopback + ":",
+        });
+
+        var dpf = ParticipantService.Instance.GetDomainParticipantFactory();
+        var cdrParticipant = dpf.CreateParticipant(DOMAIN_ID_CDR);
+        TransportRegistry.Instance.BindConfig(configName, cdrParticipant);
+
+        foreach (var shape in Enum.GetValues<TypeShape>())
+        {
+            ulong sampleSize;
+            uint nativeReceived;
+            TimeSpan nativeElapsed;
+            List<double> nativeLatencies;
+            using (var test = new OpenDDSShapeTest(shape, totalPayload, nativeParticipant))
+            {
+                sampleSize = test.SampleSize;
+
+                var stopwatch = Stopwatch.StartNew();
+                nativeReceived = test.RunThroughput(throughputSamples);
+                nativeElapsed = stopwatch.Elapsed;
+
+                test.RunLatency(latencySamples);
+                nativeLatencies = test.Latencies.Select(l => l.TotalMilliseconds).OrderBy(l => l).ToList();
+            }
+
+            ulong cdrReceived;
+            TimeSpan cdrElapsed;
+            List<double> cdrLatencies;
+            using (var test = new CDRShapeTest(shape, totalPayload, cdrParticipant))
+            {
+                var stopwatch = Stopwatch.StartNew();
+                cdrReceived = test.RunThroughput(throughputSamples);
+                cdrElapsed = stopwatch.Elapsed;
+
+                cdrLatencies = test.RunLatency(latencySamples).Select(l => l.TotalMilliseconds).OrderBy(l => l).ToList();
+            }
+
+            Report(lines, date, shape, "Native", totalPayload, sampleSize, throughputSamples, nativeReceived, nativeElapsed, nativeLatencies);
+            Report(lines, date, shape, "CDR", totalPayload, sampleSize, throughputSamples, cdrReceived, cdrElapsed, cdrLatencies);
+        }
+
+        UnsafeNativeMethods.NativeGlobalCleanup(nativeParticipant);
+
+        cdrParticipant.DeleteContainedEntities();
+        dpf.DeleteParticipant(cdrParticipant);
+        TransportRegistry.Instance.RemoveConfig(config);
+        TransportRegistry.Instance.RemoveInst(inst);
+
+        Directory.CreateDirectory(Path.GetDirectoryName(historyFile)!);
+        File.AppendAllLines(historyFile, lines);
+        Console.WriteLine($"Results appended to {historyFile}.");
+    }
+
+    private static void Report(List<string> lines, string date, TypeShape shape, string path, ulong totalPayload, ulong sampleSize,
+        int totalSamples, ulong received, TimeSpan elapsed, List<double> latencies)
+    {
+        var samplesPerSecond = received / elapsed.TotalSeconds;
+        var megabytesPerSecond = samplesPerSecond * sampleSize / (1024 * 1024);
+        var fifty = SameHostTest.Percentile(latencies, 0.50);
+        var ninetyNine = SameHostTest.Percentile(latencies, 0.99);
+        var max = latencies.Count > 0 ? latencies[^1] : double.NaN;
+
+        Console.WriteLine($"{shape,-16}{path,-8}{sampleSize,9}{samplesPerSecond,14:F0}{megabytesPerSecond,10:F1}{received,10}" +
+                          $"{fifty,10:F4}{ninetyNine,10:F4}{max,10:F4}");
+
+        lines.Add(string.Create(CultureInfo.InvariantCulture,
+            $"{date},{shape},{path},{totalPayload},{sampleSize},{totalSamples},{received},{samplesPerSecond:F1},{megabytesPerSecond:F3}," +
+            $"{fifty:F4},{ninetyNine:F4},{max:F4}"));
+    }
+}
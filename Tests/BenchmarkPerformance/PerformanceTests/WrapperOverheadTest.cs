@@ -0,0 +1,56 @@
+using System.Globalization;
+using OpenDDSharp.BenchmarkPerformance.Helpers;
+
+namespace OpenDDSharp.BenchmarkPerformance.PerformanceTests;
+
+/// <summary>
+/// Wrapper overhead per payload size over RTPS/UDP loopback, without any managed code in the measured path.
+/// </summary>
+/// <remarks>
+/// Every run is appended to a CSV file with its date, so the overhead can be tracked over time and a regression
+/// of the generated wrapper is not hidden by the managed marshalling costs measured by the other tests.
+/// </remarks>
+internal static class WrapperOverheadTest
+{
+    private static readonly ulong[] PAYLOADS = [64, 1_024, 16_384, 65_536];
+
+    public static void Run(int totalSamples, string historyFile)
+    {
+        Console.WriteLine($"Wrapper overhead test, {totalSamples} samples.");
+        Console.WriteLine($"{"Payload",-10}{"Path",-8}{"Write ns",12}{"Overhead",12}{"Take ns",12}{"Overhead",12}{"Taken",10}");
+
+        var date = DateTime.UtcNow.ToString("o", CultureInfo.InvariantCulture);
+        var lines = new List<string>();
+        if (!File.Exists(historyFile))
+        {
+            lines.Add("date,payload,path,samples,write_ns,write_overhead_ns,take_ns,take_overhead_ns");
+        }
+
+        var participant = SameHostTest.Setup(SameHostTest.RTPS_UDP);
+        foreach (var payload in PAYLOADS)
+        {
+            IList<WrapperOverheadResult> results;
+            using (var test = new OpenDDSWrapperOverheadTest(totalSamples, payload, participant))
+            {
+                test.Run();
+                results = test.Results;
+            }
+
+            foreach (var result in results)
+            {
+                Console.WriteLine($"{payload,-10}{result.Path,-8}{result.WriteNanosecondsPerSample,12:F0}{result.WriteOverheadNanoseconds,12:F0}" +
+                                  $"{result.TakeNanosecondsPerSample,12:F0}{result.TakeOverheadNanoseconds,12:F0}{result.SamplesTaken,10}");
+
+                lines.Add(string.Create(CultureInfo.InvariantCulture,
+                    $"{date},{payload},{result.Path},{totalSamples},{result.WriteNanosecondsPerSample:F1},{result.WriteOverheadNanoseconds:F1}," +
+                    $"{result.TakeNanosecondsPerSample:F1},{result.TakeOverheadNanoseconds:F1}"));
+            }
+        }
+
+        UnsafeNativeMethods.NativeGlobalCleanup(participant);
+
+        Directory.CreateDirectory(Path.GetDirectoryName(historyFile)!);
+        File.AppendAllLines(historyFile, lines);
+        Console.WriteLine($"Results appended to {historyFile}.");
+    }
+}
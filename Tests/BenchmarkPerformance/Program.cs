@@ -1,8 +1,10 @@
-﻿using BenchmarkDotNet.Running;
+﻿using System.Globalization;
+using BenchmarkDotNet.Running;
 using OpenDDSharp;
 using OpenDDSharp.BenchmarkPerformance.Configurations;
 using OpenDDSharp.BenchmarkPerformance.PerformanceTests;
 using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.OpenDDS.RTPS;
 
 var artifactsPath = Path.Combine(Environment.CurrentDirectory, "PerformanceTestArtifacts");
 
@@ -14,6 +16,16 @@ if (args.Length == 0)
     Console.WriteLine("[2] Throughput Payload Performance Test");
     Console.WriteLine("[3] Latency Samples Performance Test");
     Console.WriteLine("[4] Throughput Samples Performance Test");
+    Console.WriteLine("[5] RTPS/UDP Parameter Sweep");
+    Console.WriteLine("[6] Same-Host Shared Memory vs RTPS/UDP Loopback Test");
+    Console.WriteLine("[7] Multi-Process Ping-Pong Latency Test");
+    Console.WriteLine("[8] Fan-Out / Fan-In Scaling Test");
+    Console.WriteLine("[9] Instance Count Scaling Test");
+    Console.WriteLine("[10] Native Wrapper Overhead Test");
+    Console.WriteLine("[11] Discovery and Time-to-First-Sample Test");
+    Console.WriteLine("[12] Type Shape Test");
+    Console.WriteLine("[13] Receive Strategy Test");
+    Console.WriteLine("[14] Sustained Rate Throughput Test");
     Console.WriteLine("Anything else will stop the program.");
     Console.Write("> ");
     input = Console.ReadLine();
@@ -145,4 +157,187 @@ switch (input)
         Ace.Fini();
         break;
     }
-}
\ No newline at end of file
+    case "5": // RTPS/UDP Parameter Sweep
+    {
+        Ace.Init();
+
+        const string rtpsDiscovery = "RtpsDiscovery";
+        var disc = new RtpsDiscovery(rtpsDiscovery);
+        ParticipantService.Instance.AddDiscovery(disc);
+        ParticipantService.Instance.DefaultDiscovery = rtpsDiscovery;
+        ParticipantService.Instance.SetRepoDomain(45, rtpsDiscovery);
+        _ = ParticipantService.Instance.GetDomainParticipantFactory();
+
+        using (var sweep = new OpenDDSParameterSweep(16_384, 10_000, 1_000))
+        {
+            sweep.AddValues(SweepParameter.MaxMessageSize, 8_192, 16_384, 65_466);
+            sweep.AddValues(SweepParameter.MaxSamplesPerPacket, 1, 10, 50);
+            sweep.AddValues(SweepParameter.SendDelayMicroseconds, 0, 1_000, 10_000);
+            sweep.AddValues(SweepParameter.ResponsiveMode, 0, 1);
+
+            _ = sweep.Run();
+            sweep.Report();
+
+            var frontier = sweep.Results.Where(r => r.ParetoOptimal != 0).ToList();
+            Console.WriteLine($"Pareto frontier: {frontier.Count} of {sweep.Results.Count} configurations.");
+        }
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "6": // Same-Host Shared Memory vs RTPS/UDP Loopback Test
+    {
+        Ace.Init();
+
+        SameHostTest.Run(16_384, 1_000, 10_000);
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "7": // Multi-Process Ping-Pong Latency Test: 7 [payload] [samples]
+    {
+        Ace.Init();
+
+        var payload = args.Length > 1 ? ulong.Parse(args[1], CultureInfo.InvariantCulture) : 1_024;
+        var samples = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 10_000;
+        PingPongTest.Run(payload, samples);
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "8": // Fan-Out / Fan-In Scaling Test: 8 [payload] [samples per writer] [instances]
+    {
+        Ace.Init();
+
+        var payload = args.Length > 1 ? ulong.Parse(args[1], CultureInfo.InvariantCulture) : 1_024;
+        var samples = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 10_000;
+        var instances = args.Length > 3 ? int.Parse(args[3], CultureInfo.InvariantCulture) : 1;
+        ScalingTest.Run(payload, samples, instances);
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "9": // Instance Count Scaling Test: 9 [payload] [max instances] [samples per instance]
+    {
+        Ace.Init();
+
+        var payload = args.Length > 1 ? ulong.Parse(args[1], CultureInfo.InvariantCulture) : 64;
+        var maxInstances = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 1_000_000;
+        var samples = args.Length > 3 ? int.Parse(args[3], CultureInfo.InvariantCulture) : 2;
+        InstanceScalingTest.Run(payload, maxInstances, samples);
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "10": // Native Wrapper Overhead Test: 10 [samples]
+    {
+        Ace.Init();
+
+        var samples = args.Length > 1 ? int.Parse(args[1], CultureInfo.InvariantCulture) : 10_000;
+        WrapperOverheadTest.Run(samples, Path.Combine(artifactsPath, "wrapper-overhead.csv"));
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "11": // Discovery and Time-to-First-Sample Test: 11 [max participants] [topics per participant]
+    {
+        Ace.Init();
+
+        var maxParticipants = args.Length > 1 ? int.Parse(args[1], CultureInfo.InvariantCulture) : 16;
+        var endpoints = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 10;
+        DiscoveryTest.Run(maxParticipants, endpoints, Path.Combine(artifactsPath, "discovery.csv"));
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "12": // Type Shape Test: 12 [payload] [throughput samples] [latency samples]
+    {
+        Ace.Init();
+
+        var payload = args.Length > 1 ? ulong.Parse(args[1], CultureInfo.InvariantCulture) : 1_024;
+        var throughputSamples = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 10_000;
+        var latencySamples = args.Length > 3 ? int.Parse(args[3], CultureInfo.InvariantCulture) : 1_000;
+        TypeShapeTest.Run(payload, throughputSamples, latencySamples, Path.Combine(artifactsPath, "type-shapes.csv"));
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "13": // Receive Strategy Test: 13 [payload] [seconds per rate]
+    {
+        Ace.Init();
+
+        var payload = args.Length > 1 ? ulong.Parse(args[1], CultureInfo.InvariantCulture) : 512;
+        var seconds = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 5;
+        ReceiveStrategyTest.Run(payload, seconds, Path.Combine(artifactsPath, "receive-strategies.csv"));
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "14": // Sustained Rate Throughput Test: 14 [payload] [seconds per rate]
+    {
+        Ace.Init();
+
+        var payload = args.Length > 1 ? ulong.Parse(args[1], CultureInfo.InvariantCulture) : 1_024;
+        var seconds = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 3;
+        SustainedRateTest.Run(payload, seconds, Path.Combine(artifactsPath, "sustained-rate.csv"));
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "--peer": // Peer process of the same-host and ping-pong tests: --peer <transport> <topic prefix> <payload>
+    {
+        Ace.Init();
+
+        SameHostTest.RunPeer(args[1], args[2], ulong.Parse(args[3], CultureInfo.InvariantCulture));
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+    case "--discovery-peer": // Peer process of the discovery test: --discovery-peer <discovery> <resend ms> <domain> <participants> <topics> <timeout ms> <topic prefix>
+    {
+        Ace.Init();
+
+        DiscoveryTest.RunPeer(args[1], int.Parse(args[2], CultureInfo.InvariantCulture), int.Parse(args[3], CultureInfo.InvariantCulture),
+            int.Parse(args[4], CultureInfo.InvariantCulture), int.Parse(args[5], CultureInfo.InvariantCulture),
+            int.Parse(args[6], CultureInfo.InvariantCulture), args[7]);
+
+        TransportRegistry.Instance.Release();
+        ParticipantService.Instance.Shutdown();
+
+        Ace.Fini();
+        break;
+    }
+}
@@ -0,0 +1,157 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS.
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Linq;
+using System.Threading;
+using CdrWrapperInclude;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using OpenDDSharp.DDS;
+using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.UnitTest.Helpers;
+
+namespace OpenDDSharp.UnitTest
+{
+    /// <summary>
+    /// <see cref="AllocAccounting"/> unit test class.
+    /// </summary>
+    [TestClass]
+    public class AllocAccountingTest
+    {
+        #region Constants
+        private const string TEST_CATEGORY = "AllocAccounting";
+        #endregion
+
+        #region Test Methods
+        /// <summary>
+        /// Test the <see cref="AllocAccounting.GetSnapshot" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestGetSnapshot()
+        {
+            if (!AllocAccounting.Enabled)
+            {
+                Assert.AreEqual(IntPtr.Zero, AllocAccounting.NativeHooks);
+                Assert.AreEqual(0, AllocAccounting.GetSnapshot().Count);
+                Assert.Inconclusive("The native libraries were built without OPENDDSHARP_ALLOC_ACCOUNTING.");
+            }
+
+            Assert.AreNotEqual(IntPtr.Zero, AllocAccounting.NativeHooks);
+            AllocAccounting.Reset();
+
+            var participant = AssemblyInitializer.Factory.CreateParticipant(AssemblyInitializer.RTPS_DOMAIN);
+            Assert.IsNotNull(participant);
+            try
+            {
+                var qos = new DomainParticipantQos();
+                Assert.AreEqual(ReturnCode.Ok, participant.GetQos(qos));
+
+                var site = AllocAccounting.GetSnapshot().SingleOrDefault(s => s.EntryPoint == "DomainParticipant_GetQos");
+                Assert.AreEqual("DomainParticipant_GetQos", site.EntryPoint);
+                Assert.IsTrue(site.Allocations > 0);
+                Assert.IsTrue(site.Bytes > 0);
+                Assert.IsTrue(site.Releases <= site.Allocations);
+                Assert.AreEqual(site.Allocations - site.Releases, site.LiveAllocations);
+            }
+            finally
+            {
+                participant.DeleteContainedEntities();
+                AssemblyInitializer.Factory.DeleteParticipant(participant);
+            }
+        }
+
+        /// <summary>
+        /// Test that the buffers handed to .NET by the generated wrapper stay live until they are released.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestGeneratedLiveAllocations()
+        {
+            if (!AllocAccounting.Enabled)
+            {
+                Assert.Inconclusive("The native libraries were built without OPENDDSHARP_ALLOC_ACCOUNTING.");
+            }
+
+            var participant = AssemblyInitializer.Factory.CreateParticipant(AssemblyInitializer.RTPS_DOMAIN);
+            Assert.IsNotNull(participant);
+            participant.BindRtpsUdpTransportConfig();
+            try
+            {
+                var typeSupport = new TestIncludeTypeSupport();
+                var typeName = typeSupport.GetTypeName();
+                Assert.AreEqual(ReturnCode.Ok, typeSupport.RegisterType(participant, typeName));
+
+                var topic = participant.CreateTopic(nameof(TestGeneratedLiveAllocations), typeName);
+                Assert.IsNotNull(topic);
+                var publisher = participant.CreatePublisher();
+                Assert.IsNotNull(publisher);
+                var subscriber = participant.CreateSubscriber();
+                Assert.IsNotNull(subscriber);
+
+                var drQos = new DataReaderQos
+                {
+                    Reliability =
+                    {
+                        Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                    },
+                };
+                var dr = subscriber.CreateDataReader(topic, drQos);
+                Assert.IsNotNull(dr);
+                var dataReader = new TestIncludeDataReader(dr);
+                var dw = publisher.CreateDataWriter(topic);
+                Assert.IsNotNull(dw);
+                var dataWriter = new TestIncludeDataWriter(dw);
+
+                Assert.IsTrue(dataWriter.WaitForSubscriptions(1, 5000));
+                Assert.IsTrue(dataReader.WaitForPublications(1, 5000));
+
+                using var evt = new ManualResetEventSlim(false);
+                var statusCondition = dr.StatusCondition;
+                statusCondition.EnabledStatuses = StatusKind.DataAvailableStatus;
+                TestHelper.CreateWaitSetThread(evt, statusCondition);
+
+                AllocAccounting.Reset();
+
+                Assert.AreEqual(ReturnCode.Ok, dataWriter.Write(new TestInclude { Id = "1" }));
+                Assert.IsTrue(evt.Wait(1_500));
+
+                var data = new TestInclude();
+                var info = new SampleInfo();
+                Assert.AreEqual(ReturnCode.Ok, dataReader.TakeNextSample(data, info));
+                Assert.AreEqual("1", data.Id);
+
+                // The sample and sample info buffers are released once copied to the managed objects.
+                var site = AllocAccounting.GetSnapshot().SingleOrDefault(s => s.EntryPoint.EndsWith("DataReader_TakeNextSample_Cdr", StringComparison.Ordinal));
+                StringAssert.EndsWith(site.EntryPoint, "DataReader_TakeNextSample_Cdr");
+                Assert.IsTrue(site.Allocations > 0);
+                Assert.IsTrue(site.Bytes > 0);
+                Assert.AreEqual(site.Allocations, site.Releases);
+                Assert.AreEqual(0UL, site.LiveAllocations);
+                Assert.AreEqual(0UL, site.LiveBytes);
+            }
+            finally
+            {
+                participant.DeleteContainedEntities();
+                AssemblyInitializer.Factory.DeleteParticipant(participant);
+            }
+        }
+        #endregion
+    }
+}
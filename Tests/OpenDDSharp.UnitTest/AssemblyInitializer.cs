@@ -82,7 +82,7 @@ namespace OpenDDSharp.UnitTest
             _infoProcess = _supportProcess.SpawnDCPSInfoRepo();
             System.Threading.Thread.Sleep(1000);
 
-            Factory = ParticipantService.Instance.GetDomainParticipantFactory("-DCPSPendingTimeout", "3");
+            Factory = ParticipantService.Instance.GetDomainParticipantFactory("-DCPSPendingTimeout", "3", "-DCPSThreadStatusInterval", "1");
 
             Assert.IsFalse(TransportRegistry.Instance.Released);
             Assert.IsFalse(ParticipantService.Instance.IsShutdown);
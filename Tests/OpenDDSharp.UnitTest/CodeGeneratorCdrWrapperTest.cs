@@ -1,13 +1,16 @@
 using System;
 using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
+using System.Globalization;
 using System.Linq;
 using System.Threading;
 using CdrWrapper;
 using CdrWrapperInclude;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 using OpenDDSharp.DDS;
+using OpenDDSharp.OpenDDS.DCPS;
 using OpenDDSharp.UnitTest.Helpers;
+using OpenDDSharp.UnitTest.Listeners;
 
 namespace OpenDDSharp.UnitTest
 {
@@ -2360,6 +2363,375 @@ namespace OpenDDSharp.UnitTest
             Assert.AreEqual("君たちの基地はすべて我々のもの", TEST_WSTRING_CONST.Value);
             Assert.AreEqual(TestEnum.ENUM6, TEST_ENUM_CONST.Value);
         }
+
+        /// <summary>
+        /// Test the wrapper metrics snapshot of the generated type support.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestWrapperMetrics()
+        {
+            var typeSupport = new TestIncludeTypeSupport();
+            var typeName = typeSupport.GetTypeName();
+            var ret = typeSupport.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            _topic = _participant.CreateTopic(nameof(TestWrapperMetrics), typeName);
+            Assert.IsNotNull(_topic);
+
+            var dw = _publisher.CreateDataWriter(_topic);
+            Assert.IsNotNull(dw);
+            var dataWriter = new TestIncludeDataWriter(dw);
+
+            ret = dataWriter.Write(new TestInclude
+            {
+                Id = "1",
+                IncludeField = new IncludeStruct
+                {
+                    Message = "Test",
+                },
+            });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            // The test type support library is compiled with OPENDDSHARP_WRAPPER_METRICS.
+            var metrics = typeSupport.GetWrapperMetrics();
+            Assert.IsNotNull(metrics);
+            var writerMetrics = metrics.SingleOrDefault(m => m.Entity == dw.ToNative());
+            Assert.IsNotNull(writerMetrics);
+            Assert.AreEqual(Enum.GetValues(typeof(WrapperMetricsStage)).Length, writerMetrics.Stages.Count);
+            Assert.AreEqual(1UL, writerMetrics.Stages[WrapperMetricsStage.Deserialize].Count);
+            Assert.IsTrue(writerMetrics.Stages[WrapperMetricsStage.Deserialize].Bytes > 0);
+            Assert.AreEqual(1UL, writerMetrics.Stages[WrapperMetricsStage.Dds].Count);
+            Assert.AreEqual(1UL, writerMetrics.Stages[WrapperMetricsStage.Dds].Histogram.Aggregate(0UL, (a, b) => a + b));
+
+            typeSupport.ResetWrapperMetrics();
+            metrics = typeSupport.GetWrapperMetrics();
+            Assert.IsNotNull(metrics);
+            Assert.IsTrue(metrics.All(m => m.Stages.Values.All(s => s.Count == 0 && s.Bytes == 0 && s.Histogram.All(b => b == 0))));
+
+            // The counting continues from the reset.
+            ret = dataWriter.Write(new TestInclude
+            {
+                Id = "2",
+                IncludeField = new IncludeStruct
+                {
+                    Message = "Test",
+                },
+            });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            writerMetrics = typeSupport.GetWrapperMetrics().SingleOrDefault(m => m.Entity == dw.ToNative());
+            Assert.IsNotNull(writerMetrics);
+            Assert.AreEqual(1UL, writerMetrics.Stages[WrapperMetricsStage.Deserialize].Count);
+            Assert.AreEqual(1UL, writerMetrics.Stages[WrapperMetricsStage.Dds].Count);
+
+            // The metrics of a deleted writer are released.
+            var native = dw.ToNative();
+            ret = _publisher.DeleteDataWriter(dw);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+            Assert.IsFalse(typeSupport.GetWrapperMetrics().Any(m => m.Entity == native));
+        }
+
+        /// <summary>
+        /// Test the native latency histogram of the generated data reader.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestLatencyHistogram()
+        {
+            using var evt = new ManualResetEventSlim(false);
+
+            var typeSupport = new TestIncludeTypeSupport();
+            var typeName = typeSupport.GetTypeName();
+            var ret = typeSupport.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            _topic = _participant.CreateTopic(nameof(TestLatencyHistogram), typeName);
+            Assert.IsNotNull(_topic);
+
+            var drQos = new DataReaderQos
+            {
+                Reliability =
+                {
+                    Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                },
+            };
+            var dr = _subscriber.CreateDataReader(_topic, drQos);
+            Assert.IsNotNull(dr);
+            var dataReader = new TestIncludeDataReader(dr);
+
+            var dw = _publisher.CreateDataWriter(_topic);
+            Assert.IsNotNull(dw);
+            var dataWriter = new TestIncludeDataWriter(dw);
+
+            Assert.IsTrue(dataWriter.WaitForSubscriptions(1, 5000));
+            Assert.IsTrue(dataReader.WaitForPublications(1, 5000));
+
+            Assert.IsNull(dataReader.GetLatencyHistogram());
+            Assert.IsTrue(dataReader.EnableLatencyHistogram(true));
+
+            var histogram = dataReader.GetLatencyHistogram();
+            Assert.IsNotNull(histogram);
+            Assert.AreEqual(0UL, histogram.Count);
+            Assert.AreEqual(0UL, histogram.GetPercentile(99));
+
+            var statusCondition = dr.StatusCondition;
+            Assert.IsNotNull(statusCondition);
+            statusCondition.EnabledStatuses = StatusKind.DataAvailableStatus;
+            TestHelper.CreateWaitSetThread(evt, statusCondition);
+
+            ret = dataWriter.Write(new TestInclude
+            {
+                Id = "1",
+                IncludeField = new IncludeStruct
+                {
+                    Message = "Test",
+                },
+            });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            ret = dataWriter.WaitForAcknowledgments(new Duration { Seconds = 5 });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            Assert.IsTrue(evt.Wait(1_500));
+
+            // A read followed by a take of the same sample is only recorded once.
+            var data = new List<TestInclude>();
+            var infos = new List<SampleInfo>();
+            ret = dataReader.Read(data, infos);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+            ret = dataReader.Take(data, infos);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+            Assert.AreEqual(1, data.Count);
+
+            histogram = dataReader.GetLatencyHistogram();
+            Assert.IsNotNull(histogram);
+            Assert.AreEqual(1UL, histogram.Count);
+            Assert.AreEqual(histogram.Min, histogram.Max);
+            Assert.AreEqual(histogram.Sum, histogram.Max);
+            Assert.IsTrue(histogram.GetPercentile(50) <= histogram.Max);
+            Assert.AreEqual(1UL, histogram.Buckets.Aggregate(0UL, (total, b) => total + b));
+
+            var merged = dataReader.GetLatencyHistogram();
+            merged.Merge(histogram);
+            Assert.AreEqual(2UL, merged.Count);
+            Assert.AreEqual(histogram.Min, merged.Min);
+            Assert.AreEqual(histogram.Max, merged.Max);
+            Assert.AreEqual(histogram.Sum * 2, merged.Sum);
+
+            dataReader.ResetLatencyHistogram();
+            histogram = dataReader.GetLatencyHistogram();
+            Assert.IsNotNull(histogram);
+            Assert.AreEqual(0UL, histogram.Count);
+
+            Assert.IsTrue(dataReader.EnableLatencyHistogram(false));
+            Assert.IsNull(dataReader.GetLatencyHistogram());
+
+            // Deleting a reader releases its histogram, a new reader never inherits it.
+            Assert.IsTrue(dataReader.EnableLatencyHistogram(true));
+            Assert.AreEqual(ReturnCode.Ok, _subscriber.DeleteDataReader(dr));
+
+            dr = _subscriber.CreateDataReader(_topic, drQos);
+            Assert.IsNotNull(dr);
+            dataReader = new TestIncludeDataReader(dr);
+            Assert.IsNull(dataReader.GetLatencyHistogram());
+
+            _publisher.DeleteDataWriter(dw);
+            _subscriber.DeleteDataReader(dr);
+        }
+
+        /// <summary>
+        /// Test the lifecycle trace of the generated data reader without listener.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestLifecycleTrace()
+        {
+            using var evt = new ManualResetEventSlim(false);
+
+            var typeSupport = new TestIncludeTypeSupport();
+            var typeName = typeSupport.GetTypeName();
+            var ret = typeSupport.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            _topic = _participant.CreateTopic(nameof(TestLifecycleTrace), typeName);
+            Assert.IsNotNull(_topic);
+
+            var drQos = new DataReaderQos
+            {
+                Reliability =
+                {
+                    Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                },
+            };
+            var dr = _subscriber.CreateDataReader(_topic, drQos);
+            Assert.IsNotNull(dr);
+            var dataReader = new TestIncludeDataReader(dr);
+
+            var dw = _publisher.CreateDataWriter(_topic);
+            Assert.IsNotNull(dw);
+            var dataWriter = new TestIncludeDataWriter(dw);
+
+            Assert.IsTrue(dataWriter.WaitForSubscriptions(1, 5000));
+            Assert.IsTrue(dataReader.WaitForPublications(1, 5000));
+
+            Assert.IsNull(LifecycleTrace.GetStatistics(dr));
+            Assert.IsTrue(LifecycleTrace.Enable(dr, true));
+
+            var statistics = LifecycleTrace.GetStatistics(dr);
+            Assert.IsNotNull(statistics);
+            Assert.AreEqual(0UL, statistics.EndToEnd.Count);
+            Assert.AreEqual(0UL, statistics.Transport.Count);
+
+            var statusCondition = dr.StatusCondition;
+            Assert.IsNotNull(statusCondition);
+            statusCondition.EnabledStatuses = StatusKind.DataAvailableStatus;
+            TestHelper.CreateWaitSetThread(evt, statusCondition);
+
+            ret = dataWriter.Write(new TestInclude
+            {
+                Id = "1",
+                IncludeField = new IncludeStruct
+                {
+                    Message = "Test",
+                },
+            });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            ret = dataWriter.WaitForAcknowledgments(new Duration { Seconds = 5 });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            Assert.IsTrue(evt.Wait(1_500));
+
+            // A read followed by a take of the same sample counts once.
+            var data = new List<TestInclude>();
+            var infos = new List<SampleInfo>();
+            ret = dataReader.Read(data, infos);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+            Assert.AreEqual(1, infos.Count);
+
+            ret = dataReader.Take(data, infos);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+            Assert.AreEqual(1, data.Count);
+
+            // Without listener there is no dispatch and no notification to measure the cache dwell from.
+            statistics = LifecycleTrace.GetStatistics(dr);
+            Assert.IsNotNull(statistics);
+            Assert.AreEqual(1UL, statistics.Transport.Count);
+            Assert.AreEqual(0UL, statistics.Dispatch.Count);
+            Assert.AreEqual(0UL, statistics.CacheDwell.Count);
+            Assert.AreEqual(1UL, statistics.EndToEnd.Count);
+            Assert.AreEqual(statistics.EndToEnd.Min, statistics.EndToEnd.Max);
+            Assert.AreEqual(statistics.EndToEnd.Sum, statistics.EndToEnd.Max);
+
+            LifecycleTrace.Reset(dr);
+            statistics = LifecycleTrace.GetStatistics(dr);
+            Assert.IsNotNull(statistics);
+            Assert.AreEqual(0UL, statistics.EndToEnd.Count);
+            Assert.AreEqual(0UL, statistics.Transport.Count);
+
+            Assert.IsTrue(LifecycleTrace.Enable(dr, false));
+            Assert.IsNull(LifecycleTrace.GetStatistics(dr));
+
+            // Deleting a traced reader releases its trace, a new reader never inherits it.
+            Assert.IsTrue(LifecycleTrace.Enable(dr, true));
+            Assert.AreEqual(ReturnCode.Ok, _subscriber.DeleteDataReader(dr));
+
+            dr = _subscriber.CreateDataReader(_topic, drQos);
+            Assert.IsNotNull(dr);
+            Assert.IsNull(LifecycleTrace.GetStatistics(dr));
+
+            _publisher.DeleteDataWriter(dw);
+            _subscriber.DeleteDataReader(dr);
+        }
+
+        /// <summary>
+        /// Test the lifecycle trace of the generated data reader taking the samples from the listener.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestLifecycleTraceListener()
+        {
+            const int total = 5;
+
+            using var received = new SemaphoreSlim(0);
+
+            var typeSupport = new TestIncludeTypeSupport();
+            var typeName = typeSupport.GetTypeName();
+            var ret = typeSupport.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            _topic = _participant.CreateTopic(nameof(TestLifecycleTraceListener), typeName);
+            Assert.IsNotNull(_topic);
+
+            var drQos = new DataReaderQos
+            {
+                Reliability =
+                {
+                    Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                },
+            };
+            var dr = _subscriber.CreateDataReader(_topic, drQos);
+            Assert.IsNotNull(dr);
+            var dataReader = new TestIncludeDataReader(dr);
+
+            var dw = _publisher.CreateDataWriter(_topic);
+            Assert.IsNotNull(dw);
+            var dataWriter = new TestIncludeDataWriter(dw);
+
+            Assert.IsTrue(dataWriter.WaitForSubscriptions(1, 5000));
+            Assert.IsTrue(dataReader.WaitForPublications(1, 5000));
+
+            Assert.IsTrue(LifecycleTrace.Enable(dr, true));
+
+            var listener = new MyDataReaderListener
+            {
+                DataAvailable = _ =>
+                {
+                    var data = new List<TestInclude>();
+                    var infos = new List<SampleInfo>();
+                    if (dataReader.Take(data, infos) == ReturnCode.Ok)
+                    {
+                        received.Release(data.Count);
+                    }
+                },
+            };
+            ret = dr.SetListener(listener, StatusMask.DataAvailableStatus);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            // Each sample is taken before the next one is written, so each one gets its own notification.
+            for (var i = 0; i < total; i++)
+            {
+                ret = dataWriter.Write(new TestInclude
+                {
+                    Id = i.ToString(CultureInfo.InvariantCulture),
+                    IncludeField = new IncludeStruct
+                    {
+                        Message = "Test",
+                    },
+                });
+                Assert.AreEqual(ReturnCode.Ok, ret);
+
+                Assert.IsTrue(received.Wait(5_000));
+            }
+
+            ret = dr.SetListener(null, StatusMask.NoStatusMask);
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            var statistics = LifecycleTrace.GetStatistics(dr);
+            Assert.IsNotNull(statistics);
+            Assert.AreEqual((ulong)total, statistics.Transport.Count);
+            Assert.AreEqual((ulong)total, statistics.Dispatch.Count);
+            Assert.AreEqual((ulong)total, statistics.CacheDwell.Count);
+            Assert.AreEqual((ulong)total, statistics.EndToEnd.Count);
+            Assert.IsTrue(statistics.Dispatch.Min <= statistics.Dispatch.Max);
+            Assert.IsTrue(statistics.CacheDwell.Min <= statistics.CacheDwell.Max);
+
+            Assert.IsTrue(LifecycleTrace.Enable(dr, false));
+
+            _publisher.DeleteDataWriter(dw);
+            _subscriber.DeleteDataReader(dr);
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -241,6 +241,89 @@ namespace OpenDDSharp.UnitTest
             Assert.AreEqual(ReturnCode.Ok, result);
         }
 
+        /// <summary>
+        /// Test the <see cref="DomainParticipant.FastDeleteContainedEntities(int, TeardownTimings)" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestFastDeleteContainedEntities()
+        {
+            var support = new TestStructTypeSupport();
+            var typeName = support.GetTypeName();
+            var result = support.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            var topic = _participant.CreateTopic(nameof(TestFastDeleteContainedEntities), typeName);
+            Assert.IsNotNull(topic);
+
+            // The endpoint listeners are detached before anything is deleted
+            using var writerListener = new MyDataWriterListener();
+            using var readerListener = new MyDataReaderListener();
+            var listenedPublisher = _participant.CreatePublisher();
+            Assert.IsNotNull(listenedPublisher);
+            var listenedWriter = listenedPublisher.CreateDataWriter(topic, null, writerListener);
+            Assert.IsNotNull(listenedWriter);
+            Assert.AreSame(writerListener, listenedWriter.Listener);
+
+            var listenedSubscriber = _participant.CreateSubscriber();
+            Assert.IsNotNull(listenedSubscriber);
+            var listenedReader = listenedSubscriber.CreateDataReader(topic, null, readerListener);
+            Assert.IsNotNull(listenedReader);
+            Assert.AreSame(readerListener, listenedReader.Listener);
+
+            var handles = new List<InstanceHandle>
+            {
+                topic.InstanceHandle,
+                listenedPublisher.InstanceHandle,
+                listenedWriter.InstanceHandle,
+                listenedSubscriber.InstanceHandle,
+                listenedReader.InstanceHandle,
+            };
+            for (var i = 0; i < 4; i++)
+            {
+                var pub = _participant.CreatePublisher();
+                Assert.IsNotNull(pub);
+                handles.Add(pub.InstanceHandle);
+
+                var sub = _participant.CreateSubscriber();
+                Assert.IsNotNull(sub);
+                handles.Add(sub.InstanceHandle);
+
+                for (var j = 0; j < 5; j++)
+                {
+                    var dataWriter = pub.CreateDataWriter(topic);
+                    Assert.IsNotNull(dataWriter);
+                    handles.Add(dataWriter.InstanceHandle);
+
+                    var dataReader = sub.CreateDataReader(topic);
+                    Assert.IsNotNull(dataReader);
+                    handles.Add(dataReader.InstanceHandle);
+                }
+            }
+
+            var timings = new TeardownTimings();
+            result = _participant.FastDeleteContainedEntities(2, timings);
+            Assert.AreEqual(ReturnCode.Ok, result);
+            Assert.AreEqual(2, timings.Threads);
+            Assert.IsTrue(timings.Endpoints >= TimeSpan.Zero);
+            Assert.IsTrue(timings.ContainedEntities >= TimeSpan.Zero);
+            Assert.AreEqual(TimeSpan.Zero, timings.Participants);
+            Assert.AreEqual(TimeSpan.Zero, timings.Shutdown);
+            Assert.IsNull(listenedWriter.Listener);
+            Assert.IsNull(listenedReader.Listener);
+
+            foreach (var handle in handles)
+            {
+                Assert.IsFalse(_participant.ContainsEntity(handle));
+            }
+
+            Assert.IsNull(_participant.LookupTopicDescription(nameof(TestFastDeleteContainedEntities)));
+
+            // Nothing left to delete
+            result = _participant.FastDeleteContainedEntities();
+            Assert.AreEqual(ReturnCode.Ok, result);
+        }
+
         /// <summary>
         /// Test the default values for a new <see cref="TopicQos"/>.
         /// </summary>
@@ -1662,6 +1745,238 @@ namespace OpenDDSharp.UnitTest
             result = _participant.DeleteMultiTopic(null);
             Assert.AreEqual(ReturnCode.Ok, result);
         }
+
+        /// <summary>
+        /// Test the <see cref="DomainParticipant.CreateEndpoints(Publisher, Subscriber, IList{EndpointSpec}, ICollection{EndpointResult}, bool)" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestCreateEndpoints()
+        {
+            var support = new TestStructTypeSupport();
+            var typeName = support.GetTypeName();
+            var result = support.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            // The batch is created under the factory QoS of the publisher and subscriber
+            var pubQos = new PublisherQos
+            {
+                EntityFactory =
+                {
+                    AutoenableCreatedEntities = false,
+                },
+            };
+            var publisher = _participant.CreatePublisher(pubQos);
+            Assert.IsNotNull(publisher);
+
+            var subQos = new SubscriberQos
+            {
+                EntityFactory =
+                {
+                    AutoenableCreatedEntities = false,
+                },
+            };
+            var subscriber = _participant.CreateSubscriber(subQos);
+            Assert.IsNotNull(subscriber);
+
+            using var profile = new QosProfile();
+            var dwQos = new DataWriterQos
+            {
+                Reliability =
+                {
+                    Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                },
+            };
+            result = profile.SetDataWriterQos(dwQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            var drQos = new DataReaderQos
+            {
+                Reliability =
+                {
+                    Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                },
+            };
+            result = profile.SetDataReaderQos(drQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            var specs = new List<EndpointSpec>();
+            for (var i = 0; i < 3; i++)
+            {
+                specs.Add(new EndpointSpec
+                {
+                    TopicName = nameof(TestCreateEndpoints) + i,
+                    TypeName = typeName,
+                    Kind = EndpointKind.DataWriter,
+                    Profile = profile,
+                });
+                specs.Add(new EndpointSpec
+                {
+                    TopicName = nameof(TestCreateEndpoints) + i,
+                    TypeName = typeName,
+                    Kind = EndpointKind.DataReader,
+                    Profile = profile,
+                });
+            }
+
+            // Create the batch without enabling the endpoints
+            var results = new List<EndpointResult>();
+            result = _participant.CreateEndpoints(publisher, subscriber, specs, results, false);
+            Assert.AreEqual(ReturnCode.Ok, result);
+            Assert.AreEqual(specs.Count, results.Count);
+
+            for (var i = 0; i < results.Count; i++)
+            {
+                Assert.AreEqual(ReturnCode.Ok, results[i].ReturnCode);
+                Assert.IsNotNull(results[i].Topic);
+                Assert.AreEqual(specs[i].TopicName, results[i].Topic.Name);
+                Assert.AreEqual(typeName, results[i].Topic.TypeName);
+                Assert.AreSame(_participant, results[i].Topic.Participant);
+
+                if (specs[i].Kind == EndpointKind.DataWriter)
+                {
+                    Assert.IsNotNull(results[i].DataWriter);
+                    Assert.IsNull(results[i].DataReader);
+                    Assert.AreSame(publisher, results[i].DataWriter.Publisher);
+                    Assert.AreEqual(ReturnCode.NotEnabled, results[i].DataWriter.AssertLiveliness());
+
+                    var qos = new DataWriterQos();
+                    Assert.AreEqual(ReturnCode.Ok, results[i].DataWriter.GetQos(qos));
+                    Assert.AreEqual(ReliabilityQosPolicyKind.ReliableReliabilityQos, qos.Reliability.Kind);
+                }
+                else
+                {
+                    Assert.IsNotNull(results[i].DataReader);
+                    Assert.IsNull(results[i].DataWriter);
+                    Assert.AreSame(subscriber, results[i].DataReader.Subscriber);
+                    Assert.AreSame(results[i - 1].Topic, results[i].Topic);
+
+                    var qos = new DataReaderQos();
+                    Assert.AreEqual(ReturnCode.Ok, results[i].DataReader.GetQos(qos));
+                    Assert.AreEqual(ReliabilityQosPolicyKind.ReliableReliabilityQos, qos.Reliability.Kind);
+                }
+            }
+
+            // The factory QoS of the publisher and subscriber is left untouched
+            pubQos = new PublisherQos();
+            Assert.AreEqual(ReturnCode.Ok, publisher.GetQos(pubQos));
+            Assert.IsFalse(pubQos.EntityFactory.AutoenableCreatedEntities);
+            subQos = new SubscriberQos();
+            Assert.AreEqual(ReturnCode.Ok, subscriber.GetQos(subQos));
+            Assert.IsFalse(subQos.EntityFactory.AutoenableCreatedEntities);
+
+            // Create a new batch enabling the endpoints
+            specs.Clear();
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Enabled",
+                TypeName = typeName,
+                Kind = EndpointKind.DataWriter,
+                Profile = profile,
+            });
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Enabled",
+                TypeName = typeName,
+                Kind = EndpointKind.DataReader,
+            });
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Wrong",
+                TypeName = "UnknownType",
+                Kind = EndpointKind.DataReader,
+            });
+
+            result = _participant.CreateEndpoints(publisher, subscriber, specs, results, true);
+            Assert.AreEqual(ReturnCode.Error, result);
+            Assert.AreEqual(specs.Count, results.Count);
+            Assert.AreEqual(ReturnCode.Ok, results[0].ReturnCode);
+            Assert.AreEqual(ReturnCode.Ok, results[1].ReturnCode);
+            Assert.AreEqual(ReturnCode.Error, results[2].ReturnCode);
+            Assert.IsNull(results[2].Topic);
+            Assert.IsNull(results[2].DataReader);
+
+            Assert.AreEqual(ReturnCode.Ok, results[0].DataWriter.AssertLiveliness());
+            Assert.IsTrue(results[0].DataWriter.WaitForSubscriptions(1, 5_000));
+            Assert.IsTrue(results[1].DataReader.WaitForPublications(1, 5_000));
+
+            // A later spec of the same topic name must match the type and QoS of the topic created for the batch
+            var otherSupport = new TestIncludeTypeSupport();
+            var otherTypeName = otherSupport.GetTypeName();
+            result = otherSupport.RegisterType(_participant, otherTypeName);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            using var topicProfile = new QosProfile();
+            var topicQos = new TopicQos
+            {
+                Durability =
+                {
+                    Kind = DurabilityQosPolicyKind.TransientLocalDurabilityQos,
+                },
+            };
+            result = topicProfile.SetTopicQos(topicQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            specs.Clear();
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Mismatch",
+                TypeName = typeName,
+                Kind = EndpointKind.DataWriter,
+            });
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Mismatch",
+                TypeName = otherTypeName,
+                Kind = EndpointKind.DataReader,
+            });
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Mismatch",
+                TypeName = typeName,
+                Kind = EndpointKind.DataReader,
+                Profile = topicProfile,
+            });
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "Mismatch",
+                TypeName = typeName,
+                Kind = EndpointKind.DataReader,
+            });
+
+            result = _participant.CreateEndpoints(publisher, subscriber, specs, results, false);
+            Assert.AreEqual(ReturnCode.PreconditionNotMet, result);
+            Assert.AreEqual(specs.Count, results.Count);
+            Assert.AreEqual(ReturnCode.Ok, results[0].ReturnCode);
+            Assert.AreEqual(ReturnCode.PreconditionNotMet, results[1].ReturnCode);
+            Assert.IsNull(results[1].Topic);
+            Assert.IsNull(results[1].DataReader);
+            Assert.AreEqual(ReturnCode.PreconditionNotMet, results[2].ReturnCode);
+            Assert.IsNull(results[2].Topic);
+            Assert.IsNull(results[2].DataReader);
+            Assert.AreEqual(ReturnCode.Ok, results[3].ReturnCode);
+            Assert.AreSame(results[0].Topic, results[3].Topic);
+            Assert.IsNotNull(results[3].DataReader);
+
+            // Test with wrong parameters
+            result = _participant.CreateEndpoints(publisher, subscriber, null, results, true);
+            Assert.AreEqual(ReturnCode.BadParameter, result);
+
+            result = _participant.CreateEndpoints(publisher, subscriber, specs, null, true);
+            Assert.AreEqual(ReturnCode.BadParameter, result);
+
+            specs.Clear();
+            specs.Add(new EndpointSpec
+            {
+                TopicName = nameof(TestCreateEndpoints) + "NoPublisher",
+                TypeName = typeName,
+                Kind = EndpointKind.DataWriter,
+            });
+            result = _participant.CreateEndpoints(null, subscriber, specs, results, true);
+            Assert.AreEqual(ReturnCode.Error, result);
+            Assert.AreEqual(1, results.Count);
+            Assert.AreEqual(ReturnCode.BadParameter, results[0].ReturnCode);
+        }
         #endregion
     }
 }
@@ -0,0 +1,132 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS.
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Diagnostics.CodeAnalysis;
+using System.Linq;
+using System.Threading;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using OpenDDSharp.DDS;
+using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.UnitTest.Helpers;
+
+namespace OpenDDSharp.UnitTest
+{
+    /// <summary>
+    /// <see cref="InternalThreadBuiltinTopicDataDataReader"/> unit test.
+    /// </summary>
+    [TestClass]
+    public class InternalThreadBuiltinTopicDataDataReaderTest
+    {
+        #region Constants
+        private const string TEST_CATEGORY = "InternalThreadBuiltinTopicDataDataReader";
+        #endregion
+
+        #region Fields
+        private DomainParticipant _participant;
+        private Subscriber _subscriber;
+        private DataReader _dataReader;
+        private InternalThreadBuiltinTopicDataDataReader _dr;
+        #endregion
+
+        #region Properties
+        /// <summary>
+        /// Gets or sets access to the <see cref="TestContext"/>.
+        /// </summary>
+        [SuppressMessage("ReSharper", "UnusedAutoPropertyAccessor.Global", Justification = "Required by MSTest")]
+        public TestContext TestContext { get; set; }
+        #endregion
+
+        #region Initialization/Cleanup
+        /// <summary>
+        /// Test the properties default values after calling the constructor.
+        /// </summary>
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            _participant = AssemblyInitializer.Factory.CreateParticipant(AssemblyInitializer.RTPS_DOMAIN);
+            Assert.IsNotNull(_participant);
+            _participant.BindRtpsUdpTransportConfig();
+
+            _subscriber = _participant.GetBuiltinSubscriber();
+            Assert.IsNotNull(_subscriber);
+
+            _dataReader = _subscriber.LookupDataReader(InternalThreadBuiltinTopicDataDataReader.BUILT_IN_INTERNAL_THREAD_TOPIC);
+            Assert.IsNotNull(_dataReader);
+
+            _dr = new InternalThreadBuiltinTopicDataDataReader(_dataReader);
+        }
+
+        /// <summary>
+        /// Test the properties non-default values after calling the constructor.
+        /// </summary>
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _participant?.DeleteContainedEntities();
+            AssemblyInitializer.Factory?.DeleteParticipant(_participant);
+
+            _participant = null;
+            _subscriber = null;
+            _dr = null;
+        }
+        #endregion
+
+        #region Test Methods
+        /// <summary>
+        /// Test the <see cref="InternalThreadBuiltinTopicDataDataReader.GetSnapshot(List{InternalThreadBuiltinTopicData})" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestGetSnapshot()
+        {
+            Assert.AreEqual(ReturnCode.BadParameter, _dr.GetSnapshot(null));
+
+            var snapshot = new List<InternalThreadBuiltinTopicData>();
+            var watch = Stopwatch.StartNew();
+            while (snapshot.Count == 0 && watch.Elapsed < TimeSpan.FromSeconds(5))
+            {
+                Thread.Sleep(250);
+                Assert.AreEqual(ReturnCode.Ok, _dr.GetSnapshot(snapshot));
+            }
+
+            Assert.IsTrue(snapshot.Count > 0);
+            Assert.AreEqual(snapshot.Count, snapshot.Select(s => s.ThreadId).Distinct().Count());
+            foreach (var status in snapshot)
+            {
+                Assert.IsFalse(string.IsNullOrWhiteSpace(status.ThreadId));
+                Assert.IsTrue(status.Utilization >= 0.0 && status.Utilization <= 1.0);
+                Assert.IsTrue(status.Timestamp.Seconds > 0);
+            }
+
+            // The snapshot does not consume the samples.
+            var data = new List<InternalThreadBuiltinTopicData>();
+            var infos = new List<SampleInfo>();
+            Assert.AreEqual(ReturnCode.Ok, _dr.Read(data, infos));
+            Assert.IsTrue(data.Count >= snapshot.Count);
+            Assert.AreEqual(data.Count, infos.Count);
+
+            Assert.AreEqual(ReturnCode.Ok, _dr.Take(data, infos));
+            Assert.IsTrue(data.Count > 0);
+        }
+        #endregion
+    }
+}
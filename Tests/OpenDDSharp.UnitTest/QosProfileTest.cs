@@ -0,0 +1,265 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS.
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using JsonWrapper;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using OpenDDSharp.DDS;
+using OpenDDSharp.UnitTest.Helpers;
+
+namespace OpenDDSharp.UnitTest
+{
+    /// <summary>
+    /// <see cref="QosProfile"/> unit test class.
+    /// </summary>
+    [TestClass]
+    public class QosProfileTest
+    {
+        #region Constants
+        private const string TEST_CATEGORY = "QosProfile";
+        #endregion
+
+        #region Fields
+        private DomainParticipant _participant;
+        private Publisher _publisher;
+        private Subscriber _subscriber;
+        private Topic _topic;
+        private QosProfile _profile;
+        #endregion
+
+        #region Initialization/Cleanup
+        /// <summary>
+        /// The test initializer method.
+        /// </summary>
+        [TestInitialize]
+        public void TestInitialize()
+        {
+            _participant = AssemblyInitializer.Factory.CreateParticipant(AssemblyInitializer.RTPS_DOMAIN);
+            Assert.IsNotNull(_participant);
+            _participant.BindRtpsUdpTransportConfig();
+
+            var support = new TestStructTypeSupport();
+            var typeName = support.GetTypeName();
+            var result = support.RegisterType(_participant, typeName);
+            Assert.AreEqual(ReturnCode.Ok, result);
+
+            _topic = _participant.CreateTopic(nameof(QosProfileTest), typeName);
+            Assert.IsNotNull(_topic);
+
+            _publisher = _participant.CreatePublisher();
+            Assert.IsNotNull(_publisher);
+
+            _subscriber = _participant.CreateSubscriber();
+            Assert.IsNotNull(_subscriber);
+
+            _profile = new QosProfile();
+        }
+
+        /// <summary>
+        /// The test cleanup method.
+        /// </summary>
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            _profile?.Dispose();
+
+            _participant?.DeleteContainedEntities();
+            AssemblyInitializer.Factory?.DeleteParticipant(_participant);
+
+            _profile = null;
+            _topic = null;
+            _publisher = null;
+            _subscriber = null;
+            _participant = null;
+        }
+        #endregion
+
+        #region Test Methods
+        /// <summary>
+        /// Test the <see cref="QosProfile" /> get and set methods.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestGetSetQos()
+        {
+            // Nothing set yet
+            Assert.AreEqual(ReturnCode.NoData, _profile.GetTopicQos(new TopicQos()));
+            Assert.AreEqual(ReturnCode.NoData, _profile.GetDataWriterQos(new DataWriterQos()));
+            Assert.AreEqual(ReturnCode.NoData, _profile.GetDataReaderQos(new DataReaderQos()));
+
+            // Set non-default values and read them back
+            var result = _profile.SetTopicQos(TestHelper.CreateNonDefaultTopicQos());
+            Assert.AreEqual(ReturnCode.Ok, result);
+            var topicQos = new TopicQos();
+            result = _profile.GetTopicQos(topicQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+            TestHelper.TestNonDefaultTopicQos(topicQos);
+
+            result = _profile.SetDataWriterQos(TestHelper.CreateNonDefaultDataWriterQos());
+            Assert.AreEqual(ReturnCode.Ok, result);
+            var dwQos = new DataWriterQos();
+            result = _profile.GetDataWriterQos(dwQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+            TestHelper.TestNonDefaultDataWriterQos(dwQos);
+
+            result = _profile.SetDataReaderQos(TestHelper.CreateNonDefaultDataReaderQos());
+            Assert.AreEqual(ReturnCode.Ok, result);
+            var drQos = new DataReaderQos();
+            result = _profile.GetDataReaderQos(drQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+            TestHelper.TestNonDefaultDataReaderQos(drQos);
+
+            // Inconsistent QoS must be rejected and keep the previous value
+            var badQos = new DataReaderQos
+            {
+                History =
+                {
+                    Kind = HistoryQosPolicyKind.KeepLastHistoryQos,
+                    Depth = 200,
+                },
+                ResourceLimits =
+                {
+                    MaxSamplesPerInstance = 100,
+                },
+            };
+            result = _profile.SetDataReaderQos(badQos);
+            Assert.AreEqual(ReturnCode.InconsistentPolicy, result);
+            drQos = new DataReaderQos();
+            result = _profile.GetDataReaderQos(drQos);
+            Assert.AreEqual(ReturnCode.Ok, result);
+            TestHelper.TestNonDefaultDataReaderQos(drQos);
+
+            // Test with null parameters
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.SetTopicQos(null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.GetTopicQos(null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.SetDataWriterQos(null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.GetDataWriterQos(null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.SetDataReaderQos(null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.GetDataReaderQos(null));
+        }
+
+        /// <summary>
+        /// Test the entities creation using a <see cref="QosProfile" />.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestCreateWithProfile()
+        {
+            // An empty profile creates the entities with the default QoS
+            var topic = _participant.CreateTopicWithProfile(nameof(TestCreateWithProfile), _topic.TypeName, _profile);
+            Assert.IsNotNull(topic);
+            var topicQos = new TopicQos();
+            Assert.AreEqual(ReturnCode.Ok, topic.GetQos(topicQos));
+            TestHelper.TestDefaultTopicQos(topicQos);
+
+            var dw = _publisher.CreateDataWriterWithProfile(_topic, _profile);
+            Assert.IsNotNull(dw);
+            var dwQos = new DataWriterQos();
+            Assert.AreEqual(ReturnCode.Ok, dw.GetQos(dwQos));
+            TestHelper.TestDefaultDataWriterQos(dwQos);
+
+            var dr = _subscriber.CreateDataReaderWithProfile(_topic, _profile);
+            Assert.IsNotNull(dr);
+            var drQos = new DataReaderQos();
+            Assert.AreEqual(ReturnCode.Ok, dr.GetQos(drQos));
+            TestHelper.TestDefaultDataReaderQos(drQos);
+
+            // Set the policies once and reuse them for several entities
+            Assert.AreEqual(ReturnCode.Ok, _profile.SetTopicQos(TestHelper.CreateNonDefaultTopicQos()));
+            Assert.AreEqual(ReturnCode.Ok, _profile.SetDataWriterQos(TestHelper.CreateNonDefaultDataWriterQos()));
+            Assert.AreEqual(ReturnCode.Ok, _profile.SetDataReaderQos(TestHelper.CreateNonDefaultDataReaderQos()));
+
+            var otherTopic = _participant.CreateTopicWithProfile(nameof(TestCreateWithProfile) + "Other", _topic.TypeName, _profile, null, StatusMask.DefaultStatusMask);
+            Assert.IsNotNull(otherTopic);
+            topicQos = new TopicQos();
+            Assert.AreEqual(ReturnCode.Ok, otherTopic.GetQos(topicQos));
+            TestHelper.TestNonDefaultTopicQos(topicQos);
+
+            for (var i = 0; i < 2; i++)
+            {
+                dw = _publisher.CreateDataWriterWithProfile(_topic, _profile, null, StatusMask.DefaultStatusMask);
+                Assert.IsNotNull(dw);
+                Assert.AreSame(_publisher, dw.Publisher);
+                dwQos = new DataWriterQos();
+                Assert.AreEqual(ReturnCode.Ok, dw.GetQos(dwQos));
+                TestHelper.TestNonDefaultDataWriterQos(dwQos);
+
+                dr = _subscriber.CreateDataReaderWithProfile(_topic, _profile, null, StatusMask.DefaultStatusMask);
+                Assert.IsNotNull(dr);
+                Assert.AreSame(_subscriber, dr.Subscriber);
+                drQos = new DataReaderQos();
+                Assert.AreEqual(ReturnCode.Ok, dr.GetQos(drQos));
+                TestHelper.TestNonDefaultDataReaderQos(drQos);
+            }
+
+            // Test with wrong parameters
+            Assert.IsNull(_participant.CreateTopicWithProfile(null, _topic.TypeName, _profile));
+            Assert.ThrowsException<ArgumentNullException>(() => _participant.CreateTopicWithProfile("Topic", _topic.TypeName, null));
+            Assert.ThrowsException<ArgumentNullException>(() => _publisher.CreateDataWriterWithProfile(null, _profile));
+            Assert.ThrowsException<ArgumentNullException>(() => _publisher.CreateDataWriterWithProfile(_topic, null));
+            Assert.ThrowsException<ArgumentNullException>(() => _subscriber.CreateDataReaderWithProfile(null, _profile));
+            Assert.ThrowsException<ArgumentNullException>(() => _subscriber.CreateDataReaderWithProfile(_topic, null));
+        }
+
+        /// <summary>
+        /// Test the <see cref="QosProfile.CopyFrom(DataWriter)" /> and <see cref="DataWriter.SetQosWithProfile(QosProfile)" /> methods.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestCopyFromAndSetQos()
+        {
+            var dw = _publisher.CreateDataWriter(_topic, TestHelper.CreateNonDefaultDataWriterQos());
+            Assert.IsNotNull(dw);
+            var dr = _subscriber.CreateDataReader(_topic, TestHelper.CreateNonDefaultDataReaderQos());
+            Assert.IsNotNull(dr);
+
+            // Without policies in the profile the QoS cannot be set
+            Assert.AreEqual(ReturnCode.PreconditionNotMet, dw.SetQosWithProfile(_profile));
+            Assert.AreEqual(ReturnCode.PreconditionNotMet, dr.SetQosWithProfile(_profile));
+
+            Assert.AreEqual(ReturnCode.Ok, _profile.CopyFrom(_topic));
+            Assert.AreEqual(ReturnCode.Ok, _profile.CopyFrom(dw));
+            Assert.AreEqual(ReturnCode.Ok, _profile.CopyFrom(dr));
+
+            var topicQos = new TopicQos();
+            Assert.AreEqual(ReturnCode.Ok, _profile.GetTopicQos(topicQos));
+            TestHelper.TestDefaultTopicQos(topicQos);
+
+            var dwQos = new DataWriterQos();
+            Assert.AreEqual(ReturnCode.Ok, _profile.GetDataWriterQos(dwQos));
+            TestHelper.TestNonDefaultDataWriterQos(dwQos);
+
+            var drQos = new DataReaderQos();
+            Assert.AreEqual(ReturnCode.Ok, _profile.GetDataReaderQos(drQos));
+            TestHelper.TestNonDefaultDataReaderQos(drQos);
+
+            // Setting the same policies back is always allowed
+            Assert.AreEqual(ReturnCode.Ok, dw.SetQosWithProfile(_profile));
+            Assert.AreEqual(ReturnCode.Ok, dr.SetQosWithProfile(_profile));
+
+            // Test with null parameters
+            Assert.AreEqual(ReturnCode.BadParameter, dw.SetQosWithProfile(null));
+            Assert.AreEqual(ReturnCode.BadParameter, dr.SetQosWithProfile(null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.CopyFrom((Topic)null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.CopyFrom((DataWriter)null));
+            Assert.AreEqual(ReturnCode.BadParameter, _profile.CopyFrom((DataReader)null));
+        }
+        #endregion
+    }
+}
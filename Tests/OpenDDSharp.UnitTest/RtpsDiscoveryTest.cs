@@ -18,6 +18,7 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 using System;
+using System.IO;
 using System.Linq;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 using OpenDDSharp.OpenDDS.RTPS;
@@ -157,6 +158,47 @@ namespace OpenDDSharp.UnitTest
             }
             Assert.IsTrue(exception);
         }
+
+        /// <summary>
+        /// Test the discovery warm-start cache.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestWarmStartCache()
+        {
+            var fileName = Path.Combine(Path.GetTempPath(), nameof(TestWarmStartCache) + ".cache");
+            File.WriteAllLines(fileName, new[] { "# warm-start cache", "127.0.0.1:7410", string.Empty, "127.0.0.1:7412" });
+
+            try
+            {
+                var disc = new RtpsDiscovery(RTPS_DISCOVERY + nameof(TestWarmStartCache));
+                using (var cache = disc.EnableWarmStartCache(fileName))
+                {
+                    Assert.AreEqual(2, cache.Locators.Count);
+                    Assert.IsTrue(disc.SpdpSendAddrs.Contains("127.0.0.1:7410"));
+                    Assert.IsTrue(disc.SpdpSendAddrs.Contains("127.0.0.1:7412"));
+
+                    // Without tracked participants the previous locators are kept.
+                    Assert.IsTrue(cache.Save());
+                }
+
+                var lines = File.ReadAllLines(fileName);
+                Assert.AreEqual(2, lines.Length);
+                Assert.IsTrue(lines.Contains("127.0.0.1:7410"));
+                Assert.IsTrue(lines.Contains("127.0.0.1:7412"));
+
+                // A missing cache file is a cold start.
+                File.Delete(fileName);
+                var cold = new RtpsWarmStartCache(disc, fileName);
+                Assert.AreEqual(0, cold.Load());
+                cold.Dispose();
+                Assert.IsTrue(File.Exists(fileName));
+            }
+            finally
+            {
+                File.Delete(fileName);
+            }
+        }
         #endregion
     }
 }
\ No newline at end of file
@@ -18,8 +18,12 @@ You should have received a copy of the GNU Lesser General Public License
 along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
 **********************************************************************/
 using System.Runtime.InteropServices;
+using System.Threading;
+using CdrWrapperInclude;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
+using OpenDDSharp.DDS;
 using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.UnitTest.Helpers;
 
 namespace OpenDDSharp.UnitTest
 {
@@ -79,6 +83,13 @@ namespace OpenDDSharp.UnitTest
             Assert.IsFalse(rui.ThreadPerConnection);
             Assert.AreEqual(5, rui.ReceiveAddressDuration.Seconds);
             Assert.AreEqual(0, rui.ReceiveAddressDuration.MicroSeconds);
+            Assert.AreEqual(65466U, rui.MaxMessageSize);
+            Assert.AreEqual(1U, rui.AnticipatedFragments);
+            Assert.IsFalse(rui.ResponsiveMode);
+            Assert.IsNotNull(rui.SendDelay);
+            Assert.AreEqual(0, rui.SendDelay.Seconds);
+            Assert.AreEqual(10000, rui.SendDelay.MicroSeconds);
+            Assert.IsFalse(rui.CountMessages);
 
             TransportRegistry.Instance.RemoveInst(rui);
         }
@@ -121,6 +132,15 @@ namespace OpenDDSharp.UnitTest
                     Seconds = 2,
                     MicroSeconds = 100000,
                 },
+                MaxMessageSize = 8192U,
+                AnticipatedFragments = 4U,
+                ResponsiveMode = true,
+                CountMessages = true,
+                SendDelay = new TimeValue
+                {
+                    Seconds = 0,
+                    MicroSeconds = 500,
+                },
             };
 
             rui.SetMulticastGroupAddress("239.255.0.1:7402");
@@ -151,9 +171,115 @@ namespace OpenDDSharp.UnitTest
             Assert.IsTrue(rui.ThreadPerConnection);
             Assert.AreEqual(2, rui.ReceiveAddressDuration.Seconds);
             Assert.AreEqual(100000, rui.ReceiveAddressDuration.MicroSeconds);
+            Assert.AreEqual(8192U, rui.MaxMessageSize);
+            Assert.AreEqual(4U, rui.AnticipatedFragments);
+            Assert.IsTrue(rui.ResponsiveMode);
+            Assert.IsNotNull(rui.SendDelay);
+            Assert.AreEqual(0, rui.SendDelay.Seconds);
+            Assert.AreEqual(500, rui.SendDelay.MicroSeconds);
+            Assert.IsTrue(rui.CountMessages);
 
             TransportRegistry.Instance.RemoveInst(rui);
         }
+
+        /// <summary>
+        /// Test the <see cref="TransportInst.GetStatistics" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestGetStatistics()
+        {
+            var inst = TransportRegistry.Instance.CreateInst(INSTANCE_NAME, TRANSPORT_TYPE);
+            var rui = new RtpsUdpInst(inst)
+            {
+                CountMessages = true,
+            };
+
+            var statistics = rui.GetStatistics();
+            Assert.IsNotNull(statistics);
+            Assert.AreEqual(INSTANCE_NAME, statistics.Transport);
+            Assert.IsNotNull(statistics.MessageCounts);
+            Assert.IsNotNull(statistics.WriterResendCounts);
+            Assert.IsNotNull(statistics.ReaderNackCounts);
+            Assert.AreEqual(0UL, statistics.SendCount);
+            Assert.AreEqual(0UL, statistics.ReceiveCount);
+            Assert.AreEqual(0UL, statistics.ResendCount);
+            Assert.AreEqual(0UL, statistics.NackCount);
+
+            // Exchange some samples through the instance, the counters must increase.
+            rui.UseMulticast = false;
+            var config = TransportRegistry.Instance.CreateConfig(nameof(TestGetStatistics));
+            config.Insert(rui);
+
+            var participant = AssemblyInitializer.Factory.CreateParticipant(AssemblyInitializer.RTPS_DOMAIN);
+            Assert.IsNotNull(participant);
+            TransportRegistry.Instance.BindConfig(config, participant);
+
+            try
+            {
+                var typeSupport = new TestIncludeTypeSupport();
+                var typeName = typeSupport.GetTypeName();
+                var ret = typeSupport.RegisterType(participant, typeName);
+                Assert.AreEqual(ReturnCode.Ok, ret);
+
+                var topic = participant.CreateTopic(nameof(TestGetStatistics), typeName);
+                Assert.IsNotNull(topic);
+
+                var publisher = participant.CreatePublisher();
+                Assert.IsNotNull(publisher);
+                var subscriber = participant.CreateSubscriber();
+                Assert.IsNotNull(subscriber);
+
+                var drQos = new DataReaderQos
+                {
+                    Reliability =
+                    {
+                        Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                    },
+                };
+                var dr = subscriber.CreateDataReader(topic, drQos);
+                Assert.IsNotNull(dr);
+                var dataReader = new TestIncludeDataReader(dr);
+
+                var dw = publisher.CreateDataWriter(topic);
+                Assert.IsNotNull(dw);
+                var dataWriter = new TestIncludeDataWriter(dw);
+
+                Assert.IsTrue(dataWriter.WaitForSubscriptions(1, 5000));
+                Assert.IsTrue(dataReader.WaitForPublications(1, 5000));
+
+                using var evt = new ManualResetEventSlim(false);
+                var statusCondition = dr.StatusCondition;
+                statusCondition.EnabledStatuses = StatusKind.DataAvailableStatus;
+                TestHelper.CreateWaitSetThread(evt, statusCondition);
+
+                for (var i = 0; i < 5; i++)
+                {
+                    ret = dataWriter.Write(new TestInclude { Id = i.ToString(System.Globalization.CultureInfo.InvariantCulture) });
+                    Assert.AreEqual(ReturnCode.Ok, ret);
+                }
+
+                ret = dataWriter.WaitForAcknowledgments(new Duration { Seconds = 5 });
+                Assert.AreEqual(ReturnCode.Ok, ret);
+                Assert.IsTrue(evt.Wait(1_500));
+
+                var after = rui.GetStatistics();
+                Assert.IsNotNull(after);
+                Assert.IsTrue(after.MessageCounts.Count > 0);
+                Assert.IsTrue(after.SendCount > statistics.SendCount);
+                Assert.IsTrue(after.SendBytes > statistics.SendBytes);
+                Assert.IsTrue(after.ReceiveCount > statistics.ReceiveCount);
+                Assert.IsTrue(after.ReceiveBytes > statistics.ReceiveBytes);
+                Assert.IsTrue(after.SendCount >= 5);
+            }
+            finally
+            {
+                participant.DeleteContainedEntities();
+                AssemblyInitializer.Factory.DeleteParticipant(participant);
+                TransportRegistry.Instance.RemoveConfig(config);
+                TransportRegistry.Instance.RemoveInst(rui);
+            }
+        }
         #endregion
     }
 }
@@ -80,6 +80,7 @@ namespace OpenDDSharp.UnitTest
                 MaxSamplesPerPacket = 20U,
                 OptimumPacketSize = 2048u,
                 ThreadPerConnection = true,
+                HostName = "OpenDDSharpHost",
             };
 
             Assert.AreEqual(16000000U, shmemInst.PoolSize);
@@ -91,6 +92,7 @@ namespace OpenDDSharp.UnitTest
             Assert.AreEqual(INSTANCE_NAME, shmemInst.Name);
             Assert.AreEqual(2048u, shmemInst.OptimumPacketSize);
             Assert.IsTrue(shmemInst.ThreadPerConnection);
+            Assert.AreEqual("OpenDDSharpHost", shmemInst.HostName);
 
             TransportRegistry.Instance.RemoveInst(shmemInst);
         }
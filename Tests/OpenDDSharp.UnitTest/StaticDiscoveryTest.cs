@@ -0,0 +1,315 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS.
+Copyright (C) 2018 - 2022 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using JsonWrapper;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using OpenDDSharp.DDS;
+using OpenDDSharp.OpenDDS.DCPS;
+
+namespace OpenDDSharp.UnitTest
+{
+    /// <summary>
+    /// <see cref="StaticDiscovery"/> unit test.
+    /// </summary>
+    [TestClass]
+    public class StaticDiscoveryTest
+    {
+        #region Constants
+        private const string TEST_CATEGORY = "StaticDiscovery";
+        private const int STATIC_DOMAIN = 142;
+        #endregion
+
+        #region Test Method
+        /// <summary>
+        /// Test the <see cref="StaticDiscovery" /> constructor.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestConstructor()
+        {
+            var disc = new StaticDiscovery();
+            Assert.AreEqual(Discovery.DEFAULT_STATIC, disc.Key);
+        }
+
+        /// <summary>
+        /// Test the <see cref="StaticDiscovery.SetParticipantId" /> and <see cref="StaticDiscovery.SetEntityKey(DataWriterQos, IList{byte})" /> methods.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestSetIdentifiers()
+        {
+            var participantQos = new DomainParticipantQos();
+            StaticDiscovery.SetParticipantId(participantQos, new byte[] { 1, 2, 3, 4, 5, 6 });
+            Assert.IsTrue(participantQos.UserData.Value.SequenceEqual(new byte[] { 1, 2, 3, 4, 5, 6 }));
+
+            var writerQos = new DataWriterQos();
+            StaticDiscovery.SetEntityKey(writerQos, new byte[] { 0, 0, 1 });
+            Assert.IsTrue(writerQos.UserData.Value.SequenceEqual(new byte[] { 0, 0, 1 }));
+
+            var readerQos = new DataReaderQos();
+            StaticDiscovery.SetEntityKey(readerQos, new byte[] { 0, 0, 2 });
+            Assert.IsTrue(readerQos.UserData.Value.SequenceEqual(new byte[] { 0, 0, 2 }));
+
+            Assert.ThrowsException<ArgumentNullException>(() => StaticDiscovery.SetParticipantId(null, new byte[6]));
+            Assert.ThrowsException<ArgumentException>(() => StaticDiscovery.SetParticipantId(participantQos, new byte[5]));
+            Assert.ThrowsException<ArgumentException>(() => StaticDiscovery.SetEntityKey(writerQos, new byte[4]));
+            Assert.ThrowsException<ArgumentException>(() => StaticDiscovery.SetEntityKey(readerQos, null));
+        }
+
+        /// <summary>
+        /// Test the <see cref="StaticDiscovery.LoadConfiguration" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestLoadConfiguration()
+        {
+            var disc = new StaticDiscovery();
+
+            Assert.AreEqual(ReturnCode.BadParameter, disc.LoadConfiguration(null));
+            Assert.AreEqual(ReturnCode.Error, disc.LoadConfiguration("missing_static_discovery.ini"));
+        }
+
+        /// <summary>
+        /// Test the <see cref="StaticDiscovery.AddEndpoints" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestAddEndpoints()
+        {
+            var disc = new StaticDiscovery();
+
+            Assert.AreEqual(ReturnCode.BadParameter, disc.AddEndpoints(null));
+            Assert.AreEqual(ReturnCode.BadParameter, disc.AddEndpoints(new[] { new StaticEndpoint { Name = "Invalid" } }));
+
+            var endpoints = new List<StaticEndpoint>
+            {
+                new StaticEndpoint
+                {
+                    Name = "StaticWriter",
+                    Domain = STATIC_DOMAIN,
+                    ParticipantId = new byte[] { 1, 1, 1, 1, 1, 1 },
+                    EntityKey = new byte[] { 0, 0, 1 },
+                    Kind = EndpointKind.DataWriter,
+                    TopicName = nameof(TestAddEndpoints),
+                    TypeName = "TestStruct",
+                    LocalAddress = "127.0.0.1:11000",
+                    DataWriterQos = new DataWriterQos
+                    {
+                        Reliability = { Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos },
+                    },
+                },
+                new StaticEndpoint
+                {
+                    Name = "StaticReader",
+                    Domain = STATIC_DOMAIN,
+                    ParticipantId = new byte[] { 2, 2, 2, 2, 2, 2 },
+                    EntityKey = new byte[] { 0, 0, 2 },
+                    Kind = EndpointKind.DataReader,
+                    TopicName = nameof(TestAddEndpoints),
+                    TypeName = "TestStruct",
+                    LocalAddress = "127.0.0.1:11001",
+                    DataReaderQos = new DataReaderQos
+                    {
+                        Reliability = { Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos },
+                    },
+                },
+            };
+
+            Assert.AreEqual(ReturnCode.Ok, disc.AddEndpoints(endpoints));
+
+            // The names must be unique, they name the configuration and transport sections of the endpoint.
+            var duplicated = new List<StaticEndpoint>
+            {
+                CreateEndpoint("DuplicatedEndpoint", EndpointKind.DataWriter, new byte[] { 0, 0, 3 }, "127.0.0.1:11002"),
+                CreateEndpoint("DuplicatedEndpoint", EndpointKind.DataReader, new byte[] { 0, 0, 4 }, "127.0.0.1:11003"),
+            };
+            Assert.AreEqual(ReturnCode.BadParameter, disc.AddEndpoints(duplicated));
+            Assert.AreEqual(ReturnCode.BadParameter, disc.AddEndpoints(new[] { endpoints[0] }));
+
+            // The QoS policies that the static discovery cannot declare are rejected.
+            var unsupported = CreateEndpoint("UnsupportedWriter", EndpointKind.DataWriter, new byte[] { 0, 0, 5 }, "127.0.0.1:11004");
+            unsupported.DataWriterQos = new DataWriterQos
+            {
+                WriterDataLifecycle = { AutodisposeUnregisteredInstances = false },
+            };
+            Assert.AreEqual(ReturnCode.Unsupported, disc.AddEndpoints(new[] { unsupported }));
+
+            unsupported = CreateEndpoint("UnsupportedReader", EndpointKind.DataReader, new byte[] { 0, 0, 6 }, "127.0.0.1:11005");
+            unsupported.DataReaderQos = new DataReaderQos
+            {
+                Representation = { Value = new List<short> { DataRepresentationQosPolicy.XCDR2_DATA_REPRESENTATION } },
+            };
+            Assert.AreEqual(ReturnCode.Unsupported, disc.AddEndpoints(new[] { unsupported }));
+        }
+
+        /// <summary>
+        /// Test that the statically declared endpoints are matched as soon as they are enabled.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestMatchOnEnable()
+        {
+            var writerParticipantId = new byte[] { 3, 3, 3, 3, 3, 3 };
+            var readerParticipantId = new byte[] { 4, 4, 4, 4, 4, 4 };
+            var writerKey = new byte[] { 0, 0, 7 };
+            var readerKey = new byte[] { 0, 0, 8 };
+
+            ParticipantService.Instance.SetRepoDomain(STATIC_DOMAIN, Discovery.DEFAULT_STATIC);
+
+            var typeName = new TestStructTypeSupport().GetTypeName();
+
+            // Best effort endpoints associate without any handshake, so the match is complete when Enable returns.
+            var writerQos = new DataWriterQos
+            {
+                Reliability = { Kind = ReliabilityQosPolicyKind.BestEffortReliabilityQos },
+            };
+            StaticDiscovery.SetEntityKey(writerQos, writerKey);
+
+            var readerQos = new DataReaderQos
+            {
+                Reliability = { Kind = ReliabilityQosPolicyKind.BestEffortReliabilityQos },
+            };
+            StaticDiscovery.SetEntityKey(readerQos, readerKey);
+
+            var disc = new StaticDiscovery();
+            var ret = disc.AddEndpoints(new[]
+            {
+                new StaticEndpoint
+                {
+                    Name = "MatchWriter",
+                    Domain = STATIC_DOMAIN,
+                    ParticipantId = writerParticipantId,
+                    EntityKey = writerKey,
+                    Kind = EndpointKind.DataWriter,
+                    TopicName = nameof(TestMatchOnEnable),
+                    TypeName = typeName,
+                    LocalAddress = "127.0.0.1:11006",
+                    DataWriterQos = writerQos,
+                },
+                new StaticEndpoint
+                {
+                    Name = "MatchReader",
+                    Domain = STATIC_DOMAIN,
+                    ParticipantId = readerParticipantId,
+                    EntityKey = readerKey,
+                    Kind = EndpointKind.DataReader,
+                    TopicName = nameof(TestMatchOnEnable),
+                    TypeName = typeName,
+                    LocalAddress = "127.0.0.1:11007",
+                    DataReaderQos = readerQos,
+                },
+            });
+            Assert.AreEqual(ReturnCode.Ok, ret);
+
+            DomainParticipant writerParticipant = null;
+            DomainParticipant readerParticipant = null;
+            try
+            {
+                writerParticipant = CreateParticipant(writerParticipantId, typeName);
+                readerParticipant = CreateParticipant(readerParticipantId, typeName);
+
+                var publisher = writerParticipant.CreatePublisher(new PublisherQos
+                {
+                    EntityFactory = { AutoenableCreatedEntities = false },
+                });
+                Assert.IsNotNull(publisher);
+                var writer = publisher.CreateDataWriter((Topic)writerParticipant.LookupTopicDescription(nameof(TestMatchOnEnable)), writerQos);
+                Assert.IsNotNull(writer);
+                TransportRegistry.Instance.BindConfig("MatchWriter_config", writer);
+
+                var subscriber = readerParticipant.CreateSubscriber(new SubscriberQos
+                {
+                    EntityFactory = { AutoenableCreatedEntities = false },
+                });
+                Assert.IsNotNull(subscriber);
+                var reader = subscriber.CreateDataReader(readerParticipant.LookupTopicDescription(nameof(TestMatchOnEnable)), readerQos);
+                Assert.IsNotNull(reader);
+                TransportRegistry.Instance.BindConfig("MatchReader_config", reader);
+
+                Assert.AreEqual(ReturnCode.Ok, publisher.Enable());
+                Assert.AreEqual(ReturnCode.Ok, writer.Enable());
+
+                // No discovery traffic is involved, the declared reader is matched by the enable itself.
+                var publicationStatus = default(PublicationMatchedStatus);
+                Assert.AreEqual(ReturnCode.Ok, writer.GetPublicationMatchedStatus(ref publicationStatus));
+                Assert.AreEqual(1, publicationStatus.CurrentCount);
+                Assert.AreEqual(1, publicationStatus.TotalCount);
+
+                Assert.AreEqual(ReturnCode.Ok, subscriber.Enable());
+                Assert.AreEqual(ReturnCode.Ok, reader.Enable());
+
+                var subscriptionStatus = default(SubscriptionMatchedStatus);
+                Assert.AreEqual(ReturnCode.Ok, reader.GetSubscriptionMatchedStatus(ref subscriptionStatus));
+                Assert.AreEqual(1, subscriptionStatus.CurrentCount);
+                Assert.AreEqual(1, subscriptionStatus.TotalCount);
+            }
+            finally
+            {
+                DeleteParticipant(writerParticipant);
+                DeleteParticipant(readerParticipant);
+            }
+        }
+        #endregion
+
+        #region Methods
+        private static StaticEndpoint CreateEndpoint(string name, EndpointKind kind, byte[] entityKey, string localAddress)
+        {
+            return new StaticEndpoint
+            {
+                Name = name,
+                Domain = STATIC_DOMAIN,
+                ParticipantId = new byte[] { 5, 5, 5, 5, 5, 5 },
+                EntityKey = entityKey,
+                Kind = kind,
+                TopicName = nameof(TestAddEndpoints),
+                TypeName = "TestStruct",
+                LocalAddress = localAddress,
+            };
+        }
+
+        private static DomainParticipant CreateParticipant(byte[] participantId, string typeName)
+        {
+            var qos = new DomainParticipantQos();
+            StaticDiscovery.SetParticipantId(qos, participantId);
+
+            var participant = AssemblyInitializer.Factory.CreateParticipant(STATIC_DOMAIN, qos);
+            Assert.IsNotNull(participant);
+
+            Assert.AreEqual(ReturnCode.Ok, new TestStructTypeSupport().RegisterType(participant, typeName));
+            Assert.IsNotNull(participant.CreateTopic(nameof(TestMatchOnEnable), typeName));
+
+            return participant;
+        }
+
+        private static void DeleteParticipant(DomainParticipant participant)
+        {
+            if (participant == null)
+            {
+                return;
+            }
+
+            participant.DeleteContainedEntities();
+            AssemblyInitializer.Factory.DeleteParticipant(participant);
+        }
+        #endregion
+    }
+}
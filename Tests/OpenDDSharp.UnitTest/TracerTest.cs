@@ -0,0 +1,215 @@
+﻿/*********************************************************************
+This file is part of OpenDDSharp.
+
+OpenDDSharp is a .NET wrapper for OpenDDS.
+Copyright (C) 2018 Jose Morato
+
+OpenDDSharp is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+OpenDDSharp is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenDDSharp. If not, see <http://www.gnu.org/licenses/>.
+**********************************************************************/
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+using JsonWrapper;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using OpenDDSharp.DDS;
+using OpenDDSharp.OpenDDS.DCPS;
+using OpenDDSharp.UnitTest.Helpers;
+using OpenDDSharp.UnitTest.Listeners;
+
+namespace OpenDDSharp.UnitTest
+{
+    /// <summary>
+    /// <see cref="Tracer"/> unit test class.
+    /// </summary>
+    [TestClass]
+    public class TracerTest
+    {
+        #region Constants
+        private const string TEST_CATEGORY = "Tracer";
+        #endregion
+
+        #region Initialization/Cleanup
+        /// <summary>
+        /// The test cleanup method.
+        /// </summary>
+        [TestCleanup]
+        public void TestCleanup()
+        {
+            Tracer.FlushOnTrigger(null, TimeSpan.Zero);
+            Tracer.Enabled = false;
+            Tracer.TriggerThreshold = TimeSpan.Zero;
+            Tracer.Clear();
+        }
+        #endregion
+
+        #region Test Methods
+        /// <summary>
+        /// Test the <see cref="Tracer" /> properties.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestProperties()
+        {
+            Assert.IsFalse(Tracer.Enabled);
+            Assert.IsFalse(Tracer.Triggered);
+            Assert.AreEqual(TimeSpan.Zero, Tracer.TriggerThreshold);
+            Assert.AreNotEqual(IntPtr.Zero, Tracer.NativeState);
+
+            Tracer.Enabled = true;
+            Assert.IsTrue(Tracer.Enabled);
+
+            Tracer.TriggerThreshold = TimeSpan.FromMilliseconds(5);
+            Assert.AreEqual(TimeSpan.FromMilliseconds(5), Tracer.TriggerThreshold);
+
+            Tracer.Enabled = false;
+            Assert.IsFalse(Tracer.Enabled);
+        }
+
+        /// <summary>
+        /// Test the <see cref="Tracer.Flush(string)" /> method.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestFlush()
+        {
+            var path = Path.Combine(Path.GetTempPath(), Guid.NewGuid() + ".json");
+
+            try
+            {
+                var waitSet = new WaitSet();
+                var guardCondition = new GuardCondition();
+                Assert.AreEqual(ReturnCode.Ok, waitSet.AttachCondition(guardCondition));
+                var conditions = new List<Condition>();
+
+                // Nothing is recorded while the tracer is disabled.
+                guardCondition.TriggerValue = true;
+                Assert.AreEqual(ReturnCode.Ok, waitSet.Wait(conditions, new Duration { Seconds = 1 }));
+                Assert.AreEqual(0, Tracer.Flush(path));
+
+                Tracer.Enabled = true;
+                Assert.AreEqual(ReturnCode.Ok, waitSet.Wait(conditions, new Duration { Seconds = 1 }));
+                Tracer.Enabled = false;
+
+                Assert.IsTrue(Tracer.Flush(path) >= 1);
+                var content = File.ReadAllText(path);
+                Assert.IsTrue(content.StartsWith("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", StringComparison.Ordinal));
+                Assert.IsTrue(content.Contains("\"name\":\"WaitSet_Wait\""));
+                Assert.IsTrue(content.Contains("\"ph\":\"X\""));
+
+                Tracer.Clear();
+                Assert.AreEqual(0, Tracer.Flush(path));
+
+                Assert.AreEqual(ReturnCode.Ok, waitSet.DetachCondition(guardCondition));
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        /// <summary>
+        /// Test the <see cref="Tracer.TriggerThreshold" /> freezes the recording on a slow listener callback
+        /// and ignores the blocking waits.
+        /// </summary>
+        [TestMethod]
+        [TestCategory(TEST_CATEGORY)]
+        public void TestTrigger()
+        {
+            var path = Path.Combine(Path.GetTempPath(), Guid.NewGuid() + ".json");
+            var participant = AssemblyInitializer.Factory.CreateParticipant(AssemblyInitializer.RTPS_DOMAIN);
+            Assert.IsNotNull(participant);
+            participant.BindRtpsUdpTransportConfig();
+
+            using var listener = new MyDataReaderListener();
+            try
+            {
+                var support = new TestStructTypeSupport();
+                var typeName = support.GetTypeName();
+                Assert.AreEqual(ReturnCode.Ok, support.RegisterType(participant, typeName));
+
+                var topic = participant.CreateTopic(nameof(TestTrigger), typeName);
+                Assert.IsNotNull(topic);
+                var publisher = participant.CreatePublisher();
+                Assert.IsNotNull(publisher);
+                var subscriber = participant.CreateSubscriber();
+                Assert.IsNotNull(subscriber);
+
+                var writer = publisher.CreateDataWriter(topic);
+                Assert.IsNotNull(writer);
+                var dataWriter = new TestStructDataWriter(writer);
+
+                var drQos = new DataReaderQos
+                {
+                    Reliability =
+                    {
+                        Kind = ReliabilityQosPolicyKind.ReliableReliabilityQos,
+                    },
+                };
+                var reader = subscriber.CreateDataReader(topic, drQos);
+                Assert.IsNotNull(reader);
+                var dataReader = new TestStructDataReader(reader);
+
+                Assert.IsTrue(reader.WaitForPublications(1, 5_000));
+                Assert.IsTrue(writer.WaitForSubscriptions(1, 5_000));
+
+                using var evt = new ManualResetEventSlim(false);
+                listener.DataAvailable += _ =>
+                {
+                    // The slow operation the trigger must catch.
+                    Thread.Sleep(50);
+                    dataReader.Take(new List<TestStruct>(), new List<SampleInfo>());
+                    evt.Set();
+                };
+                Assert.AreEqual(ReturnCode.Ok, reader.SetListener(listener, StatusKind.DataAvailableStatus));
+
+                Tracer.TriggerThreshold = TimeSpan.FromMilliseconds(20);
+                Tracer.Enabled = true;
+
+                // A wait longer than the threshold is idle time, not a spike.
+                var waitSet = new WaitSet();
+                var guardCondition = new GuardCondition();
+                Assert.AreEqual(ReturnCode.Ok, waitSet.AttachCondition(guardCondition));
+                Assert.AreEqual(ReturnCode.Timeout, waitSet.Wait(new List<Condition>(), new Duration { Seconds = 0, NanoSeconds = 50_000_000 }));
+                Assert.AreEqual(ReturnCode.Ok, waitSet.DetachCondition(guardCondition));
+                Assert.IsFalse(Tracer.Triggered);
+                Assert.IsTrue(Tracer.Enabled);
+
+                Assert.AreEqual(ReturnCode.Ok, dataWriter.Write(new TestStruct { Id = 1 }));
+                Assert.IsTrue(evt.Wait(5_000));
+
+                // The managed callback ends before the native dispatch span, wait for it to be recorded.
+                Assert.IsTrue(SpinWait.SpinUntil(() => Tracer.Triggered, 5_000));
+                Assert.IsFalse(Tracer.Enabled);
+
+                Assert.IsTrue(Tracer.Flush(path) >= 1);
+                var content = File.ReadAllText(path);
+                Assert.IsTrue(content.Contains("\"name\":\"DataReaderListener_OnDataAvailable_Managed\""));
+                Assert.IsTrue(content.Contains("\"name\":\"WaitSet_Wait\""));
+
+                Tracer.Clear();
+                Assert.IsFalse(Tracer.Triggered);
+
+                Assert.AreEqual(ReturnCode.Ok, reader.SetListener(null, StatusMask.NoStatusMask));
+            }
+            finally
+            {
+                participant.DeleteContainedEntities();
+                AssemblyInitializer.Factory.DeleteParticipant(participant);
+                File.Delete(path);
+            }
+        }
+        #endregion
+    }
+}